@@ -0,0 +1,17 @@
+#include <benchmark/benchmark.h>
+#include "Logger.h"
+
+// the benchmarks only log their errors, see make bench for the JSON output
+int main(int argc, char** argv)
+{
+    Logger::getInstance().setVerbosityLevel(Logger::ERROR);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "AssetLoader.h"
+#include "Game.h"
+#include "GameSettings.h"
+#include "Player.h"
+#include "Random.h"
+#include "RaylibHeadless.h"
+#include "SpriteFactory.h"
+#include "TimerWheel.h"
+
+namespace GameBench
+{
+// The game with its player on the headless raylib. The player only holds the
+// game weakly, so that both are released at the end of the benchmark.
+std::shared_ptr<Game> createGame(std::shared_ptr<RaylibHeadless> raylibPtr)
+{
+    std::shared_ptr<SpriteFactory> factoryPtr = std::make_shared<SpriteFactory>(std::make_shared<Random>(1));
+    std::shared_ptr<TimerWheel>    timersPtr  = std::make_shared<TimerWheel>();
+
+    std::shared_ptr<Game> game = std::make_shared<Game>(raylibPtr, factoryPtr, timersPtr, std::make_shared<AssetLoader>(raylibPtr, 0));
+    std::weak_ptr<Game>   weak = game;
+
+    std::shared_ptr<Player> player = std::make_shared<Player>(raylibPtr, timersPtr, [weak](Sprite::SpriteAttr_t attr) { weak.lock()->playerShootLaser(attr); });
+    game->setPlayer(player);
+    game->setSpriteLayout(SpriteStore::PACKED_ARRAYS);
+    return game;
+}
+
+// Play the bench session of asteroidsHeadless --bench with range(0) as the
+// spawn multiplier: BENCH_WARMUP_FRAMES fill the screen, then every iteration
+// plays a frame, of one tick, and is timed by the Game::Stats_t counter phase.
+void playFrames(benchmark::State& state, uint64_t Game::Stats_t::*phase)
+{
+    uint64_t                        frames    = BENCH_WARMUP_FRAMES + state.max_iterations;
+    std::shared_ptr<RaylibHeadless> raylibPtr = std::make_shared<RaylibHeadless>(1.0f / SIMULATION_TICK_RATE);
+    std::shared_ptr<Game>           game      = createGame(raylibPtr);
+    game->setSpawnMultiplier(state.range(0));
+    game->setLives(Game::UNLIMITED_LIVES);
+
+    // click Start, then sweep left and right while shooting
+    raylibPtr->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+    for (uint64_t frame = 2; frame < frames; frame += 120)
+    {
+        raylibPtr->scriptKeyDown(frame, frame + 59, KEY_RIGHT);
+        raylibPtr->scriptKeyDown(frame + 60, frame + 119, KEY_LEFT);
+        for (uint64_t shot = frame; shot < (frame + 120); shot += 10)
+        {
+            raylibPtr->scriptKeyPressed(shot, KEY_SPACE);
+        }
+    }
+    raylibPtr->setFrameLimit(BENCH_WARMUP_FRAMES);
+    game->run();
+    game->resetStats();
+
+    uint64_t frameLimit = BENCH_WARMUP_FRAMES;
+    for (auto _ : state)
+    {
+        uint64_t before = game->getStats().*phase;
+        raylibPtr->setFrameLimit(++frameLimit);
+        game->run();
+        state.SetIterationTime((game->getStats().*phase - before) * 1e-9);
+    }
+
+    Game::Stats_t stats       = game->getStats();
+    state.counters["sprites"] = (stats.m_ticks > 0) ? (static_cast<double>(stats.m_tickSprites) / stats.m_ticks) : 0;
+    state.SetItemsProcessed(stats.m_tickSprites);
+}
+
+void checkCollisions(benchmark::State& state)
+{
+    playFrames(state, &Game::Stats_t::m_collisionNs);
+}
+
+void updatePlayingPage(benchmark::State& state)
+{
+    playFrames(state, &Game::Stats_t::m_updateNs);
+}
+
+BENCHMARK(checkCollisions)->ArgName("multiplier")->Arg(1)->Arg(10)->Arg(100)->UseManualTime();
+BENCHMARK(updatePlayingPage)->ArgName("multiplier")->Arg(1)->Arg(10)->Arg(100)->UseManualTime();
+
+} // namespace GameBench
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <string>
+#include "Logger.h"
+
+namespace LoggerBench
+{
+// the messages are formatted as usual and written to a std::cout without buffer
+std::streambuf* coutBuffer = nullptr;
+
+void silence(void)
+{
+    coutBuffer = std::cout.rdbuf(nullptr);
+}
+
+void setupSynchronous(const benchmark::State&)
+{
+    silence();
+    Logger::getInstance().setMode(Logger::SYNCHRONOUS);
+}
+
+void setupBlocking(const benchmark::State&)
+{
+    silence();
+    Logger::getInstance().setMode(Logger::ASYNCHRONOUS, Logger::BLOCK);
+}
+
+void setupDropping(const benchmark::State&)
+{
+    silence();
+    Logger::getInstance().setMode(Logger::ASYNCHRONOUS, Logger::DROP);
+}
+
+void teardown(const benchmark::State&)
+{
+    Logger::getInstance().flush();
+    Logger::getInstance().setMode(Logger::SYNCHRONOUS);
+    std::cout.rdbuf(coutBuffer);
+}
+
+// Every thread logs errors, which pass the verbosity level of the benchmarks,
+// of the size the game logs. The throughput is the messages per second of all
+// the threads together.
+void log(benchmark::State& state)
+{
+    std::string message = "sprite pool of type 3 grown to 4096, thread " + std::to_string(state.thread_index());
+    uint64_t    dropped = Logger::getInstance().getDroppedCount();
+    for (auto _ : state)
+    {
+        Logger::getInstance().log(Logger::ERROR, message);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0)
+    {
+        state.counters["dropped"] = Logger::getInstance().getDroppedCount() - dropped;
+    }
+}
+
+BENCHMARK(log)->Name("log/synchronous")->Setup(setupSynchronous)->Teardown(teardown)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(log)->Name("log/asynchronousBlock")->Setup(setupBlocking)->Teardown(teardown)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(log)->Name("log/asynchronousDrop")->Setup(setupDropping)->Teardown(teardown)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace LoggerBench
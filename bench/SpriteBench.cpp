@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <memory>
+#include <vector>
+#include "GameSettings.h"
+#include "Random.h"
+#include "RaylibHeadless.h"
+#include "SpriteFactory.h"
+
+namespace SpriteBench
+{
+// stand-ins for the atlas frames, the explosion animates through all of them
+const std::array<TextureAtlas::Frame_t, 64> fakeFrames = {};
+
+// the attributes the game spawns the sprites of type with
+std::vector<Sprite::SpriteAttr_t> spawnAttributes(SpriteFactory& factory, SpriteFactory::SpriteType type, uint32_t count)
+{
+    std::vector<Sprite::SpriteAttr_t> attrs(count);
+    switch (type)
+    {
+        case SpriteFactory::RED_LASER:
+        case SpriteFactory::YELLOW_LASER:
+            for (Sprite::SpriteAttr_t& attr : attrs)
+            {
+                attr.m_position  = {(WINDOW_WIDTH / 2), (WINDOW_HEIGHT / 2)};
+                attr.m_direction = {0, (type == SpriteFactory::RED_LASER) ? -1.0f : 1.0f};
+            }
+            break;
+
+        case SpriteFactory::EXPLOSION:
+            for (Sprite::SpriteAttr_t& attr : attrs)
+            {
+                attr.m_position = {(WINDOW_WIDTH / 2), (WINDOW_HEIGHT / 2)};
+                attr.m_scale    = 1;
+            }
+            break;
+
+        default:
+            factory.fillSpawnAttributes(type, attrs.data(), count);
+            break;
+    }
+    return attrs;
+}
+
+// Step range(0) sprites of type by one tick, the sprites leaving the screen
+// or ending their animation being reset to their spawn attributes.
+void stepSprites(benchmark::State& state, SpriteFactory::SpriteType type)
+{
+    uint32_t                        count     = state.range(0);
+    std::shared_ptr<RaylibHeadless> raylibPtr = std::make_shared<RaylibHeadless>(1.0f / 60);
+    raylibPtr->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "SpriteBench");
+
+    SpriteFactory                        factory(std::make_shared<Random>(1));
+    std::vector<Sprite::SpriteAttr_t>    attrs = spawnAttributes(factory, type, count);
+    std::vector<std::shared_ptr<Sprite>> sprites;
+    for (const Sprite::SpriteAttr_t& attr : attrs)
+    {
+        std::shared_ptr<Sprite> sprite = factory.getSprite(type, raylibPtr, attr, [](Sprite::SpriteAttr_t) {});
+        sprite->setTextures((type == SpriteFactory::EXPLOSION) ? TextureAtlas::Frames_t(fakeFrames) : TextureAtlas::Frames_t(fakeFrames.data(), 1));
+        sprite->reset(attr);
+        sprites.push_back(sprite);
+    }
+
+    for (auto _ : state)
+    {
+        for (uint32_t index = 0; index < count; index++)
+        {
+            Sprite& sprite = *sprites[index];
+            sprite.step(1.0f / SIMULATION_TICK_RATE);
+            if (sprite.m_discard)
+            {
+                sprite.reset(attrs[index]);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_CAPTURE(stepSprites, explosion, SpriteFactory::EXPLOSION)->Arg(1024);
+BENCHMARK_CAPTURE(stepSprites, redLaser, SpriteFactory::RED_LASER)->Arg(1024);
+BENCHMARK_CAPTURE(stepSprites, yellowLaser, SpriteFactory::YELLOW_LASER)->Arg(1024);
+BENCHMARK_CAPTURE(stepSprites, meteor, SpriteFactory::METEOR)->Arg(1024);
+BENCHMARK_CAPTURE(stepSprites, opponent, SpriteFactory::OPPONENT)->Arg(1024);
+BENCHMARK_CAPTURE(stepSprites, star, SpriteFactory::STAR)->Arg(1024);
+BENCHMARK_CAPTURE(stepSprites, powerup, SpriteFactory::POWERUP)->Arg(1024);
+
+} // namespace SpriteBench
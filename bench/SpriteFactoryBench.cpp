@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include "GameSettings.h"
+#include "Random.h"
+#include "RaylibHeadless.h"
+#include "SpriteFactory.h"
+
+namespace SpriteFactoryBench
+{
+// Get range(0) meteors and recycle them all, the way the spawns and the
+// discards of a tick go through the factory. The pool keeps range(1) idle
+// meteors, 0 allocating every sprite.
+void getSpriteChurn(benchmark::State& state)
+{
+    uint32_t                        count     = state.range(0);
+    std::shared_ptr<RaylibHeadless> raylibPtr = std::make_shared<RaylibHeadless>(1.0f / 60);
+    raylibPtr->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "SpriteFactoryBench");
+
+    SpriteFactory factory(std::make_shared<Random>(1));
+    factory.setPoolCapacity(SpriteFactory::METEOR, state.range(1));
+
+    std::vector<std::shared_ptr<Sprite>> sprites(count);
+    Sprite::SpriteAttr_t                 attr;
+    for (auto _ : state)
+    {
+        for (std::shared_ptr<Sprite>& sprite : sprites)
+        {
+            sprite = factory.getSprite(SpriteFactory::METEOR, raylibPtr, attr);
+        }
+        for (std::shared_ptr<Sprite>& sprite : sprites)
+        {
+            factory.recycleSprite(SpriteFactory::METEOR, std::move(sprite));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+
+    SpriteFactory::PoolStats_t stats = factory.getPoolStats(SpriteFactory::METEOR);
+    state.counters["reuseRatio"]     = static_cast<double>(stats.m_reuses) / (stats.m_reuses + stats.m_allocations);
+}
+
+BENCHMARK(getSpriteChurn)->ArgNames({"sprites", "pool"})->Args({64, 0})->Args({64, 64})->Args({4096, 0})->Args({4096, 4096});
+
+} // namespace SpriteFactoryBench
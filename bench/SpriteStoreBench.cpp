@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "GameSettings.h"
+#include "Random.h"
+#include "RaylibHeadless.h"
+#include "SpriteFactory.h"
+#include "SpriteStore.h"
+
+namespace SpriteStoreBench
+{
+// Compact a store of range(0) meteors of which one in range(1) is marked, the
+// marked ones going back to the factory as in Game::discardSprites(). Only
+// discardMarked() is timed, the store is refilled between the iterations.
+void discardMarked(benchmark::State& state)
+{
+    uint32_t                        count     = state.range(0);
+    uint32_t                        stride    = state.range(1);
+    std::shared_ptr<RaylibHeadless> raylibPtr = std::make_shared<RaylibHeadless>(1.0f / 60);
+    raylibPtr->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "SpriteStoreBench");
+
+    SpriteFactory            factory(std::make_shared<Random>(1));
+    SpriteStore              store(SpriteStore::CIRCLE);
+    Sprite::SpriteAttr_t     attr;
+    SpriteStore::Recycler_t  recycler = [&factory](std::shared_ptr<Sprite> sprite) { factory.recycleSprite(SpriteFactory::METEOR, sprite); };
+    auto                     refill   = [&](void) {
+        while (store.size() < count)
+        {
+            store.add(factory.getSprite(SpriteFactory::METEOR, raylibPtr, attr));
+        }
+    };
+    refill();
+
+    uint64_t discarded = 0;
+    for (auto _ : state)
+    {
+        for (uint32_t index = 0; index < count; index += stride)
+        {
+            store.getSprite(index)->m_discard = true;
+        }
+        auto start = std::chrono::steady_clock::now();
+        store.discardMarked(recycler);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        state.SetIterationTime(elapsed.count());
+
+        discarded += count - store.size();
+        refill();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["discarded"] = static_cast<double>(discarded) / state.iterations();
+}
+
+BENCHMARK(discardMarked)->ArgNames({"sprites", "stride"})->ArgsProduct({{1024, 16384, 65536}, {2, 16}})->UseManualTime();
+
+} // namespace SpriteStoreBench
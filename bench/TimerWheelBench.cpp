@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include "TimerWheel.h"
+
+namespace TimerWheelBench
+{
+// Advance the wheel by a tick with range(0) repeating timers active, their
+// durations spread over 1 ms to 10 s so that every level of the wheel is used.
+void advance(benchmark::State& state)
+{
+    TimerWheel timers;
+    uint64_t   fired = 0;
+    for (int64_t index = 0; index < state.range(0); index++)
+    {
+        timers.add(0.001 * (1 + ((index * 7919) % 10000)), true, true, [&fired](void) { fired++; });
+    }
+
+    for (auto _ : state)
+    {
+        timers.advance(1.0 / 60);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["firedPerTick"] = static_cast<double>(fired) / state.iterations();
+}
+
+BENCHMARK(advance)->ArgName("timers")->RangeMultiplier(8)->Range(8, 32768);
+
+} // namespace TimerWheelBench
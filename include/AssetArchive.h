@@ -0,0 +1,79 @@
+#ifndef ASSETARCHIVE_H
+#define ASSETARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Read only view of a packed asset archive, mapped into memory as a whole.
+// The file starts with a header and a table of contents, followed by the
+// names and the contents, each content aligned on ALIGNMENT bytes. A content
+// is stored as is or compressed, and carries the hash of its original bytes.
+// Entries are named by their path with forward slashes, starting with the
+// name of the directory that was packed, e.g. "resources/images/meteor.png".
+// Reading is thread safe, stored contents are returned without any copy.
+class AssetArchive
+{
+public:
+    typedef enum COMPRESSION_e
+    {
+        STORED = 0,
+        LZ
+    } COMPRESSION_t;
+
+    static constexpr uint32_t VERSION   = 1;
+    static constexpr uint32_t ALIGNMENT = 64;
+
+    AssetArchive(const std::string& fileName);
+    ~AssetArchive(void);
+
+    AssetArchive(const AssetArchive&)            = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    bool           isOpen(void) const;
+    uint32_t       size(void) const;
+    bool           contains(const std::string& name) const;
+    const uint8_t* read(const std::string& name, std::vector<uint8_t>& buffer, uint32_t& size) const;
+    bool           verify(void) const;
+
+    static bool                 pack(const std::filesystem::path& root, const std::string& fileName);
+    static std::vector<uint8_t> compress(const uint8_t* data, size_t size);
+    static bool                 decompress(const uint8_t* data, size_t size, uint8_t* out, size_t outSize);
+    static uint64_t             hash(const uint8_t* data, size_t size);
+
+private:
+    // on disk, little endian
+    typedef struct Header_s
+    {
+        char     m_magic[4];
+        uint32_t m_version;
+        uint32_t m_entryCount;
+        uint32_t m_alignment;
+    } Header_t;
+
+    typedef struct Entry_s
+    {
+        uint64_t m_offset;
+        uint64_t m_storedSize;
+        uint64_t m_size;
+        uint64_t m_hash;
+        uint32_t m_nameOffset;
+        uint16_t m_nameLength;
+        uint16_t m_compression;
+    } Entry_t;
+
+    bool map(const std::string& fileName);
+    void unmap(void);
+    bool index(void);
+
+    const uint8_t*                            m_data    = nullptr;
+    size_t                                    m_size    = 0;
+    void*                                     m_mapping = nullptr;
+    const Entry_t*                            m_entries = nullptr;
+    std::unordered_map<std::string, uint32_t> m_names;
+};
+
+#endif // ASSETARCHIVE_H
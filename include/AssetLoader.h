@@ -0,0 +1,77 @@
+#ifndef ASSETLOADER_H
+#define ASSETLOADER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AssetArchive.h"
+#include "RaylibInterface.h"
+
+// Decodes image and audio files into CPU side buffers on a pool of worker
+// threads, in the order they were added. The caller takes the decoded buffers
+// once they are done and uploads them to the GPU or the audio device itself,
+// on the thread that owns the window. Progress can be polled at any time.
+// With no workers every file is decoded on the calling thread when it is added.
+// Buffers that were never taken are released with the loader.
+// Once an archive is set, the files are read from it rather than from disk,
+// the decoders get their bytes straight from the mapping.
+class AssetLoader
+{
+public:
+    typedef enum ASSET_e
+    {
+        IMAGE = 0,
+        WAVE
+    } ASSET_t;
+
+    typedef uint32_t Handle_t;
+
+    AssetLoader(std::shared_ptr<RaylibInterface> raylibPtr, uint32_t workers);
+    ~AssetLoader(void);
+
+    void           setArchive(std::shared_ptr<AssetArchive> archivePtr);
+    const uint8_t* read(const std::string& fileName, std::vector<uint8_t>& buffer, uint32_t& size) const;
+
+    Handle_t add(ASSET_t type, const std::string& fileName);
+    bool     isDone(void) const;
+    float    getProgress(void) const;
+    void     wait(void);
+    Image    takeImage(Handle_t handle);
+    Wave     takeWave(Handle_t handle);
+
+private:
+    typedef struct Job_s
+    {
+        ASSET_t     m_type;
+        std::string m_fileName;
+        Image       m_image = {nullptr, 0, 0, 0, 0};
+        Wave        m_wave  = {0, 0, 0, 0, nullptr};
+        bool        m_done  = false;
+        bool        m_taken = false;
+    } Job_t;
+
+    void decode(Job_t& job);
+    void work(void);
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr  = nullptr;
+    std::shared_ptr<AssetArchive>    m_archivePtr = nullptr;
+    std::vector<std::thread>         m_workers;
+
+    // jobs never move once added, workers decode them without holding the lock
+    std::deque<Job_t>       m_jobs;
+    uint32_t                m_nextJob  = 0;
+    std::atomic<uint32_t>   m_added    = 0;
+    std::atomic<uint32_t>   m_decoded  = 0;
+    bool                    m_stopping = false;
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_jobAdded;
+    std::condition_variable m_jobDone;
+};
+
+#endif // ASSETLOADER_H
@@ -0,0 +1,146 @@
+#ifndef AUDIOQUEUE_H
+#define AUDIOQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "RaylibInterface.h"
+
+// RaylibInterface that hands the audio calls to an audio thread. The calls
+// playing sounds and music, setting their volume and unloading them, and
+// opening and closing the audio device, are pushed as commands into a single
+// producer, single consumer ring, and made in order by the audio thread on the
+// audio interface, raylib itself rather than a render queue in front of it. The
+// thread refills the music being played every REFILL_INTERVAL_MS on its own,
+// updateMusicStream() does nothing then, so that a long frame no longer starves
+// the music stream. Loading sounds and music, and every other call, is
+// forwarded as is to the wrapped interface.
+//
+// Only the thread calling the interface may push commands. Opening and closing
+// the device wait for the audio thread to be done with them, so do the calls
+// pushing into a full ring, the other calls return right away.
+class AudioQueue : public RaylibInterface
+{
+public:
+    static constexpr uint32_t QUEUE_CAPACITY     = 256;
+    static constexpr uint32_t REFILL_INTERVAL_MS = 4;
+
+    typedef enum THREADING_e
+    {
+        CALLING_THREAD = 0,
+        AUDIO_THREAD
+    } THREADING_t;
+
+    AudioQueue(std::shared_ptr<RaylibInterface> raylibPtr, std::shared_ptr<RaylibInterface> audioPtr);
+    virtual ~AudioQueue(void);
+
+    void setThreading(THREADING_t threading);
+    void stop(void);
+
+    double    getTime(void) override;
+    void      initWindow(int width, int height, std::string title) override;
+    void      closeWindow(void) override;
+    Texture2D loadTexture(std::string filename) override;
+    void      unloadTexture(Texture2D texture) override;
+    bool      windowShouldClose(void) override;
+    float     getFrameTime(void) override;
+    void      beginDrawing(void) override;
+    void      clearBackground(Color color) override;
+    void      endDrawing(void) override;
+    void      drawTextureV(Texture2D texture, Vector2 position, Color tint) override;
+    bool      isKeyDown(int key) override;
+    bool      isWindowReady(void) override;
+    void      drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint) override;
+    bool      isKeyPressed(int key) override;
+    bool      checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2) override;
+    bool      checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec) override;
+    void      drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+    Font      loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount) override;
+    void      drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void      unloadFont(Font font) override;
+    void      initAudioDevice(void) override;
+    void      closeAudioDevice(void) override;
+    Sound     loadSound(std::string fileName) override;
+    void      playSound(Sound sound) override;
+    void      unloadSound(Sound sound) override;
+    Music     loadMusicStream(std::string fileName) override;
+    void      unloadMusicStream(Music music) override;
+    void      updateMusicStream(Music music) override;
+    void      playMusicStream(Music music) override;
+    void      drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    Vector2   getMousePosition(void) override;
+    bool      checkCollisionPointRec(Vector2 point, Rectangle rec) override;
+    bool      isMouseButtonPressed(int button) override;
+    Vector2   measureTextEx(Font font, std::string text, float fontSize, float spacing) override;
+    Image     loadImage(std::string fileName) override;
+    void      unloadImage(Image image) override;
+    Image     genImageColor(int width, int height, Color color) override;
+    void      imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint) override;
+    Texture2D loadTextureFromImage(Image image) override;
+    Wave      loadWave(std::string fileName) override;
+    void      unloadWave(Wave wave) override;
+    Sound     loadSoundFromWave(Wave wave) override;
+    Image     loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Wave      loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Font      loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount) override;
+    Music     loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize) override;
+
+    RenderTexture2D loadRenderTexture(int width, int height) override;
+    void            unloadRenderTexture(RenderTexture2D target) override;
+    void            beginTextureMode(RenderTexture2D target) override;
+    void            endTextureMode(void) override;
+    void            beginScissorMode(int x, int y, int width, int height) override;
+    void            endScissorMode(void) override;
+    void            drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint) override;
+
+    Sound loadSoundAlias(Sound source) override;
+    void  unloadSoundAlias(Sound alias) override;
+    void  setSoundVolume(Sound sound, float volume) override;
+
+private:
+    typedef enum COMMAND_e : uint8_t
+    {
+        INIT_DEVICE = 0,
+        CLOSE_DEVICE,
+        PLAY_SOUND,
+        SET_VOLUME,
+        UNLOAD_SOUND,
+        UNLOAD_ALIAS,
+        PLAY_MUSIC,
+        UNLOAD_MUSIC
+    } COMMAND_t;
+
+    typedef struct Command_s
+    {
+        COMMAND_t m_type;
+        Sound     m_sound;  // PLAY_SOUND, SET_VOLUME, UNLOAD_SOUND and UNLOAD_ALIAS
+        Music     m_music;  // PLAY_MUSIC and UNLOAD_MUSIC
+        float     m_volume; // SET_VOLUME
+    } Command_t;
+
+    uint64_t push(const Command_t& command);
+    void     wait(uint64_t command);
+    void     audioLoop(void);
+    void     drain(void);
+    void     execute(const Command_t& command);
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
+    std::shared_ptr<RaylibInterface> m_audioPtr  = nullptr;
+    THREADING_t                      m_threading = CALLING_THREAD;
+
+    // commands are numbered from 1 in the order they are pushed, the calling
+    // thread writes m_pushed and the audio thread m_executed
+    std::array<Command_t, QUEUE_CAPACITY> m_commands;
+    alignas(64) std::atomic<uint64_t>     m_pushed   = 0;
+    alignas(64) std::atomic<uint64_t>     m_executed = 0;
+    std::atomic<bool>                     m_stopping = false;
+    std::thread                           m_audioThread;
+
+    // audio thread, the music refilled
+    std::vector<Music> m_playing;
+};
+
+#endif // AUDIOQUEUE_H
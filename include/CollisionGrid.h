@@ -0,0 +1,51 @@
+#ifndef COLLISIONGRID_H
+#define COLLISIONGRID_H
+
+#include <cstdint>
+#include <vector>
+#include "RaylibInterface.h"
+
+class SpriteStore;
+
+// Uniform grid broadphase over the playfield.
+// build() bins the synced bounds of every sprite of a store into the cells they
+// overlap; query() returns, in ascending order and without duplicates, the
+// indices of the sprites sharing a cell with the given area. Bounds outside the
+// playfield are clamped to the border cells, so the candidates are always a
+// superset of the sprites actually colliding with the area.
+class CollisionGrid
+{
+public:
+    CollisionGrid(float width, float height, float cellSize);
+    ~CollisionGrid(void) = default;
+
+    void build(const SpriteStore& store);
+    void query(Rectangle area, std::vector<uint32_t>& candidates);
+
+private:
+    typedef struct CellRange_s
+    {
+        uint32_t m_firstColumn;
+        uint32_t m_lastColumn;
+        uint32_t m_firstRow;
+        uint32_t m_lastRow;
+    } CellRange_t;
+
+    CellRange_t cellRange(Rectangle area) const;
+
+    float    m_cellSize = 0;
+    uint32_t m_columns  = 0;
+    uint32_t m_rows     = 0;
+
+    // cell contents in compressed rows: the indices binned into cell c are
+    // m_entries[m_cellStart[c]] .. m_entries[m_cellStart[c + 1] - 1]
+    std::vector<uint32_t>    m_cellStart;
+    std::vector<uint32_t>    m_entries;
+    std::vector<CellRange_t> m_ranges;
+
+    // per-sprite stamp of the last query that reported it, to drop duplicates
+    std::vector<uint32_t> m_stamps;
+    uint32_t              m_queryStamp = 0;
+};
+
+#endif // COLLISIONGRID_H
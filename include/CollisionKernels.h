@@ -0,0 +1,63 @@
+#ifndef COLLISIONKERNELS_H
+#define COLLISIONKERNELS_H
+
+#include <cstdint>
+#include <vector>
+#include "RaylibInterface.h"
+
+// Batched narrow-phase tests over packed collision arrays.
+// Every kernel tests one shape against the candidates of a batch, several lanes
+// at a time with the widest of AVX-512, AVX2 or SSE2 the compiler targets, and
+// fills hits with the batch index of each hit in candidate order. For finite
+// inputs the results are those of raylib's CheckCollisionCircles and
+// CheckCollisionCircleRec.
+class CollisionKernels
+{
+public:
+    typedef enum KERNEL_e
+    {
+        SCALAR = 0,
+        SIMD
+    } KERNEL_t;
+
+    typedef struct CircleBatch_s
+    {
+        const float* m_centerX = nullptr;
+        const float* m_centerY = nullptr;
+        const float* m_radius  = nullptr;
+        uint32_t     m_count   = 0;
+    } CircleBatch_t;
+
+    typedef struct RectBatch_s
+    {
+        const float* m_x      = nullptr;
+        const float* m_y      = nullptr;
+        const float* m_width  = nullptr;
+        const float* m_height = nullptr;
+        uint32_t     m_count  = 0;
+    } RectBatch_t;
+
+    CollisionKernels(KERNEL_t kernel);
+    ~CollisionKernels(void) = default;
+
+    uint32_t lanes(void) const;
+    void     circlesVsRect(const CircleBatch_t&         circles,
+                           const std::vector<uint32_t>& candidates,
+                           Rectangle                    rect,
+                           std::vector<uint32_t>&       hits) const;
+    void     circlesVsCircle(const CircleBatch_t&         circles,
+                             const std::vector<uint32_t>& candidates,
+                             Vector2                      center,
+                             float                        radius,
+                             std::vector<uint32_t>&       hits) const;
+    void     rectsVsCircle(const RectBatch_t&           rects,
+                           const std::vector<uint32_t>& candidates,
+                           Vector2                      center,
+                           float                        radius,
+                           std::vector<uint32_t>&       hits) const;
+
+private:
+    KERNEL_t m_kernel = SIMD;
+};
+
+#endif // COLLISIONKERNELS_H
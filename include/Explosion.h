@@ -17,7 +17,9 @@ public:
     Vector2   getCenter(void) override;
     float     getRadius(void) override;
     Rectangle getRect(void) override;
-    void      setTextures(std::vector<Texture2D> textures) override;
+    void      setTextures(TextureAtlas::Frames_t textures) override;
+    Body_t    getBody(void) override;
+    void      reset(Sprite::SpriteAttr_t attr) override;
 
 private:
     uint32_t m_index = 0;
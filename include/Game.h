@@ -1,44 +1,129 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include <array>
 #include <filesystem>
 #include <functional>
 #include <memory>
-#include <unordered_map>
+#include <utility>
 #include <vector>
+#include "AssetLoader.h"
+#include "CollisionGrid.h"
+#include "CollisionKernels.h"
 #include "GameSettings.h"
 #include "RaylibInterface.h"
 #include "Sprite.h"
+#include "SpriteFactory.h"
+#include "SpriteStore.h"
+#include "TextureAtlas.h"
+#include "TimerWheel.h"
+#include "UiLayer.h"
+#include "VoicePool.h"
 
 class PlayerInterface;
-class SpriteFactory;
-class Timer;
 
 class Game
 {
 public:
     typedef enum STATE_e
     {
-        WELCOME = 0,
+        LOADING = 0,
+        WELCOME,
         PLAYING,
         SETTINGS,
         GAME_OVER,
         EXIT_GAME
     } STATE_t;
 
-    Game(std::shared_ptr<RaylibInterface> raylibPtr, std::shared_ptr<SpriteFactory> factoryPtr);
+    typedef enum BROADPHASE_e
+    {
+        BRUTE_FORCE = 0,
+        UNIFORM_GRID
+    } BROADPHASE_t;
+
+    typedef enum NARROWPHASE_e
+    {
+        RAYLIB_CALLS = 0,
+        BATCHED_KERNELS
+    } NARROWPHASE_t;
+
+    typedef enum TIMESTEP_e
+    {
+        VARIABLE_STEP = 0,
+        FIXED_STEP
+    } TIMESTEP_t;
+
+    typedef enum LIVES_e
+    {
+        LIMITED_LIVES = 0,
+        UNLIMITED_LIVES
+    } LIVES_t;
+
+    typedef enum MENUS_e
+    {
+        IMMEDIATE_MENUS = 0,
+        RETAINED_MENUS
+    } MENUS_t;
+
+    typedef enum SOUNDS_e
+    {
+        DIRECT_SOUNDS = 0,
+        POOLED_VOICES
+    } SOUNDS_t;
+
+    // sprites alive in each store
+    typedef struct LiveCounts_s
+    {
+        uint32_t m_playerLasers   = 0;
+        uint32_t m_meteors        = 0;
+        uint32_t m_explosions     = 0;
+        uint32_t m_opponents      = 0;
+        uint32_t m_opponentLasers = 0;
+        uint32_t m_dispersions    = 0;
+    } LiveCounts_t;
+
+    // work of the playing page, accumulated from the start or the last resetStats()
+    typedef struct Stats_s
+    {
+        uint64_t m_ticks        = 0;
+        uint64_t m_frames       = 0;
+        uint64_t m_tickSprites  = 0; // sprites stepped, summed over the ticks
+        uint64_t m_frameSprites = 0; // sprites drawn, summed over the frames
+        uint64_t m_peakSprites  = 0;
+        uint64_t m_updateNs     = 0;
+        uint64_t m_collisionNs  = 0;
+        uint64_t m_recordNs     = 0; // draw calls, up to endDrawing()
+        uint64_t m_submitNs     = 0; // endDrawing()
+        uint64_t m_culled       = 0; // sprites discarded for leaving the playfield
+
+        LiveCounts_t m_live; // as of the last frame drawn
+    } Stats_t;
+
+    Game(std::shared_ptr<RaylibInterface> raylibPtr,
+         std::shared_ptr<SpriteFactory>   factoryPtr,
+         std::shared_ptr<TimerWheel>      timersPtr,
+         std::shared_ptr<AssetLoader>     loaderPtr);
     ~Game(void);
 
-    void run(void);
-    void setPlayer(std::shared_ptr<PlayerInterface> player);
-    void playerShootLaser(Sprite::SpriteAttr_t attr);
-    void opponentShootLaser(Sprite::SpriteAttr_t attr);
-    void createMeteor(void);
-    void createOpponent(void);
-    void createPowerupDispersion(void);
+    void    run(void);
+    void    setPlayer(std::shared_ptr<PlayerInterface> player);
+    void    playerShootLaser(Sprite::SpriteAttr_t attr);
+    void    opponentShootLaser(Sprite::SpriteAttr_t attr);
+    void    createMeteor(void);
+    void    createOpponent(void);
+    void    createPowerupDispersion(void);
+    void    setBroadphase(BROADPHASE_t broadphase);
+    void    setNarrowphase(NARROWPHASE_t narrowphase);
+    void    setTimestep(TIMESTEP_t timestep);
+    void    setTickRate(uint32_t ticksPerSecond);
+    void    setSpawnMultiplier(uint32_t multiplier);
+    void    setLives(LIVES_t lives);
+    void    setMenuRendering(MENUS_t menus);
+    void    setSoundPlayback(SOUNDS_t sounds);
+    void    setSpriteLayout(SpriteStore::LAYOUT_t layout);
+    Stats_t getStats(void) const;
+    void    resetStats(void);
 #ifdef DEBUG_
-    void setState(STATE_t state);
+    void    setState(STATE_t state);
 #endif
 
 private:
@@ -51,22 +136,59 @@ private:
         std::string m_displayText;
         STATE_t     m_nextState;
         bool        m_selectSoundPlayed;
+
+        // RETAINED_MENUS, the widget of the button in the layer of its page
+        std::shared_ptr<UiLayer> m_layer  = nullptr;
+        uint32_t                 m_widget = 0;
     } GameButton_t;
 
+    typedef struct TextureSets_s
+    {
+        TextureAtlas::Frames_t m_player;
+        TextureAtlas::Frames_t m_star;
+        TextureAtlas::Frames_t m_laser;
+        TextureAtlas::Frames_t m_meteor;
+        TextureAtlas::Frames_t m_dispersion;
+        TextureAtlas::Frames_t m_invincibility;
+        TextureAtlas::Frames_t m_explosion;
+    } TextureSets_t;
+
+    void checkedOpponentShootLaser(SpriteStore::Handle_t shooter, Sprite::SpriteAttr_t attr);
     void loadResources(void);
+    void finishLoading(void);
     void unloadResources(void);
-    void updatePlayingPage(void);
-    void drawPlayingPage(void);
-    void drawStars(void);
-    void drawSprites(void);
+    void updatePlayingPage(float tickTime);
+    void drawPlayingPage(float blend);
+    void drawStars(float blend);
+    void drawSprites(float blend);
     void discardSprites(void);
     void discardAllSprites(void);
+    void spawn(void (Game::*create)(void));
+    void createStars(void);
+    void loseLife(void);
+
+    SpriteStore::Recycler_t recycler(SpriteFactory::SpriteType type);
+    uint32_t                liveSprites(void) const;
+    LiveCounts_t            liveCounts(void) const;
+    void                    cullSprites(void);
     void checkCollisions(void);
+    void collisionCandidates(const SpriteStore& store, CollisionGrid& grid, Rectangle area);
+    void circlesHitByRect(const SpriteStore& circles, Rectangle rect);
+    void circlesHitByCircle(const SpriteStore& circles, Vector2 center, float radius);
+    void rectsHitByCircle(const SpriteStore& rects, Vector2 center, float radius);
+    void createExplosion(Vector2 position, float scale);
     void drawStats(void);
     void checkButtonUpdate(GameButton_t& button);
-    void drawButton(GameButton_t button);
+    void drawButton(const GameButton_t& button);
+    void addButton(std::shared_ptr<UiLayer> layer, GameButton_t& button);
+    void createMenuLayers(void);
+    void releaseMenuLayers(void);
+    void createVoices(void);
+    void playSound(Sound sound, uint32_t voice);
     void drawSettingsText(void);
     void gameoverReset(void);
+    void updateMusic(void);
+    void refreshLoadingPage(void);
     void refreshPlayingPage(void);
     void refreshWelcomePage(void);
     void refreshSettingsPage(void);
@@ -77,8 +199,17 @@ private:
     const std::filesystem::path      m_resourcePath = "resources";
     std::shared_ptr<RaylibInterface> m_raylibPtr    = nullptr;
     std::shared_ptr<SpriteFactory>   m_factory      = nullptr;
+    std::shared_ptr<TimerWheel>      m_timers       = nullptr;
+    std::shared_ptr<AssetLoader>     m_loader       = nullptr;
+    std::shared_ptr<TextureAtlas>    m_atlas        = nullptr;
+
+    // files being decoded by m_loader, uploaded once they are all done
+    std::vector<std::pair<std::string, std::vector<AssetLoader::Handle_t>>> m_imageHandles;
+    std::vector<AssetLoader::Handle_t>                                      m_waveHandles;
+    bool                                                                    m_resourcesReady = false;
 
-    std::unordered_map<std::string, std::vector<Texture2D>> m_texturesMap;
+    // resolved once the atlas is built, the sprites share the frames of the atlas
+    TextureSets_t m_textureSets;
 
     Font  m_fontType;
     Sound m_explosionSound;
@@ -89,6 +220,18 @@ private:
     Sound m_extralifeSound;
     Music m_backGroundMusic;
 
+    // POOLED_VOICES, the sounds above are played by m_voices once loaded
+    SOUNDS_t                   m_soundPlayback      = DIRECT_SOUNDS;
+    std::shared_ptr<VoicePool> m_voices             = nullptr;
+    uint32_t                   m_explosionVoice     = 0;
+    uint32_t                   m_laserVoice         = 0;
+    uint32_t                   m_selectVoice        = 0;
+    uint32_t                   m_dispersionVoice    = 0;
+    uint32_t                   m_invincibilityVoice = 0;
+    uint32_t                   m_extralifeVoice     = 0;
+
+    std::vector<uint8_t> m_musicBuffer;
+
     // welcome page
     Vector2      m_titlePosition;
     GameButton_t m_startButton;
@@ -106,23 +249,58 @@ private:
     Vector2      m_gameoverTextPosition;
     float        m_gameoverTextMaxHeight = 0;
 
+    // RETAINED_MENUS, the static content of the pages above
+    MENUS_t                  m_menus         = IMMEDIATE_MENUS;
+    std::shared_ptr<UiLayer> m_welcomeLayer  = nullptr;
+    std::shared_ptr<UiLayer> m_settingsLayer = nullptr;
+    std::shared_ptr<UiLayer> m_gameoverLayer = nullptr;
+
     // playing page
-    uint32_t                                             m_score           = 0;
-    uint32_t                                             m_lives           = MAX_LIVES;
-    std::shared_ptr<PlayerInterface>                     m_player          = nullptr;
-    std::shared_ptr<Timer>                               m_meteorTimer     = nullptr;
-    std::shared_ptr<Timer>                               m_rampdownTimer   = nullptr;
-    std::shared_ptr<Timer>                               m_opponentTimer   = nullptr;
-    std::shared_ptr<Timer>                               m_dispersionTimer = nullptr;
-    std::array<std::shared_ptr<Sprite>, NUMBER_OF_STARS> m_starsList;
-    std::vector<std::shared_ptr<Sprite>>                 m_playerLasersList;
-    std::vector<std::shared_ptr<Sprite>>                 m_meteorsList;
-    std::vector<std::shared_ptr<Sprite>>                 m_explosionsList;
-    std::vector<std::shared_ptr<Sprite>>                 m_opponentsList;
-    std::vector<std::shared_ptr<Sprite>>                 m_opponentLasersList;
-    std::vector<std::shared_ptr<Sprite>>                 m_dispersionsList;
-    std::vector<std::shared_ptr<Sprite>>                 m_invincibilitiesList;
-    std::vector<std::shared_ptr<Sprite>>                 m_extralifesList;
+    uint32_t                         m_score               = 0;
+    uint32_t                         m_lives               = MAX_LIVES;
+    std::string                      m_livesText; // formatted again by drawStats() when m_lives changes
+    std::string                      m_scoreText;
+    uint32_t                         m_livesTextValue      = UINT32_MAX;
+    uint32_t                         m_scoreTextValue      = UINT32_MAX;
+    std::shared_ptr<PlayerInterface> m_player              = nullptr;
+    TimerWheel::Handle_t             m_meteorTimer;
+    TimerWheel::Handle_t             m_rampdownTimer;
+    TimerWheel::Handle_t             m_opponentTimer;
+    TimerWheel::Handle_t             m_dispersionTimer;
+    SpriteStore                      m_starsList           = SpriteStore(SpriteStore::NO_SHAPE);
+    SpriteStore                      m_playerLasersList    = SpriteStore(SpriteStore::RECTANGLE);
+    SpriteStore                      m_meteorsList         = SpriteStore(SpriteStore::CIRCLE);
+    SpriteStore                      m_explosionsList      = SpriteStore(SpriteStore::NO_SHAPE);
+    SpriteStore                      m_opponentsList       = SpriteStore(SpriteStore::CIRCLE);
+    SpriteStore                      m_opponentLasersList  = SpriteStore(SpriteStore::RECTANGLE);
+    SpriteStore                      m_dispersionsList     = SpriteStore(SpriteStore::CIRCLE);
+    SpriteStore                      m_invincibilitiesList = SpriteStore(SpriteStore::CIRCLE);
+    SpriteStore                      m_extralifesList      = SpriteStore(SpriteStore::CIRCLE);
+
+    // collision broadphase, the grids are rebuilt from the synced stores every frame
+    BROADPHASE_t          m_broadphase         = UNIFORM_GRID;
+    CollisionGrid         m_meteorsGrid        = CollisionGrid(WINDOW_WIDTH, WINDOW_HEIGHT, COLLISION_CELL_SIZE);
+    CollisionGrid         m_opponentsGrid      = CollisionGrid(WINDOW_WIDTH, WINDOW_HEIGHT, COLLISION_CELL_SIZE);
+    CollisionGrid         m_opponentLasersGrid = CollisionGrid(WINDOW_WIDTH, WINDOW_HEIGHT, COLLISION_CELL_SIZE);
+    CollisionGrid         m_dispersionsGrid    = CollisionGrid(WINDOW_WIDTH, WINDOW_HEIGHT, COLLISION_CELL_SIZE);
+    std::vector<uint32_t> m_candidates;
+
+    // collision narrowphase, fills m_hits from m_candidates
+    NARROWPHASE_t         m_narrowphase = BATCHED_KERNELS;
+    CollisionKernels      m_kernels     = CollisionKernels(CollisionKernels::SIMD);
+    std::vector<uint32_t> m_hits;
+
+    // simulation timestep, in FIXED_STEP the frame time is accumulated and spent
+    // in whole ticks, and the frame is drawn between the last two ticks
+    TIMESTEP_t m_timestep    = FIXED_STEP;
+    float      m_tickTime    = (1.0f / SIMULATION_TICK_RATE);
+    float      m_accumulator = 0;
+
+    // scaling, every meteor, opponent and player laser spawn creates m_spawnMultiplier
+    // sprites, and there are NUMBER_OF_STARS times as many stars
+    uint32_t m_spawnMultiplier = 1;
+    LIVES_t  m_livesMode       = LIMITED_LIVES;
+    Stats_t  m_stats;
 };
 
 #endif // GAME_H
@@ -14,3 +14,19 @@
 #define GAME_OVER_FONTSIZE        200
 #define NUMBER_OF_STARS           50
 #define MAX_LIVES                 3
+#define SPRITE_POOL_CAPACITY      256
+#define COLLISION_CELL_SIZE       100
+#define SIMULATION_TICK_RATE      60
+#define MAX_TICKS_PER_FRAME       5
+#define ATLAS_PAGE_SIZE           2048
+#define ATLAS_PADDING             2
+#define ASSET_LOADER_THREADS      4
+#define ASSET_ARCHIVE_FILE        "resources.pak"
+#define PROFILER_TRACE_FILE       "asteroids.trace.json"
+#define PROFILER_TRACE_KEY        KEY_F9
+#define BENCH_WARMUP_FRAMES       300
+#define EXPLOSION_VOICES          4
+#define LASER_VOICES              4
+#define EFFECT_VOICES             1
+#define PLAYER_LASER_CULL_MARGIN  50
+#define ENEMY_CULL_MARGIN         300
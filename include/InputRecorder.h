@@ -0,0 +1,93 @@
+#ifndef INPUTRECORDER_H
+#define INPUTRECORDER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "RaylibInterface.h"
+#include "Replay.h"
+
+// RaylibInterface that records the input the game consumes into a replay.
+// Every call is forwarded to the wrapped interface, the results of the input
+// queries are noted on the way and written as a frame of the replay at every
+// endDrawing(): the frame time, the keys down and pressed, the mouse position
+// and the mouse buttons pressed. A key no one asked about during a frame is
+// recorded as up. stop() or closeWindow() ends the replay. RaylibHeadless
+// plays it back, see RaylibHeadless::setReplay(), answering the same queries
+// the same way frame after frame, so that the same seed plays the same session.
+class InputRecorder : public RaylibInterface
+{
+public:
+    InputRecorder(std::shared_ptr<RaylibInterface> raylibPtr, const std::string& fileName, uint64_t seed);
+    virtual ~InputRecorder(void) = default;
+
+    bool isRecording(void) const;
+    void stop(void);
+
+    double    getTime(void) override;
+    void      initWindow(int width, int height, std::string title) override;
+    void      closeWindow(void) override;
+    Texture2D loadTexture(std::string filename) override;
+    void      unloadTexture(Texture2D texture) override;
+    bool      windowShouldClose(void) override;
+    float     getFrameTime(void) override;
+    void      beginDrawing(void) override;
+    void      clearBackground(Color color) override;
+    void      endDrawing(void) override;
+    void      drawTextureV(Texture2D texture, Vector2 position, Color tint) override;
+    bool      isKeyDown(int key) override;
+    bool      isWindowReady(void) override;
+    void      drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint) override;
+    bool      isKeyPressed(int key) override;
+    bool      checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2) override;
+    bool      checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec) override;
+    void      drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+    Font      loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount) override;
+    void      drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void      unloadFont(Font font) override;
+    void      initAudioDevice(void) override;
+    void      closeAudioDevice(void) override;
+    Sound     loadSound(std::string fileName) override;
+    void      playSound(Sound sound) override;
+    void      unloadSound(Sound sound) override;
+    Music     loadMusicStream(std::string fileName) override;
+    void      unloadMusicStream(Music music) override;
+    void      updateMusicStream(Music music) override;
+    void      playMusicStream(Music music) override;
+    void      drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    Vector2   getMousePosition(void) override;
+    bool      checkCollisionPointRec(Vector2 point, Rectangle rec) override;
+    bool      isMouseButtonPressed(int button) override;
+    Vector2   measureTextEx(Font font, std::string text, float fontSize, float spacing) override;
+    Image     loadImage(std::string fileName) override;
+    void      unloadImage(Image image) override;
+    Image     genImageColor(int width, int height, Color color) override;
+    void      imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint) override;
+    Texture2D loadTextureFromImage(Image image) override;
+    Wave      loadWave(std::string fileName) override;
+    void      unloadWave(Wave wave) override;
+    Sound     loadSoundFromWave(Wave wave) override;
+    Image     loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Wave      loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Font      loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount) override;
+    Music     loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize) override;
+
+    RenderTexture2D loadRenderTexture(int width, int height) override;
+    void            unloadRenderTexture(RenderTexture2D target) override;
+    void            beginTextureMode(RenderTexture2D target) override;
+    void            endTextureMode(void) override;
+    void            beginScissorMode(int x, int y, int width, int height) override;
+    void            endScissorMode(void) override;
+    void            drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint) override;
+
+    Sound loadSoundAlias(Sound source) override;
+    void  unloadSoundAlias(Sound alias) override;
+    void  setSoundVolume(Sound sound, float volume) override;
+
+private:
+    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
+    std::shared_ptr<Replay::Writer>  m_writer    = nullptr;
+    Replay::Frame_t                  m_frame;
+};
+
+#endif // INPUTRECORDER_H
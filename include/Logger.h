@@ -1,9 +1,17 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 
 class Logger
 {
@@ -19,22 +27,85 @@ public:
         NONE
     };
 
+    // SYNCHRONOUS writes and flushes every message in log().
+    // ASYNCHRONOUS only copies the message into a lock-free ring, a background
+    // thread timestamps, formats and writes the messages in batches.
+    typedef enum MODE_e
+    {
+        SYNCHRONOUS = 0,
+        ASYNCHRONOUS
+    } MODE_t;
+
+    // what log() does when the ring is full in ASYNCHRONOUS mode
+    typedef enum OVERFLOW_e
+    {
+        DROP = 0,     // drop the message
+        BLOCK,        // wait for the background thread to make room
+        COUNT_DROPPED // drop the message, the number dropped is logged afterwards
+    } OVERFLOW_t;
+
     static Logger& getInstance(void);
 
-    void setVerbosityLevel(int level);
-    void setLogFile(const std::string& logFilePath);
-    void log(int level, const std::string& message);
+    void     setVerbosityLevel(int level);
+    void     setLogFile(const std::string& logFilePath);
+    void     setMode(MODE_t mode, OVERFLOW_t overflow = COUNT_DROPPED);
+    void     log(int level, const std::string& message);
+    void     flush(void);
+    uint64_t getDroppedCount(void) const;
 
 private:
+    static constexpr uint32_t                  QUEUE_CAPACITY = 1024;
+    static constexpr uint32_t                  MESSAGE_SIZE   = 240;
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL = std::chrono::milliseconds(10);
+
+    typedef struct Record_s
+    {
+        std::atomic<uint64_t>                 m_sequence;
+        int                                   m_level;
+        std::chrono::system_clock::time_point m_time;
+        uint32_t                              m_length;
+        char                                  m_message[MESSAGE_SIZE];
+    } Record_t;
+
     Logger(void);
     ~Logger(void);
     Logger(const Logger&)            = delete;
     Logger& operator=(const Logger&) = delete;
 
-    int           m_verbosityLevel = Logger::ALL;
-    std::string   m_logFilePath    = "";
-    std::ofstream m_logFile;
-    std::mutex    m_mutex;
+    bool        push(int level, const std::string& message);
+    void        consume(void);
+    void        drain(std::string& batch);
+    void        stopWorker(void);
+    std::string format(int level, std::chrono::system_clock::time_point time, std::string_view message);
+    void        write(const std::string& text);
+
+    std::atomic<int> m_verbosityLevel = Logger::ALL;
+    std::string      m_logFilePath    = "";
+    std::ofstream    m_logFile;
+    std::mutex       m_mutex;
+    std::time_t      m_stampTime = 0;
+    std::string      m_stamp     = "";
+
+    // ASYNCHRONOUS mode, bounded multi-producer single-consumer ring: a record is
+    // free for the producer claiming position p when its sequence is p, and ready
+    // for the consumer when its sequence is p + 1
+    std::atomic<bool>           m_asynchronous    = false;
+    OVERFLOW_t                  m_overflow        = COUNT_DROPPED;
+    std::unique_ptr<Record_t[]> m_queue           = nullptr;
+    std::atomic<uint64_t>       m_written         = 0;
+    std::atomic<uint64_t>       m_dropped         = 0;
+    uint64_t                    m_droppedReported = 0;
+    std::thread                 m_worker;
+    std::mutex                  m_workerMutex;
+    std::condition_variable     m_wakeup;
+    std::condition_variable     m_flushed;
+    bool                        m_stop           = false;
+    bool                        m_flushRequested = false;
+    std::atomic<bool>           m_ringFull       = false;
+
+    // the producers and the consumer advance their positions on separate cache lines
+    alignas(64) std::atomic<uint64_t> m_enqueuePosition = 0;
+    alignas(64) uint64_t              m_dequeuePosition = 0;
 };
 
 #endif // LOGGER_H
@@ -7,7 +7,7 @@
 class Meteor : public Sprite
 {
 public:
-    Meteor(std::shared_ptr<RaylibInterface> raylibPtr);
+    Meteor(std::shared_ptr<RaylibInterface> raylibPtr, Sprite::SpriteAttr_t attr = Sprite::SpriteAttr_t());
     ~Meteor(void) = default;
 
     void      update(void) override;
@@ -15,17 +15,20 @@ public:
     Vector2   getCenter(void) override;
     float     getRadius(void) override;
     Rectangle getRect(void) override;
-    void      setTextures(std::vector<Texture2D> textures) override;
+    void      setTextures(TextureAtlas::Frames_t textures) override;
+    Body_t    getBody(void) override;
+    void      reset(Sprite::SpriteAttr_t attr) override;
 
 private:
+    static constexpr float SPIN_SPEED = 50; // degrees per second
+
     void move(void);
 
-    Vector2   m_direction = {0, 0};
-    float     m_speed     = 0;
-    float     m_rotation  = 0;
-    float     m_radius    = 0;
-    Rectangle m_rect      = {0, 0, 0, 0};
-    Vector2   m_origin    = {0, 0};
+    Vector2 m_direction = {0, 0};
+    float   m_speed     = 0;
+    float   m_rotation  = 0;
+    float   m_radius    = 0;
+    Vector2 m_origin    = {0, 0};
 };
 
 #endif // METEOR_H
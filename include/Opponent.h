@@ -9,7 +9,8 @@ class Opponent : public Sprite
 {
 public:
     Opponent(std::shared_ptr<RaylibInterface>          raylibPtr,
-             std::function<void(Sprite::SpriteAttr_t)> shootLaser);
+             std::function<void(Sprite::SpriteAttr_t)> shootLaser,
+             Sprite::SpriteAttr_t                      attr = Sprite::SpriteAttr_t());
     ~Opponent(void) = default;
 
     void      update(void) override;
@@ -17,10 +18,15 @@ public:
     Vector2   getCenter(void) override;
     float     getRadius(void) override;
     Rectangle getRect(void) override;
-    void      setTextures(std::vector<Texture2D> textures) override;
+    void      setTextures(TextureAtlas::Frames_t textures) override;
+    Body_t    getBody(void) override;
+    void      reset(Sprite::SpriteAttr_t attr) override;
+    void      act(Vector2 position) override;
+    void      setShootLaser(std::function<void(Sprite::SpriteAttr_t)> shootLaser);
 
 private:
     void move(void);
+    void shootOnInterval(void);
 
     std::function<void(Sprite::SpriteAttr_t)> m_shootLaser;
     Vector2                                   m_direction       = {0, 0};
@@ -5,23 +5,24 @@
 #include <functional>
 #include "RaylibInterface.h"
 #include "Sprite.h"
-
-class Timer;
+#include "TimerWheel.h"
 
 class Player : public PlayerInterface
 {
 public:
     Player(std::shared_ptr<RaylibInterface>          raylibPtr,
+           std::shared_ptr<TimerWheel>               timersPtr,
            std::function<void(Sprite::SpriteAttr_t)> shootLaser);
-    ~Player(void) = default;
+    ~Player(void);
 
     void    update(void) override;
     void    draw(void) override;
     Vector2 getCenter(void) override;
     float   getRadius(void) override;
-    void    setTextures(std::vector<Texture2D> textures) override;
+    void    setTextures(TextureAtlas::Frames_t textures) override;
     void    setInvincible(void) override;
     void    setDispersedlaser(void) override;
+    void    latchInput(void) override;
 
 private:
     void input(void);
@@ -40,16 +41,19 @@ private:
         INVINCIBLE
     } STATE_t;
 
-    float   m_maxXPos   = 0.0;
-    float   m_maxYPos   = 0.0;
-    float   m_startXPos = 0.0;
-    float   m_startYPos = 0.0;
-    STATE_t m_state     = PLAYABLE;
+    float   m_maxXPos      = 0.0;
+    float   m_maxYPos      = 0.0;
+    float   m_startXPos    = 0.0;
+    float   m_startYPos    = 0.0;
+    STATE_t m_state        = PLAYABLE;
+    bool    m_inputLatched = false;
+    bool    m_shootLatched = false;
 
     std::function<void(Sprite::SpriteAttr_t)> m_shootLaser;
-    std::shared_ptr<Timer>                    m_invisibleTimer      = nullptr;
-    std::shared_ptr<Timer>                    m_warmupTimer         = nullptr;
-    std::shared_ptr<Timer>                    m_dispersedLaserTimer = nullptr;
+    std::shared_ptr<TimerWheel>               m_timers = nullptr;
+    TimerWheel::Handle_t                      m_invisibleTimer;
+    TimerWheel::Handle_t                      m_warmupTimer;
+    TimerWheel::Handle_t                      m_dispersedLaserTimer;
 };
 
 #endif // PLAYER_H
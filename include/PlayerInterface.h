@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include "RaylibInterface.h"
+#include "TextureAtlas.h"
 
 class PlayerInterface
 {
@@ -15,19 +16,64 @@ public:
     virtual void    draw(void)                                   = 0;
     virtual Vector2 getCenter(void)                              = 0;
     virtual float   getRadius(void)                              = 0;
-    virtual void    setTextures(std::vector<Texture2D> textures) = 0;
+    virtual void    setTextures(TextureAtlas::Frames_t textures) = 0;
     virtual void    setInvincible(void)                          = 0;
     virtual void    setDispersedlaser(void)                      = 0;
 
+    // Fixed timestep: sample the input of the rendered frame once, so that a key
+    // press is seen by exactly one of the ticks run for it, however many there are.
+    // Without it update() samples the input itself.
+    virtual void latchInput(void) {};
+
+    // same as Sprite::step(), Sprite::drawBlended() and Sprite::settle()
+    void step(float tickTime)
+    {
+        m_previousPosition = m_position;
+        m_tickTime         = tickTime;
+        update();
+    }
+
+    void drawBlended(float blend)
+    {
+        m_blend = blend;
+        draw();
+    }
+
+    void settle(void)
+    {
+        m_previousPosition = m_position;
+    }
+
     bool m_discard = false;
 
 protected:
-    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
-    Vector2                          m_position  = {0, 0};
-    Vector2                          m_direction = {0, 0};
-    float                            m_speed     = 0;
-    float                            m_radius    = 0;
-    std::vector<Texture2D>           m_textures;
+    float frameTime(void)
+    {
+        return (m_tickTime > 0) ? m_tickTime : m_raylibPtr->getFrameTime();
+    }
+
+    Vector2 drawPosition(void) const
+    {
+        return (Vector2(m_previousPosition.x + ((m_position.x - m_previousPosition.x) * m_blend),
+                        m_previousPosition.y + ((m_position.y - m_previousPosition.y) * m_blend)));
+    }
+
+    // draw a frame of the atlas the way raylib's DrawTextureEx draws a texture
+    void drawFrame(const TextureAtlas::Frame_t& frame, Vector2 position, float rotation, float scale, Color tint)
+    {
+        Rectangle dest = Rectangle(position.x, position.y, frame.m_source.width * scale, frame.m_source.height * scale);
+        m_raylibPtr->drawTexturePro(frame.m_texture, frame.m_source, dest, Vector2(0, 0), rotation, tint);
+    }
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr        = nullptr;
+    Vector2                          m_position         = {0, 0};
+    Vector2                          m_previousPosition = {0, 0};
+    float                            m_tickTime         = 0;
+    float                            m_blend            = 1;
+    Vector2                          m_direction        = {0, 0};
+    float                            m_speed            = 0;
+    float                            m_radius           = 0;
+    TextureAtlas::Frames_t           m_textures;
     bool                             m_invincible     = false;
     bool                             m_dispersedLaser = false;
 };
@@ -0,0 +1,15 @@
+#ifndef PROCESSSTATS_H
+#define PROCESSSTATS_H
+
+#include <cstdint>
+
+// Figures about the running process, as reported by the operating system.
+// Kept out of the headers including raylib, whose names clash with windows.h.
+class ProcessStats
+{
+public:
+    // highest resident set size, or working set on Windows, since the start
+    static uint64_t peakResidentBytes(void);
+};
+
+#endif // PROCESSSTATS_H
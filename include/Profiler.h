@@ -0,0 +1,105 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Scoped zones, compiled in with PROFILER_ (make profile=1) and to nothing
+// otherwise. A zone is named by a string literal and timed from its marker to
+// the end of the enclosing scope.
+#ifdef PROFILER_
+#define PROFILE_CONCAT_(first, second) first##second
+#define PROFILE_CONCAT(first, second)  PROFILE_CONCAT_(first, second)
+#define PROFILE_ZONE(name)             Profiler::Zone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_THREAD(name)           Profiler::getInstance().setThreadName(name)
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_THREAD(name)
+#endif
+
+// Every thread records its zones into a ring of its own, without locking, the
+// oldest zones being overwritten once the ring is full. The rings can be read
+// while the threads record, and written as Chrome trace event JSON, which
+// chrome://tracing and ui.perfetto.dev open.
+class Profiler
+{
+public:
+    static constexpr uint32_t RING_CAPACITY = 65536;
+
+    typedef struct Event_s
+    {
+        const char* m_name;
+        uint64_t    m_begin; // ns since the profiler started
+        uint64_t    m_end;
+        uint32_t    m_thread;
+    } Event_t;
+
+    class Zone
+    {
+    public:
+        Zone(const char* name)
+        {
+            m_name  = name;
+            m_begin = Profiler::getInstance().now();
+        }
+
+        ~Zone(void)
+        {
+            Profiler& profiler = Profiler::getInstance();
+            profiler.record(m_name, m_begin, profiler.now());
+        }
+
+        Zone(const Zone&)            = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        const char* m_name;
+        uint64_t    m_begin;
+    };
+
+    static Profiler& getInstance(void);
+
+    uint64_t             now(void) const;
+    void                 record(const char* name, uint64_t begin, uint64_t end);
+    void                 setThreadName(const std::string& name);
+    std::vector<Event_t> getEvents(void);
+    bool                 writeTrace(const std::string& fileName);
+
+private:
+    // written by one thread only, the fields are atomic so that a reader can
+    // copy a slot the thread is overwriting, see getEvents()
+    typedef struct Slot_s
+    {
+        std::atomic<const char*> m_name  = nullptr;
+        std::atomic<uint64_t>    m_begin = 0;
+        std::atomic<uint64_t>    m_end   = 0;
+    } Slot_t;
+
+    typedef struct Ring_s
+    {
+        std::array<Slot_t, RING_CAPACITY> m_slots;
+        std::atomic<uint64_t>             m_claimed = 0; // slots being written, or written
+        std::atomic<uint64_t>             m_written = 0; // slots written
+        uint32_t                          m_thread  = 0;
+        std::string                       m_name;
+    } Ring_t;
+
+    Profiler(void);
+    ~Profiler(void) = default;
+    Profiler(const Profiler&)            = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    Ring_t* threadRing(void);
+
+    std::chrono::steady_clock::time_point m_start;
+    std::mutex                            m_mutex;
+    std::vector<std::unique_ptr<Ring_t>>  m_rings;
+};
+
+#endif // PROFILER_H
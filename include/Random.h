@@ -0,0 +1,37 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <array>
+#include <cstdint>
+
+// Seedable xoshiro256** generator, 32 bytes of state and a handful of
+// instructions per number. The same seed always gives the same sequence, so a
+// single seed reproduces everything drawn from one generator. It is not
+// thread safe: every thread draws from its own generator, obtained with split().
+class Random
+{
+public:
+    Random(uint64_t seed);
+    ~Random(void) = default;
+
+    void     seed(uint64_t seed);
+    uint64_t getSeed(void) const;
+    uint64_t next(void);
+    Random   split(void);
+
+    // uniform in [min, max] for integers and [min, max) for floats
+    int32_t uniformInt(int32_t min, int32_t max);
+    float   uniformFloat(float min, float max);
+
+    // fill count values at once, the same values as count single calls
+    void fillInt(int32_t* values, uint32_t count, int32_t min, int32_t max);
+    void fillFloat(float* values, uint32_t count, float min, float max);
+
+private:
+    void jump(void);
+
+    std::array<uint64_t, 4> m_state;
+    uint64_t                m_seed = 0;
+};
+
+#endif // RANDOM_H
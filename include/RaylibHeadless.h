@@ -0,0 +1,150 @@
+#ifndef RAYLIBHEADLESS_H
+#define RAYLIBHEADLESS_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "RaylibInterface.h"
+#include "Replay.h"
+
+// RaylibInterface without window, GL context or audio device.
+// Time is a virtual clock advanced by a fixed frame time at every endDrawing(),
+// input is replayed from a per-frame script, resources are fake handles sized
+// from the file headers, and draw and sound calls are only counted, along with
+// the texture switches that would break raylib's draw batch. The window closes
+// itself once the frame limit is reached, if one is set. The input can also be
+// played back from a replay, which closes the window after its last frame.
+class RaylibHeadless : public RaylibInterface
+{
+public:
+    typedef struct Counters_s
+    {
+        uint64_t m_frames   = 0;
+        uint64_t m_textures = 0;
+        uint64_t m_texts    = 0;
+        uint64_t m_shapes   = 0;
+        uint64_t m_sounds   = 0;
+        uint64_t m_batches  = 0; // draws using another texture than the previous one
+    } Counters_t;
+
+    RaylibHeadless(float frameTime);
+    virtual ~RaylibHeadless(void);
+
+    void       setFrameLimit(uint64_t frameLimit);
+    void       scriptKeyDown(uint64_t firstFrame, uint64_t lastFrame, int key);
+    void       scriptKeyPressed(uint64_t frame, int key);
+    void       scriptMouse(uint64_t frame, Vector2 position, bool leftPressed);
+    void       setReplay(std::shared_ptr<Replay::Reader> replay);
+    Counters_t getCounters(void) const;
+
+    double    getTime(void) override;
+    void      initWindow(int width, int height, std::string title) override;
+    void      closeWindow(void) override;
+    Texture2D loadTexture(std::string filename) override;
+    void      unloadTexture(Texture2D texture) override;
+    bool      windowShouldClose(void) override;
+    float     getFrameTime(void) override;
+    void      beginDrawing(void) override;
+    void      clearBackground(Color color) override;
+    void      endDrawing(void) override;
+    void      drawTextureV(Texture2D texture, Vector2 position, Color tint) override;
+    bool      isKeyDown(int key) override;
+    bool      isWindowReady(void) override;
+    void      drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint) override;
+    bool      isKeyPressed(int key) override;
+    bool      checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2) override;
+    bool      checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec) override;
+    void      drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+    Font      loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount) override;
+    void      drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void      unloadFont(Font font) override;
+    void      initAudioDevice(void) override;
+    void      closeAudioDevice(void) override;
+    Sound     loadSound(std::string fileName) override;
+    void      unloadSound(Sound sound) override;
+    Music     loadMusicStream(std::string fileName) override;
+    void      unloadMusicStream(Music music) override;
+    void      updateMusicStream(Music music) override;
+    void      playSound(Sound sound) override;
+    void      playMusicStream(Music music) override;
+    void      drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    Vector2   getMousePosition(void) override;
+    bool      checkCollisionPointRec(Vector2 point, Rectangle rec) override;
+    bool      isMouseButtonPressed(int button) override;
+    Vector2   measureTextEx(Font font, std::string text, float fontSize, float spacing) override;
+    Image     loadImage(std::string fileName) override;
+    void      unloadImage(Image image) override;
+    Image     genImageColor(int width, int height, Color color) override;
+    void      imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint) override;
+    Texture2D loadTextureFromImage(Image image) override;
+    Wave      loadWave(std::string fileName) override;
+    void      unloadWave(Wave wave) override;
+    Sound     loadSoundFromWave(Wave wave) override;
+    Image     loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Wave      loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Font      loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount) override;
+    Music     loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize) override;
+
+    RenderTexture2D loadRenderTexture(int width, int height) override;
+    void            unloadRenderTexture(RenderTexture2D target) override;
+    void            beginTextureMode(RenderTexture2D target) override;
+    void            endTextureMode(void) override;
+    void            beginScissorMode(int x, int y, int width, int height) override;
+    void            endScissorMode(void) override;
+    void            drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint) override;
+
+    Sound loadSoundAlias(Sound source) override;
+    void  unloadSoundAlias(Sound alias) override;
+    void  setSoundVolume(Sound sound, float volume) override;
+
+private:
+    typedef enum EVENT_e
+    {
+        KEY_DOWN_EVENT = 0,
+        KEY_UP_EVENT,
+        KEY_PRESSED_EVENT,
+        MOUSE_MOVE_EVENT,
+        MOUSE_PRESSED_EVENT
+    } EVENT_t;
+
+    typedef struct ScriptEvent_s
+    {
+        uint64_t m_frame;
+        EVENT_t  m_type;
+        int      m_key;
+        Vector2  m_position;
+    } ScriptEvent_t;
+
+    static constexpr uint32_t MAX_KEYS          = 512;
+    static constexpr uint32_t MAX_MOUSE_BUTTONS = 7;
+
+    void     addEvent(ScriptEvent_t event);
+    void     applyScript(void);
+    void     applyReplay(void);
+    uint32_t nextId(void);
+    void     bindTexture(uint32_t textureId);
+
+    float      m_frameTime    = 0;
+    double     m_time         = 0;
+    uint64_t   m_frameLimit   = 0;
+    bool       m_windowReady  = false;
+    bool       m_textureMode  = false;
+    uint32_t   m_lastId       = 0;
+    uint32_t   m_boundTexture = UINT32_MAX;
+    Counters_t m_counters;
+
+    // played back after the script, whose input it overrides
+    std::shared_ptr<Replay::Reader> m_replay      = nullptr;
+    bool                            m_replayEnded = false;
+
+    // events sorted by frame, replayed up to the current frame
+    std::vector<ScriptEvent_t>          m_script;
+    uint32_t                            m_scriptCursor  = 0;
+    std::array<bool, MAX_KEYS>          m_keysDown      = {};
+    std::array<bool, MAX_KEYS>          m_keysPressed   = {};
+    std::array<bool, MAX_MOUSE_BUTTONS> m_mousePressed  = {};
+    Vector2                             m_mousePosition = {0, 0};
+};
+
+#endif // RAYLIBHEADLESS_H
@@ -7,42 +7,69 @@
 class RaylibInterface
 {
 public:
-    virtual ~RaylibInterface(void)                                                                                                    = default;
-    virtual double    getTime(void)                                                                                                   = 0;
-    virtual void      initWindow(int width, int height, std::string title)                                                            = 0;
-    virtual void      closeWindow(void)                                                                                               = 0;
-    virtual Texture2D loadTexture(std::string filename)                                                                               = 0;
-    virtual void      unloadTexture(Texture2D texture)                                                                                = 0;
-    virtual bool      windowShouldClose(void)                                                                                         = 0;
-    virtual float     getFrameTime(void)                                                                                              = 0;
-    virtual void      beginDrawing(void)                                                                                              = 0;
-    virtual void      clearBackground(Color color)                                                                                    = 0;
-    virtual void      endDrawing(void)                                                                                                = 0;
-    virtual void      drawTextureV(Texture2D texture, Vector2 position, Color tint)                                                   = 0;
-    virtual bool      isKeyDown(int key)                                                                                              = 0;
-    virtual bool      isWindowReady(void)                                                                                             = 0;
-    virtual void      drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)                     = 0;
-    virtual bool      isKeyPressed(int key)                                                                                           = 0;
-    virtual bool      checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)                           = 0;
-    virtual bool      checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec)                                            = 0;
-    virtual void      drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) = 0;
-    virtual Font      loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount)                             = 0;
-    virtual void      drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint)            = 0;
-    virtual void      unloadFont(Font font)                                                                                           = 0;
-    virtual void      initAudioDevice(void)                                                                                           = 0;
-    virtual void      closeAudioDevice(void)                                                                                          = 0;
-    virtual Sound     loadSound(std::string fileName)                                                                                 = 0;
-    virtual void      playSound(Sound sound)                                                                                          = 0;
-    virtual void      unloadSound(Sound sound)                                                                                        = 0;
-    virtual Music     loadMusicStream(std::string fileName)                                                                           = 0;
-    virtual void      unloadMusicStream(Music music)                                                                                  = 0;
-    virtual void      updateMusicStream(Music music)                                                                                  = 0;
-    virtual void      playMusicStream(Music music)                                                                                    = 0;
-    virtual void      drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)                                 = 0;
-    virtual Vector2   getMousePosition(void)                                                                                          = 0;
-    virtual bool      checkCollisionPointRec(Vector2 point, Rectangle rec)                                                            = 0;
-    virtual bool      isMouseButtonPressed(int button)                                                                                = 0;
-    virtual Vector2   measureTextEx(Font font, std::string text, float fontSize, float spacing)                                       = 0;
+    virtual ~RaylibInterface(void)                                                                                                                             = default;
+    virtual double    getTime(void)                                                                                                                            = 0;
+    virtual void      initWindow(int width, int height, std::string title)                                                                                     = 0;
+    virtual void      closeWindow(void)                                                                                                                        = 0;
+    virtual Texture2D loadTexture(std::string filename)                                                                                                        = 0;
+    virtual void      unloadTexture(Texture2D texture)                                                                                                         = 0;
+    virtual bool      windowShouldClose(void)                                                                                                                  = 0;
+    virtual float     getFrameTime(void)                                                                                                                       = 0;
+    virtual void      beginDrawing(void)                                                                                                                       = 0;
+    virtual void      clearBackground(Color color)                                                                                                             = 0;
+    virtual void      endDrawing(void)                                                                                                                         = 0;
+    virtual void      drawTextureV(Texture2D texture, Vector2 position, Color tint)                                                                            = 0;
+    virtual bool      isKeyDown(int key)                                                                                                                       = 0;
+    virtual bool      isWindowReady(void)                                                                                                                      = 0;
+    virtual void      drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)                                              = 0;
+    virtual bool      isKeyPressed(int key)                                                                                                                    = 0;
+    virtual bool      checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)                                                    = 0;
+    virtual bool      checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec)                                                                     = 0;
+    virtual void      drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)                          = 0;
+    virtual Font      loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount)                                                      = 0;
+    virtual void      drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint)                                     = 0;
+    virtual void      unloadFont(Font font)                                                                                                                    = 0;
+    virtual void      initAudioDevice(void)                                                                                                                    = 0;
+    virtual void      closeAudioDevice(void)                                                                                                                   = 0;
+    virtual Sound     loadSound(std::string fileName)                                                                                                          = 0;
+    virtual void      playSound(Sound sound)                                                                                                                   = 0;
+    virtual void      unloadSound(Sound sound)                                                                                                                 = 0;
+    virtual Music     loadMusicStream(std::string fileName)                                                                                                    = 0;
+    virtual void      unloadMusicStream(Music music)                                                                                                           = 0;
+    virtual void      updateMusicStream(Music music)                                                                                                           = 0;
+    virtual void      playMusicStream(Music music)                                                                                                             = 0;
+    virtual void      drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)                                                          = 0;
+    virtual Vector2   getMousePosition(void)                                                                                                                   = 0;
+    virtual bool      checkCollisionPointRec(Vector2 point, Rectangle rec)                                                                                     = 0;
+    virtual bool      isMouseButtonPressed(int button)                                                                                                         = 0;
+    virtual Vector2   measureTextEx(Font font, std::string text, float fontSize, float spacing)                                                                = 0;
+    virtual Image     loadImage(std::string fileName)                                                                                                          = 0;
+    virtual void      unloadImage(Image image)                                                                                                                 = 0;
+    virtual Image     genImageColor(int width, int height, Color color)                                                                                        = 0;
+    virtual void      imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)                                                         = 0;
+    virtual Texture2D loadTextureFromImage(Image image)                                                                                                        = 0;
+    virtual Wave      loadWave(std::string fileName)                                                                                                           = 0;
+    virtual void      unloadWave(Wave wave)                                                                                                                    = 0;
+    virtual Sound     loadSoundFromWave(Wave wave)                                                                                                             = 0;
+    virtual Image     loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)                                                   = 0;
+    virtual Wave      loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)                                                    = 0;
+    virtual Font      loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount) = 0;
+    virtual Music     loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize)                                                 = 0;
+
+    // render textures, drawn into between beginTextureMode() and endTextureMode(), and
+    // drawn with drawRenderTexture(), the scissor clips the draws to a rectangle
+    virtual RenderTexture2D loadRenderTexture(int width, int height)                                = 0;
+    virtual void            unloadRenderTexture(RenderTexture2D target)                             = 0;
+    virtual void            beginTextureMode(RenderTexture2D target)                                = 0;
+    virtual void            endTextureMode(void)                                                    = 0;
+    virtual void            beginScissorMode(int x, int y, int width, int height)                   = 0;
+    virtual void            endScissorMode(void)                                                    = 0;
+    virtual void            drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint) = 0;
+
+    // aliases share the samples of their sound, each plays on its own
+    virtual Sound loadSoundAlias(Sound source)              = 0;
+    virtual void  unloadSoundAlias(Sound alias)             = 0;
+    virtual void  setSoundVolume(Sound sound, float volume) = 0;
 };
 
 #endif // RAYLIBINTERFACE_H
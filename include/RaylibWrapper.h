@@ -2,6 +2,7 @@
 #define RAYLIBWRAPPER_H
 
 #include "RaylibInterface.h"
+#include "TextCache.h"
 
 class RaylibWrapper : public RaylibInterface
 {
@@ -44,6 +45,34 @@ public:
     bool      checkCollisionPointRec(Vector2 point, Rectangle rec) override;
     bool      isMouseButtonPressed(int button) override;
     Vector2   measureTextEx(Font font, std::string text, float fontSize, float spacing) override;
+    Image     loadImage(std::string fileName) override;
+    void      unloadImage(Image image) override;
+    Image     genImageColor(int width, int height, Color color) override;
+    void      imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint) override;
+    Texture2D loadTextureFromImage(Image image) override;
+    Wave      loadWave(std::string fileName) override;
+    void      unloadWave(Wave wave) override;
+    Sound     loadSoundFromWave(Wave wave) override;
+    Image     loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Wave      loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Font      loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount) override;
+    Music     loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize) override;
+
+    RenderTexture2D loadRenderTexture(int width, int height) override;
+    void            unloadRenderTexture(RenderTexture2D target) override;
+    void            beginTextureMode(RenderTexture2D target) override;
+    void            endTextureMode(void) override;
+    void            beginScissorMode(int x, int y, int width, int height) override;
+    void            endScissorMode(void) override;
+    void            drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint) override;
+
+    Sound loadSoundAlias(Sound source) override;
+    void  unloadSoundAlias(Sound alias) override;
+    void  setSoundVolume(Sound sound, float volume) override;
+
+private:
+    // the texts are drawn from their cached glyph quads, see drawTextEx()
+    TextCache m_textCache;
 };
 
 #endif // RAYLIBWRAPPER_H
@@ -0,0 +1,88 @@
+#ifndef RENDEREXECUTOR_H
+#define RENDEREXECUTOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RaylibInterface.h"
+
+// Submits a recorded frame of draw commands to raylib. The commands of a frame
+// are grouped in layers, a layer being a run of sprite draws or a run of text
+// and shape draws, in the order they were recorded. Within a sprite layer the
+// draws are stably sorted by texture, so that the page switches that break
+// raylib's draw batch happen at most once per texture and layer, while texts
+// and shapes keep their order. The layers themselves are never reordered. The
+// clear, and the render texture and scissor commands, are layers of their own.
+class RenderExecutor
+{
+public:
+    typedef enum COMMAND_e : uint8_t
+    {
+        CLEAR = 0,
+        TEXTURE,
+        TEXT,
+        RECTANGLE,
+        BEGIN_TARGET,
+        END_TARGET,
+        BEGIN_SCISSOR,
+        END_SCISSOR,
+        TARGET
+    } COMMAND_t;
+
+    typedef struct Command_s
+    {
+        COMMAND_t m_type;
+        uint16_t  m_font;       // TEXT, index in Frame_t::m_fonts
+        uint16_t  m_target;     // BEGIN_TARGET and TARGET, index in Frame_t::m_targets
+        uint32_t  m_layer;
+        Texture2D m_texture;    // TEXTURE
+        Rectangle m_source;     // TEXTURE
+        Rectangle m_dest;       // TEXTURE, RECTANGLE and BEGIN_SCISSOR, position of TEXT and TARGET
+        Vector2   m_origin;     // TEXTURE
+        float     m_rotation;   // TEXTURE, roundness of RECTANGLE
+        float     m_fontSize;   // TEXT
+        float     m_spacing;    // TEXT
+        int32_t   m_segments;   // RECTANGLE
+        uint32_t  m_textOffset; // TEXT, slice of Frame_t::m_text
+        uint32_t  m_textLength; // TEXT
+        Color     m_tint;       // color of everything, background of CLEAR
+    } Command_t;
+
+    typedef struct Frame_s
+    {
+        std::vector<Command_t>       m_commands;
+        std::vector<Font>            m_fonts;
+        std::vector<RenderTexture2D> m_targets;
+        std::string                  m_text;
+    } Frame_t;
+
+    typedef struct Stats_s
+    {
+        uint32_t m_commands = 0;
+        uint32_t m_batches  = 0; // draws using another texture than the previous one
+    } Stats_t;
+
+    typedef struct SortKey_s
+    {
+        uint64_t m_key;   // layer, then texture of TEXTURE
+        uint32_t m_index; // recording order
+    } SortKey_t;
+
+    RenderExecutor(std::shared_ptr<RaylibInterface> raylibPtr);
+    ~RenderExecutor(void) = default;
+
+    void    execute(Frame_t& frame);
+    Stats_t getStats(void) const;
+
+private:
+    void sort(Frame_t& frame);
+    void submit(const Frame_t& frame, const Command_t& command);
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
+    Stats_t                          m_stats;
+    std::vector<SortKey_t>           m_sortKeys;
+    std::vector<Command_t>           m_sorted;
+};
+
+#endif // RENDEREXECUTOR_H
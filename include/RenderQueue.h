@@ -0,0 +1,193 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "RaylibInterface.h"
+#include "RenderExecutor.h"
+
+// RaylibInterface that records the draws of a frame instead of making them.
+// The textures, texts, shapes, clear, and render texture and scissor changes
+// made until endDrawing() are kept as compact commands of the frame, which
+// endDrawing() hands to a RenderExecutor to be sorted and submitted to the
+// wrapped interface. Every other call is forwarded as is. The last submitted
+// frame can be inspected, which is what the headless tests assert the draw
+// output on.
+//
+// With RENDER_THREAD the wrapped interface belongs to a render thread, which
+// creates the window, and so owns the GL context, and submits frame N while
+// the calling thread records frame N+1. endDrawing() only waits for the render
+// thread to take the frame, three frame buffers rotate between recording,
+// drawing and the last drawn frame. The render thread takes a snapshot of the
+// input, the time and the window state after every frame, and handing over
+// frame N latches the snapshot of frame N-1: however the two threads are timed,
+// the frames see the input one frame late and read it the same all frame long,
+// from the thread calling endDrawing(). Calls returning a resource wait for the
+// render thread, the other calls are queued in order with the frames, the
+// frames and the per-frame audio calls as plain commands like the draws. The
+// collision checks and measureTextEx() do not touch the context and are still
+// made directly.
+// GLFW needs the window on the main thread on macOS, where this mode can not
+// be used.
+class RenderQueue : public RaylibInterface
+{
+public:
+    typedef enum THREADING_e
+    {
+        CALLING_THREAD = 0,
+        RENDER_THREAD
+    } THREADING_t;
+
+    RenderQueue(std::shared_ptr<RaylibInterface> raylibPtr);
+    virtual ~RenderQueue(void);
+
+    void                           setThreading(THREADING_t threading);
+    void                           flush(void);
+    const RenderExecutor::Frame_t& getLastFrame(void) const;
+    RenderExecutor::Stats_t        getStats(void) const;
+
+    double    getTime(void) override;
+    void      initWindow(int width, int height, std::string title) override;
+    void      closeWindow(void) override;
+    Texture2D loadTexture(std::string filename) override;
+    void      unloadTexture(Texture2D texture) override;
+    bool      windowShouldClose(void) override;
+    float     getFrameTime(void) override;
+    void      beginDrawing(void) override;
+    void      clearBackground(Color color) override;
+    void      endDrawing(void) override;
+    void      drawTextureV(Texture2D texture, Vector2 position, Color tint) override;
+    bool      isKeyDown(int key) override;
+    bool      isWindowReady(void) override;
+    void      drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint) override;
+    bool      isKeyPressed(int key) override;
+    bool      checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2) override;
+    bool      checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec) override;
+    void      drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+    Font      loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount) override;
+    void      drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void      unloadFont(Font font) override;
+    void      initAudioDevice(void) override;
+    void      closeAudioDevice(void) override;
+    Sound     loadSound(std::string fileName) override;
+    void      unloadSound(Sound sound) override;
+    Music     loadMusicStream(std::string fileName) override;
+    void      unloadMusicStream(Music music) override;
+    void      updateMusicStream(Music music) override;
+    void      playSound(Sound sound) override;
+    void      playMusicStream(Music music) override;
+    void      drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    Vector2   getMousePosition(void) override;
+    bool      checkCollisionPointRec(Vector2 point, Rectangle rec) override;
+    bool      isMouseButtonPressed(int button) override;
+    Vector2   measureTextEx(Font font, std::string text, float fontSize, float spacing) override;
+    Image     loadImage(std::string fileName) override;
+    void      unloadImage(Image image) override;
+    Image     genImageColor(int width, int height, Color color) override;
+    void      imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint) override;
+    Texture2D loadTextureFromImage(Image image) override;
+    Wave      loadWave(std::string fileName) override;
+    void      unloadWave(Wave wave) override;
+    Sound     loadSoundFromWave(Wave wave) override;
+    Image     loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Wave      loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize) override;
+    Font      loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount) override;
+    Music     loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize) override;
+
+    RenderTexture2D loadRenderTexture(int width, int height) override;
+    void            unloadRenderTexture(RenderTexture2D target) override;
+    void            beginTextureMode(RenderTexture2D target) override;
+    void            endTextureMode(void) override;
+    void            beginScissorMode(int x, int y, int width, int height) override;
+    void            endScissorMode(void) override;
+    void            drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint) override;
+
+    Sound loadSoundAlias(Sound source) override;
+    void  unloadSoundAlias(Sound alias) override;
+    void  setSoundVolume(Sound sound, float volume) override;
+
+private:
+    static constexpr uint32_t FRAME_BUFFERS     = 3;
+    static constexpr uint32_t MAX_KEYS          = 512;
+    static constexpr uint32_t MAX_MOUSE_BUTTONS = 7;
+
+    // what the calling thread sees of the window while the render thread runs
+    typedef struct WindowState_s
+    {
+        double                              m_time          = 0;
+        float                               m_frameTime     = 0;
+        bool                                m_shouldClose   = true;
+        bool                                m_windowReady   = false;
+        std::array<bool, MAX_KEYS>          m_keysDown      = {};
+        std::array<bool, MAX_KEYS>          m_keysPressed   = {};
+        std::array<bool, MAX_MOUSE_BUTTONS> m_mousePressed  = {};
+        Vector2                             m_mousePosition = {0, 0};
+        RenderExecutor::Stats_t             m_stats;
+    } WindowState_t;
+
+    typedef enum TASK_e : uint8_t
+    {
+        CALL = 0,
+        DRAW_FRAME,
+        UPDATE_MUSIC_STREAM,
+        PLAY_SOUND,
+        SET_SOUND_VOLUME
+    } TASK_t;
+
+    // a call for the render thread, only CALL goes through a std::function
+    typedef struct Task_s
+    {
+        TASK_t                    m_type;
+        uint32_t                  m_frame;  // DRAW_FRAME
+        float                     m_volume; // SET_SOUND_VOLUME
+        Sound                     m_sound;  // PLAY_SOUND and SET_SOUND_VOLUME
+        Music                     m_music;  // UPDATE_MUSIC_STREAM
+        std::function<void(void)> m_call;   // CALL
+    } Task_t;
+
+    void     record(RenderExecutor::Command_t command);
+    uint16_t targetIndex(RenderTexture2D target);
+    uint64_t post(std::function<void(void)> call);
+    uint64_t post(Task_t task);
+    void     run(std::function<void(void)> call);
+    void     renderLoop(void);
+    void     runTask(Task_t& task);
+    void     drawFrame(uint32_t frame);
+    void     pollWindow(WindowState_t& window);
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
+    std::shared_ptr<RenderExecutor>  m_executor  = nullptr;
+    THREADING_t                      m_threading = CALLING_THREAD;
+
+    // recording into m_writing, m_previous was handed over by the last endDrawing(),
+    // the render thread leaves the window state after a frame next to the frame
+    std::array<RenderExecutor::Frame_t, FRAME_BUFFERS> m_frames;
+    std::array<WindowState_t, FRAME_BUFFERS>           m_frameWindows;
+    uint32_t                                           m_writing    = 0;
+    uint32_t                                           m_previous   = FRAME_BUFFERS - 1;
+    uint32_t                                           m_lastFrame  = FRAME_BUFFERS - 1;
+    uint64_t                                           m_handedOver = 0;
+    WindowState_t                                      m_window;
+
+    // render thread, tasks are numbered from 1 in the order they are posted, the
+    // render thread takes all of m_tasks at once and runs them from m_running,
+    // the two vectors swapping so that their capacity is kept
+    std::thread             m_renderThread;
+    std::mutex              m_mutex;
+    std::condition_variable m_taskPosted;
+    std::condition_variable m_taskProgress;
+    std::vector<Task_t>     m_tasks;
+    std::vector<Task_t>     m_running;
+    uint64_t                m_posted   = 0;
+    uint64_t                m_started  = 0;
+    uint64_t                m_finished = 0;
+    bool                    m_stopping = false;
+};
+
+#endif // RENDERQUEUE_H
@@ -0,0 +1,84 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <bitset>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "RaylibInterface.h"
+
+// A recorded session: the seed of the game, then for every frame the input the
+// game consumed, as the RaylibInterface queries returned it. The file is written
+// and read as a stream, a frame at a time. A frame is a byte of change flags
+// followed by what changed since the previous frame: the frame time, the mouse
+// position, the keys that went down or up, and the keys and mouse buttons
+// pressed during the frame. A run of frames without any change is stored as a
+// zero byte and the length of the run. Counts and key codes are LEB128
+// varints, the keys of a set being stored as the differences between them, and
+// floats are stored as their bits, so that the playback gives the game the very
+// same values. Everything is little endian.
+class Replay
+{
+public:
+    static constexpr uint32_t VERSION           = 1;
+    static constexpr uint32_t MAX_KEYS          = 512;
+    static constexpr uint32_t MAX_MOUSE_BUTTONS = 7;
+
+    typedef struct Frame_s
+    {
+        float                 m_frameTime     = 0;
+        Vector2               m_mousePosition = {0, 0};
+        std::bitset<MAX_KEYS> m_keysDown;
+        std::bitset<MAX_KEYS> m_keysPressed;
+        uint8_t               m_mousePressed  = 0; // one bit per button
+    } Frame_t;
+
+    // Appends the frames to a new file, closed by close() or the destructor.
+    class Writer
+    {
+    public:
+        Writer(const std::string& fileName, uint64_t seed);
+        ~Writer(void);
+
+        Writer(const Writer&)            = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        bool     isOpen(void) const;
+        void     write(const Frame_t& frame);
+        void     close(void);
+        uint64_t getFrameCount(void) const;
+
+    private:
+        void endIdleRun(void);
+
+        std::ofstream m_file;
+        std::string   m_fileName;
+        Frame_t       m_previous;
+        uint64_t      m_idleRun = 0;
+        uint64_t      m_frames  = 0;
+    };
+
+    // Reads the frames back in order, read() is false past the last frame.
+    class Reader
+    {
+    public:
+        Reader(const std::string& fileName);
+        ~Reader(void) = default;
+
+        Reader(const Reader&)            = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        bool     isOpen(void) const;
+        uint64_t getSeed(void) const;
+        bool     read(Frame_t& frame);
+
+    private:
+        std::ifstream m_file;
+        std::string   m_fileName;
+        uint64_t      m_seed = 0;
+        Frame_t       m_previous;
+        uint64_t      m_idleRun = 0;
+    };
+};
+
+#endif // REPLAY_H
@@ -0,0 +1,192 @@
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Dense container addressed through generation-checked handles.
+// Values are stored contiguously for iteration; a handle stays valid until its
+// value is erased, after which contains() reports it as stale even if the slot
+// has been reused.
+template <typename T>
+class SlotMap
+{
+public:
+    typedef struct Handle_s
+    {
+        uint32_t m_index      = UINT32_MAX;
+        uint32_t m_generation = 0;
+
+        bool operator==(const struct Handle_s& other) const = default;
+    } Handle_t;
+
+    SlotMap(void) {};
+    ~SlotMap(void) = default;
+
+    Handle_t insert(T value)
+    {
+        Handle_t handle = nextHandle();
+
+        if (m_freeSlots.empty())
+        {
+            m_slots.push_back(Slot_t());
+        }
+        else
+        {
+            m_freeSlots.pop_back();
+        }
+
+        m_slots[handle.m_index].m_denseIndex = m_values.size();
+        m_values.push_back(std::move(value));
+        m_denseToSlot.push_back(handle.m_index);
+        return handle;
+    }
+
+    // handle that the next insert() will return
+    Handle_t nextHandle(void) const
+    {
+        Handle_t handle;
+        if (m_freeSlots.empty())
+        {
+            handle.m_index      = m_slots.size();
+            handle.m_generation = 0;
+        }
+        else
+        {
+            handle.m_index      = m_freeSlots.back();
+            handle.m_generation = m_slots[handle.m_index].m_generation;
+        }
+        return handle;
+    }
+
+    bool contains(Handle_t handle) const
+    {
+        return ((handle.m_index < m_slots.size()) &&
+                (m_slots[handle.m_index].m_generation == handle.m_generation) &&
+                (m_slots[handle.m_index].m_denseIndex != UINT32_MAX));
+    }
+
+    T& get(Handle_t handle)
+    {
+        assert(contains(handle));
+        return m_values[m_slots[handle.m_index].m_denseIndex];
+    }
+
+    // dense index of the value of handle
+    uint32_t indexOf(Handle_t handle) const
+    {
+        assert(contains(handle));
+        return m_slots[handle.m_index].m_denseIndex;
+    }
+
+    // O(1) removal, the last value is moved into the freed position
+    void erase(Handle_t handle)
+    {
+        assert(contains(handle));
+        uint32_t denseIndex = m_slots[handle.m_index].m_denseIndex;
+        uint32_t lastIndex  = m_values.size() - 1;
+
+        if (denseIndex != lastIndex)
+        {
+            m_values[denseIndex]                            = std::move(m_values[lastIndex]);
+            m_denseToSlot[denseIndex]                       = m_denseToSlot[lastIndex];
+            m_slots[m_denseToSlot[denseIndex]].m_denseIndex = denseIndex;
+        }
+        m_values.pop_back();
+        m_denseToSlot.pop_back();
+        releaseSlot(handle.m_index);
+    }
+
+    // single pass compaction that keeps the iteration order of the survivors
+    template <typename Predicate>
+    uint32_t eraseIf(Predicate predicate)
+    {
+        uint32_t writeIndex = 0;
+        for (uint32_t readIndex = 0; readIndex < m_values.size(); readIndex++)
+        {
+            if (predicate(m_values[readIndex]))
+            {
+                releaseSlot(m_denseToSlot[readIndex]);
+                continue;
+            }
+
+            if (writeIndex != readIndex)
+            {
+                m_values[writeIndex]      = std::move(m_values[readIndex]);
+                m_denseToSlot[writeIndex] = m_denseToSlot[readIndex];
+            }
+            m_slots[m_denseToSlot[writeIndex]].m_denseIndex = writeIndex;
+            writeIndex++;
+        }
+
+        uint32_t erased = m_values.size() - writeIndex;
+        m_values.resize(writeIndex);
+        m_denseToSlot.resize(writeIndex);
+        return erased;
+    }
+
+    void clear(void)
+    {
+        for (uint32_t index = 0; index < m_denseToSlot.size(); index++)
+        {
+            releaseSlot(m_denseToSlot[index]);
+        }
+        m_values.clear();
+        m_denseToSlot.clear();
+    }
+
+    uint32_t size(void) const
+    {
+        return m_values.size();
+    }
+
+    bool empty(void) const
+    {
+        return m_values.empty();
+    }
+
+    // dense access for iteration, index is in [0, size())
+    T& operator[](uint32_t denseIndex)
+    {
+        assert(denseIndex < m_values.size());
+        return m_values[denseIndex];
+    }
+
+    const T& operator[](uint32_t denseIndex) const
+    {
+        assert(denseIndex < m_values.size());
+        return m_values[denseIndex];
+    }
+
+    Handle_t handleAt(uint32_t denseIndex) const
+    {
+        assert(denseIndex < m_values.size());
+        Handle_t handle;
+        handle.m_index      = m_denseToSlot[denseIndex];
+        handle.m_generation = m_slots[handle.m_index].m_generation;
+        return handle;
+    }
+
+private:
+    typedef struct Slot_s
+    {
+        uint32_t m_denseIndex = UINT32_MAX;
+        uint32_t m_generation = 0;
+    } Slot_t;
+
+    void releaseSlot(uint32_t slotIndex)
+    {
+        m_slots[slotIndex].m_denseIndex = UINT32_MAX;
+        m_slots[slotIndex].m_generation++;
+        m_freeSlots.push_back(slotIndex);
+    }
+
+    std::vector<T>        m_values;
+    std::vector<uint32_t> m_denseToSlot;
+    std::vector<Slot_t>   m_slots;
+    std::vector<uint32_t> m_freeSlots;
+};
+
+#endif // SLOTMAP_H
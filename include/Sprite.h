@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include "RaylibInterface.h"
+#include "TextureAtlas.h"
 
 class Sprite
 {
@@ -14,9 +15,31 @@ public:
         Vector2 m_direction = {0, 0};
         float   m_scale     = 0.0;
         float   m_rotation  = 0.0;
+        float   m_speed     = 0.0;
         Color   m_color     = WHITE;
     } SpriteAttr_t;
 
+    // What a SpriteStore of packed arrays copies out of the sprite when it is
+    // added: the store then moves, animates and draws it from its own arrays.
+    typedef struct Body_s
+    {
+        TextureAtlas::Frames_t m_frames;
+        Vector2                m_position   = {0, 0};
+        Vector2                m_direction  = {0, 0};
+        float                  m_speed      = 0;
+        float                  m_rotation   = 0;
+        float                  m_spin       = 0;      // degrees per second
+        float                  m_scale      = 1;
+        Vector2                m_origin     = {0, 0};
+        Color                  m_tint       = WHITE;
+        Vector2                m_offset     = {0, 0}; // circle center or rectangle corner, from the position
+        float                  m_radius     = 0;
+        Vector2                m_size       = {0, 0}; // of the rectangle
+        float                  m_frameRate  = 0;      // frames per second, discarded past the last frame
+        float                  m_wrapHeight = 0;      // back to the top past it, 0 never wraps
+        bool                   m_acts       = false;  // act() after every step
+    } Body_t;
+
     Sprite(void) {};
     virtual ~Sprite(void) {};
 
@@ -25,14 +48,67 @@ public:
     virtual Vector2   getCenter(void)                              = 0;
     virtual float     getRadius(void)                              = 0;
     virtual Rectangle getRect(void)                                = 0;
-    virtual void      setTextures(std::vector<Texture2D> textures) = 0;
+    virtual void      setTextures(TextureAtlas::Frames_t textures) = 0;
+    virtual Body_t    getBody(void)                                = 0;
+
+    // called by a store of packed arrays, with the position it moved the sprite to
+    virtual void act(Vector2 position)
+    {
+        (void)position;
+    }
+
+    // reinitialise a recycled sprite as if it had just been constructed with attr
+    virtual void reset(SpriteAttr_t attr) = 0;
+
+    // Fixed timestep: step() keeps the current position and runs update() over
+    // tickTime seconds, 0 meaning raylib's frame time. drawBlended() draws at
+    // blend between the kept and the current position, settle() drops the kept
+    // position, e.g. after a spawn or a teleport.
+    void step(float tickTime)
+    {
+        m_previousPosition = m_position;
+        m_tickTime         = tickTime;
+        update();
+    }
+
+    void drawBlended(float blend)
+    {
+        m_blend = blend;
+        draw();
+    }
+
+    void settle(void)
+    {
+        m_previousPosition = m_position;
+    }
 
     bool m_discard = false;
 
 protected:
-    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
-    Vector2                          m_position  = {0, 0};
-    std::vector<Texture2D>           m_textures;
+    float frameTime(void)
+    {
+        return (m_tickTime > 0) ? m_tickTime : m_raylibPtr->getFrameTime();
+    }
+
+    Vector2 drawPosition(void) const
+    {
+        return (Vector2(m_previousPosition.x + ((m_position.x - m_previousPosition.x) * m_blend),
+                        m_previousPosition.y + ((m_position.y - m_previousPosition.y) * m_blend)));
+    }
+
+    // draw a frame of the atlas the way raylib's DrawTextureEx draws a texture
+    void drawFrame(const TextureAtlas::Frame_t& frame, Vector2 position, float rotation, float scale, Color tint)
+    {
+        Rectangle dest = Rectangle(position.x, position.y, frame.m_source.width * scale, frame.m_source.height * scale);
+        m_raylibPtr->drawTexturePro(frame.m_texture, frame.m_source, dest, Vector2(0, 0), rotation, tint);
+    }
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr        = nullptr;
+    Vector2                          m_position         = {0, 0};
+    Vector2                          m_previousPosition = {0, 0};
+    float                            m_tickTime         = 0;
+    float                            m_blend            = 1;
+    TextureAtlas::Frames_t           m_textures;
 };
 
 #endif // SPRITE_H
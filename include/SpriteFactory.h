@@ -1,8 +1,12 @@
 #ifndef SPRITEFACTORY_H
 #define SPRITEFACTORY_H
 
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
+#include "Random.h"
 #include "RaylibInterface.h"
 #include "Sprite.h"
 
@@ -21,13 +25,51 @@ public:
         UNDEFINED
     };
 
-    SpriteFactory(void);
+    typedef struct PoolStats_s
+    {
+        uint32_t m_capacity      = 0; // idle sprites kept for reuse, grows with m_highWaterMark unless set
+        uint32_t m_idle          = 0;
+        uint32_t m_live          = 0; // handed out and not recycled yet
+        uint32_t m_highWaterMark = 0; // peak of m_live
+        uint64_t m_allocations   = 0;
+        uint64_t m_reuses        = 0;
+    } PoolStats_t;
+
+    SpriteFactory(std::shared_ptr<Random> randomPtr);
     ~SpriteFactory(void);
 
     virtual std::shared_ptr<Sprite> getSprite(SpriteType                                type,
                                               std::shared_ptr<RaylibInterface>          raylibPtr,
                                               Sprite::SpriteAttr_t                      attr,
                                               std::function<void(Sprite::SpriteAttr_t)> shootLaser = nullptr);
+    virtual void                    recycleSprite(SpriteType type, std::shared_ptr<Sprite> sprite);
+    void                            setPoolCapacity(SpriteType type, uint32_t capacity);
+    PoolStats_t                     getPoolStats(SpriteType type) const;
+    void                            fillSpawnAttributes(SpriteType type, Sprite::SpriteAttr_t* attrs, uint32_t count);
+
+private:
+    // spawn attributes are drawn SPAWN_BATCH at a time for each type
+    static constexpr uint32_t SPAWN_BATCH = 64;
+
+    typedef struct Pool_s
+    {
+        std::vector<std::shared_ptr<Sprite>> m_idle;
+        PoolStats_t                          m_stats;
+        std::vector<Sprite::SpriteAttr_t>    m_spawns;
+        bool                                 m_capped = false; // by setPoolCapacity()
+    } Pool_t;
+
+    std::shared_ptr<Sprite> makeSprite(SpriteType                                type,
+                                       std::shared_ptr<RaylibInterface>          raylibPtr,
+                                       Sprite::SpriteAttr_t                      attr,
+                                       std::function<void(Sprite::SpriteAttr_t)> shootLaser);
+
+    Sprite::SpriteAttr_t nextSpawnAttributes(SpriteType type);
+
+    std::shared_ptr<Random>       m_random = nullptr;
+    std::array<Pool_t, UNDEFINED> m_pools;
+    std::vector<int32_t>          m_intValues;
+    std::vector<float>            m_floatValues;
 };
 
 #endif // SPRITEFACTORY_H
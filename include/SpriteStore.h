@@ -0,0 +1,126 @@
+#ifndef SPRITESTORE_H
+#define SPRITESTORE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "CollisionKernels.h"
+#include "RaylibInterface.h"
+#include "SlotMap.h"
+#include "Sprite.h"
+
+// The sprites of a kind, in insertion order. With SPRITE_OBJECTS every sprite
+// moves and draws itself. With PACKED_ARRAYS the store copies the body of a
+// sprite when it is added and moves, animates, draws and collides it from one
+// array per field, the sprite object only being called to act().
+class SpriteStore
+{
+public:
+    typedef enum SHAPE_e
+    {
+        NO_SHAPE = 0,
+        CIRCLE,
+        RECTANGLE
+    } SHAPE_t;
+
+    typedef enum LAYOUT_e
+    {
+        SPRITE_OBJECTS = 0,
+        PACKED_ARRAYS
+    } LAYOUT_t;
+
+    typedef SlotMap<std::shared_ptr<Sprite>>::Handle_t Handle_t;
+    typedef std::function<void(std::shared_ptr<Sprite>)> Recycler_t;
+
+    SpriteStore(SHAPE_t shape);
+    ~SpriteStore(void) = default;
+
+    void                    setLayout(LAYOUT_t layout, std::shared_ptr<RaylibInterface> raylibPtr = nullptr);
+    Handle_t                add(std::shared_ptr<Sprite> sprite);
+    Handle_t                nextHandle(void) const;
+    bool                    contains(Handle_t handle) const;
+    void                    remove(Handle_t handle);
+    void                    update(void);
+    void                    draw(void);
+    void                    step(float tickTime);
+    void                    drawBlended(float blend);
+    void                    sync(void);
+    void                    discard(uint32_t index);
+    uint32_t                cull(Rectangle bounds);
+    void                    discardMarked(Recycler_t recycler = nullptr);
+    void                    clear(Recycler_t recycler = nullptr);
+    uint32_t                size(void) const;
+    bool                    isDiscarded(uint32_t index) const;
+    bool                    isCulled(uint32_t index) const;
+    Vector2                 getCenter(uint32_t index) const;
+    float                   getRadius(uint32_t index) const;
+    Rectangle               getRect(uint32_t index) const;
+    Rectangle               getBounds(uint32_t index) const;
+
+    CollisionKernels::CircleBatch_t circleBatch(void) const;
+    CollisionKernels::RectBatch_t   rectBatch(void) const;
+
+    std::shared_ptr<Sprite> getSprite(uint32_t index) const;
+    Handle_t                getHandle(uint32_t index) const;
+
+private:
+    enum
+    {
+        FLAG_DISCARD = (1 << 0),
+        FLAG_CULLED  = (1 << 1) // discarded by cull(), out of the collisions too
+    };
+
+    // the fields of a packed sprite that are read when it is drawn
+    typedef struct Look_s
+    {
+        TextureAtlas::Frames_t m_frames;
+        uint32_t               m_frame      = 0;
+        float                  m_frameRate  = 0;
+        float                  m_scale      = 1;
+        Vector2                m_origin     = {0, 0};
+        Color                  m_tint       = WHITE;
+        float                  m_wrapHeight = 0;
+        bool                   m_acts       = false;
+    } Look_t;
+
+    void stepPacked(float tickTime);
+    void drawPacked(float blend);
+    void syncPacked(void);
+    void pushBody(const Sprite::Body_t& body);
+    void moveBody(uint32_t to, uint32_t from);
+    void resizeBodies(uint32_t count);
+
+    SHAPE_t                          m_shape     = NO_SHAPE;
+    LAYOUT_t                         m_layout    = SPRITE_OBJECTS;
+    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
+    SlotMap<std::shared_ptr<Sprite>> m_sprites;
+
+    // the packed sprites, in the order of m_sprites
+    std::vector<float>  m_positionX;
+    std::vector<float>  m_positionY;
+    std::vector<float>  m_previousX;
+    std::vector<float>  m_previousY;
+    std::vector<float>  m_directionX;
+    std::vector<float>  m_directionY;
+    std::vector<float>  m_speed;
+    std::vector<float>  m_rotation;
+    std::vector<float>  m_spin;
+    std::vector<float>  m_offsetX;
+    std::vector<float>  m_offsetY;
+    std::vector<Look_t> m_looks;
+
+    // collision snapshot, one contiguous array per field, refreshed by sync();
+    // packed sprites keep their radius, rectangle size and flags there all along
+    uint32_t             m_syncedCount = 0;
+    std::vector<float>   m_centerX;
+    std::vector<float>   m_centerY;
+    std::vector<float>   m_radius;
+    std::vector<float>   m_rectX;
+    std::vector<float>   m_rectY;
+    std::vector<float>   m_rectWidth;
+    std::vector<float>   m_rectHeight;
+    std::vector<uint8_t> m_flags;
+};
+
+#endif // SPRITESTORE_H
@@ -7,7 +7,7 @@
 class Star : public Sprite
 {
 public:
-    Star(std::shared_ptr<RaylibInterface> raylibPtr);
+    Star(std::shared_ptr<RaylibInterface> raylibPtr, Sprite::SpriteAttr_t attr = Sprite::SpriteAttr_t());
     ~Star(void) = default;
 
     void      update(void) override;
@@ -15,7 +15,9 @@ public:
     Vector2   getCenter(void) override;
     float     getRadius(void) override;
     Rectangle getRect(void) override;
-    void      setTextures(std::vector<Texture2D> textures) override;
+    void      setTextures(TextureAtlas::Frames_t textures) override;
+    Body_t    getBody(void) override;
+    void      reset(Sprite::SpriteAttr_t attr) override;
 
 private:
     float m_scale = 0;
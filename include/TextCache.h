@@ -0,0 +1,85 @@
+#ifndef TEXTCACHE_H
+#define TEXTCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "RaylibInterface.h"
+
+// The glyph quads of the texts drawn, laid out the way raylib's DrawTextEx lays
+// them out, keyed by font, text, size and spacing. A text drawn frame after
+// frame is laid out once, and a text not drawn during a frame is dropped at the
+// end of it, e.g. a score that changed. The quads are relative to the position
+// the text is drawn at, so that moving a text keeps its layout.
+class TextCache
+{
+public:
+    static constexpr float LINE_SPACING = 2; // raylib's default, see SetTextLineSpacing()
+
+    typedef struct Quad_s
+    {
+        Rectangle m_source; // in the font texture
+        Rectangle m_dest;   // from the text position
+    } Quad_t;
+
+    TextCache(void)  = default;
+    ~TextCache(void) = default;
+
+    const std::vector<Quad_t>& getQuads(const Font& font, std::string_view text, float fontSize, float spacing);
+    void                       endFrame(void);
+    void                       clear(void);
+    uint32_t                   size(void) const;
+    uint64_t                   getLayoutCount(void) const;
+
+private:
+    typedef struct KeyView_s
+    {
+        uint32_t         m_texture;
+        float            m_fontSize;
+        float            m_spacing;
+        std::string_view m_text;
+    } KeyView_t;
+
+    typedef struct Key_s
+    {
+        uint32_t    m_texture;
+        float       m_fontSize;
+        float       m_spacing;
+        std::string m_text;
+
+        operator KeyView_t(void) const
+        {
+            return KeyView_t(m_texture, m_fontSize, m_spacing, m_text);
+        }
+    } Key_t;
+
+    // lookups with a KeyView_t, so that finding a text does not copy it
+    typedef struct Hash_s
+    {
+        typedef void is_transparent;
+        size_t       operator()(const KeyView_t& key) const;
+    } Hash_t;
+
+    typedef struct Equal_s
+    {
+        typedef void is_transparent;
+        bool         operator()(const KeyView_t& first, const KeyView_t& second) const;
+    } Equal_t;
+
+    typedef struct Entry_s
+    {
+        std::vector<Quad_t> m_quads;
+        bool                m_drawn = true; // since the last endFrame()
+    } Entry_t;
+
+    static void    layout(const Font& font, std::string_view text, float fontSize, float spacing, std::vector<Quad_t>& quads);
+    static int32_t glyphIndex(const Font& font, int32_t codepoint);
+    static int32_t nextCodepoint(std::string_view text, uint32_t& size);
+
+    std::unordered_map<Key_t, Entry_t, Hash_t, Equal_t> m_entries;
+    uint64_t                                            m_layouts = 0;
+};
+
+#endif // TEXTCACHE_H
@@ -0,0 +1,69 @@
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "RaylibInterface.h"
+
+// Packs the images of the game into as few texture pages as possible when it
+// loads, so that the sprites drawn in a frame share one texture and raylib can
+// batch them. A sprite only gets the page and its source rectangle in it.
+// The frames of a name are resolved once into a Frames_t, a view of storage
+// owned by the atlas, which stays valid until unload().
+class TextureAtlas
+{
+public:
+    typedef struct Frame_s
+    {
+        Texture2D m_texture = {0, 0, 0, 0, 0};
+        Rectangle m_source  = {0, 0, 0, 0};
+    } Frame_t;
+
+    typedef std::span<const Frame_t> Frames_t;
+
+    TextureAtlas(std::shared_ptr<RaylibInterface> raylibPtr, int pageSize, int padding);
+    ~TextureAtlas(void) = default;
+
+    void     add(const std::string& name, const std::vector<std::string>& fileNames);
+    void     add(const std::string& name, const std::vector<Image>& images);
+    void     build(void);
+    void     unload(void);
+    Frames_t getFrames(const std::string& name) const;
+    uint32_t getPageCount(void) const;
+
+private:
+    typedef struct Entry_s
+    {
+        std::string m_name;
+        uint32_t    m_frame;
+        std::string m_fileName;
+        Image       m_image;
+        uint32_t    m_page;
+        Rectangle   m_place;
+    } Entry_t;
+
+    typedef struct Page_s
+    {
+        int m_width       = 0;
+        int m_height      = 0;
+        int m_shelfX      = 0;
+        int m_shelfY      = 0;
+        int m_shelfHeight = 0;
+    } Page_t;
+
+    void pack(void);
+
+    std::shared_ptr<RaylibInterface>                      m_raylibPtr = nullptr;
+    int                                                   m_pageSize  = 0;
+    int                                                   m_padding   = 0;
+    std::vector<Entry_t>                                  m_entries;
+    std::vector<Page_t>                                   m_pages;
+    std::vector<Texture2D>                                m_textures;
+    std::unordered_map<std::string, std::vector<Frame_t>> m_frames;
+};
+
+#endif // TEXTUREATLAS_H
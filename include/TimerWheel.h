@@ -0,0 +1,80 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "SlotMap.h"
+
+// Central timer service, a hierarchical timing wheel of LEVELS levels of SLOTS
+// slots each, with a resolution of one millisecond of simulated time.
+// Activating and deactivating a timer is O(1), and advancing the wheel costs
+// one slot per elapsed millisecond, whatever the number of active timers.
+// Timers expiring in the same millisecond fire in the order they were activated.
+// Time only moves through advance(), so timers follow the simulation and not
+// the wall clock.
+class TimerWheel
+{
+private:
+    static constexpr uint32_t LEVELS    = 4;
+    static constexpr uint32_t SLOT_BITS = 6;
+    static constexpr uint32_t SLOTS     = (1 << SLOT_BITS);
+    static constexpr uint8_t  UNLINKED  = UINT8_MAX;
+
+    struct Timer_s;
+    typedef struct Timer_s Timer_t;
+
+public:
+    typedef SlotMap<Timer_t>::Handle_t Handle_t;
+
+    TimerWheel(void);
+    ~TimerWheel(void) = default;
+
+    Handle_t add(double duration, bool repeat, bool autostart, std::function<void(void)> callBack);
+    void     remove(Handle_t handle);
+    bool     contains(Handle_t handle) const;
+    void     activate(Handle_t handle);
+    void     deactivate(Handle_t handle);
+    bool     isActive(Handle_t handle);
+    void     advance(double seconds);
+    double   getTime(void) const;
+    uint32_t size(void) const;
+
+private:
+    struct Timer_s
+    {
+        std::function<void(void)> m_callBack;
+        uint64_t                  m_duration = 0;
+        uint64_t                  m_expiry   = 0;
+        uint64_t                  m_sequence = 0;
+        bool                      m_repeat   = false;
+        bool                      m_active   = false;
+        uint8_t                   m_level    = UNLINKED;
+        uint8_t                   m_slot     = 0;
+        Handle_t                  m_previous;
+        Handle_t                  m_next;
+    };
+
+    typedef struct List_s
+    {
+        Handle_t m_head;
+        Handle_t m_tail;
+    } List_t;
+
+    void schedule(Handle_t handle, uint64_t expiry);
+    void link(Handle_t handle);
+    void unlink(Handle_t handle);
+    void cascade(uint32_t level);
+    void tick(void);
+
+    SlotMap<Timer_t>                              m_timers;
+    std::array<std::array<List_t, SLOTS>, LEVELS> m_wheel;
+    std::vector<Handle_t>                         m_expired;
+    uint64_t                                      m_now      = 0;
+    uint64_t                                      m_sequence = 0;
+    uint32_t                                      m_linked   = 0;
+    double                                        m_time     = 0;
+};
+
+#endif // TIMERWHEEL_H
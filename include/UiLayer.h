@@ -0,0 +1,49 @@
+#ifndef UILAYER_H
+#define UILAYER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "RaylibInterface.h"
+
+// The static content of a page, kept in a render texture the size of the page
+// and drawn as a single quad. The page is made of widgets, each drawn by a
+// function into an area of the page. update() draws the whole page the first
+// time, and after that only the areas of the widgets invalidated since, each
+// cleared under a scissor and drawn again by every widget overlapping it, in
+// the order the widgets were added. A page whose widgets did not change costs
+// nothing to update.
+class UiLayer
+{
+public:
+    UiLayer(std::shared_ptr<RaylibInterface> raylibPtr, int width, int height);
+    ~UiLayer(void);
+
+    UiLayer(const UiLayer&)            = delete;
+    UiLayer& operator=(const UiLayer&) = delete;
+
+    uint32_t add(Rectangle area, std::function<void(void)> draw);
+    void     invalidate(uint32_t widget);
+    void     update(void);
+    void     draw(void);
+    uint64_t getRedrawCount(void) const;
+
+private:
+    typedef struct Widget_s
+    {
+        Rectangle                 m_area;
+        std::function<void(void)> m_draw;
+        bool                      m_dirty;
+    } Widget_t;
+
+    void redraw(Rectangle area);
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
+    RenderTexture2D                  m_target;
+    std::vector<Widget_t>            m_widgets;
+    bool                             m_drawn   = false;
+    uint64_t                         m_redraws = 0; // widget draws into the texture
+};
+
+#endif // UILAYER_H
@@ -0,0 +1,67 @@
+#ifndef VOICEPOOL_H
+#define VOICEPOOL_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "RaylibInterface.h"
+
+// A fixed pool of voices, sound aliases playing the samples of their sound,
+// shared out among the sounds of the game. A sound gets as many voices as its
+// polyphony allows, and a sound triggered while all its voices play takes over
+// the one that started first. The triggers of a frame are only counted, and
+// update() starts a single voice per sound triggered, louder the more times it
+// was, so that a volley or a chain of hits costs the mixer one voice. Whether
+// a voice still plays is worked out from the length of its sound and the time
+// it started, without asking the audio device.
+class VoicePool
+{
+public:
+    static constexpr uint32_t MAX_VOICES = 16;
+    static constexpr float    MAX_VOLUME = 2; // of coalesced triggers
+
+    typedef struct Stats_s
+    {
+        uint64_t m_triggers = 0;
+        uint64_t m_voices   = 0; // voices started
+        uint64_t m_stolen   = 0; // voices started over before the end of their sound
+    } Stats_t;
+
+    VoicePool(std::shared_ptr<RaylibInterface> raylibPtr);
+    ~VoicePool(void);
+
+    VoicePool(const VoicePool&)            = delete;
+    VoicePool& operator=(const VoicePool&) = delete;
+
+    uint32_t add(Sound sound, uint32_t polyphony);
+    void     play(uint32_t sound);
+    void     update(void);
+    void     clear(void);
+    Stats_t  getStats(void) const;
+
+private:
+    typedef struct Voice_s
+    {
+        Sound  m_alias;
+        double m_start;
+        double m_end;
+    } Voice_t;
+
+    typedef struct Entry_s
+    {
+        double   m_length; // s
+        uint32_t m_firstVoice;
+        uint32_t m_voiceCount;
+        uint32_t m_triggers; // this frame
+    } Entry_t;
+
+    uint32_t voiceFor(const Entry_t& entry, double now);
+
+    std::shared_ptr<RaylibInterface> m_raylibPtr = nullptr;
+    std::vector<Voice_t>             m_voices;
+    std::vector<Entry_t>             m_sounds;
+    std::vector<uint32_t>            m_triggered; // sounds triggered this frame, in order
+    Stats_t                          m_stats;
+};
+
+#endif // VOICEPOOL_H
@@ -1,24 +1,284 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
 #include <functional>
+#include <iostream>
 #include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include "AssetArchive.h"
+#include "AssetLoader.h"
+#include "AudioQueue.h"
 #include "Game.h"
+#include "InputRecorder.h"
 #include "Logger.h"
 #include "Player.h"
-#include "RaylibWrapper.h"
+#include "ProcessStats.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "RenderQueue.h"
+#include "Replay.h"
 #include "SpriteFactory.h"
+#include "TimerWheel.h"
+#ifdef HEADLESS_
+#include "RaylibHeadless.h"
+#else
+#include "RaylibWrapper.h"
+#endif
+
+// read the resources from the packed archive when there is one, see make pack
+static void openArchive(std::shared_ptr<AssetLoader> loaderPtr)
+{
+    if (std::filesystem::exists(ASSET_ARCHIVE_FILE))
+    {
+        std::shared_ptr<AssetArchive> archivePtr = std::make_shared<AssetArchive>(ASSET_ARCHIVE_FILE);
+        if (archivePtr->isOpen())
+        {
+            loaderPtr->setArchive(archivePtr);
+        }
+    }
+}
+
+#ifdef HEADLESS_
+// every allocation of the process is counted, for the --bench report
+static std::atomic<uint64_t> allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* pointer = std::malloc((size > 0) ? size : 1);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
 
-int main(void)
+// The game with its player, drawing into a render queue in front of the
+// headless raylib. The same seed plays the same session.
+static std::shared_ptr<Game> createGame(std::shared_ptr<RaylibHeadless> raylibPtr, uint64_t seed)
 {
-    Logger::getInstance().log(Logger::DEBUG, "asteroids game");
+    std::shared_ptr<Random>        randomPtr  = std::make_shared<Random>(seed);
+    std::shared_ptr<SpriteFactory> factoryPtr = std::make_shared<SpriteFactory>(randomPtr);
+    std::shared_ptr<TimerWheel>    timersPtr  = std::make_shared<TimerWheel>();
 
+    // decoding on the calling thread keeps the frames of the session the same from run to run
+    std::shared_ptr<AssetLoader> loaderPtr = std::make_shared<AssetLoader>(raylibPtr, 0);
+    openArchive(loaderPtr);
+
+    // the game and the player draw into the render queue, which submits to raylib
+    std::shared_ptr<RenderQueue> renderPtr = std::make_shared<RenderQueue>(raylibPtr);
+
+    std::shared_ptr<Game> game = std::make_shared<Game>(renderPtr, factoryPtr, timersPtr, loaderPtr);
+
+    std::shared_ptr<Player> player = std::make_shared<Player>(renderPtr, timersPtr, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+    game->setPlayer(player);
+    game->setMenuRendering(Game::RETAINED_MENUS);
+    game->setSoundPlayback(Game::POOLED_VOICES);
+    game->setSpriteLayout(SpriteStore::PACKED_ARRAYS);
+    return game;
+}
+
+// Click Start, then sweep left and right while shooting, until the given frame.
+static void scriptSession(std::shared_ptr<RaylibHeadless> raylibPtr, uint64_t frames)
+{
+    raylibPtr->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+    for (uint64_t frame = 2; frame < frames; frame += 120)
+    {
+        raylibPtr->scriptKeyDown(frame, frame + 59, KEY_RIGHT);
+        raylibPtr->scriptKeyDown(frame + 60, frame + 119, KEY_LEFT);
+        for (uint64_t shot = frame; shot < (frame + 120); shot += 10)
+        {
+            raylibPtr->scriptKeyPressed(shot, KEY_SPACE);
+        }
+    }
+}
+
+// Play the scripted session with multiplier times the meteors, opponents,
+// player lasers and stars, and unlimited lives. The first BENCH_WARMUP_FRAMES
+// fill the screen, the next frames are measured and reported as JSON on the
+// standard output, the costs being per sprite and per tick or frame.
+static int bench(uint32_t multiplier, uint64_t frames, uint64_t seed)
+{
+    Logger::getInstance().setVerbosityLevel(Logger::ERROR);
+
+    std::shared_ptr<RaylibHeadless> raylibPtr = std::make_shared<RaylibHeadless>(1.0f / 60);
+    std::shared_ptr<Game>           game      = createGame(raylibPtr, seed);
+    game->setSpawnMultiplier(multiplier);
+    game->setLives(Game::UNLIMITED_LIVES);
+    scriptSession(raylibPtr, (BENCH_WARMUP_FRAMES + frames));
+
+    raylibPtr->setFrameLimit(BENCH_WARMUP_FRAMES);
+    game->run();
+
+    game->resetStats();
+    uint64_t allocationsBefore = allocations.load(std::memory_order_relaxed);
+    raylibPtr->setFrameLimit(BENCH_WARMUP_FRAMES + frames);
+    game->run();
+    uint64_t measuredAllocations = allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+    Game::Stats_t stats = game->getStats();
+    if ((stats.m_ticks == 0) || (stats.m_frames == 0))
+    {
+        Logger::getInstance().log(Logger::ERROR, "bench: no frame of the playing page was measured");
+        return 1;
+    }
+    auto perSprite = [](uint64_t ns, uint64_t sprites) { return std::to_string(static_cast<double>(ns) / sprites); };
+
+    std::cout << "{\"multiplier\":" << multiplier << ",\"seed\":" << seed << ",\"frames\":" << stats.m_frames << ",\"ticks\":" << stats.m_ticks
+              << ",\"averageSprites\":" << (stats.m_tickSprites / stats.m_ticks) << ",\"peakSprites\":" << stats.m_peakSprites
+              << ",\"culledSprites\":" << stats.m_culled
+              << ",\"updateNsPerSprite\":" << perSprite(stats.m_updateNs, stats.m_tickSprites)
+              << ",\"collisionNsPerSprite\":" << perSprite(stats.m_collisionNs, stats.m_tickSprites)
+              << ",\"recordNsPerSprite\":" << perSprite(stats.m_recordNs, stats.m_frameSprites)
+              << ",\"submitNsPerSprite\":" << perSprite(stats.m_submitNs, stats.m_frameSprites)
+              << ",\"allocationsPerFrame\":" << std::to_string(static_cast<double>(measuredAllocations) / stats.m_frames)
+              << ",\"peakResidentBytes\":" << ProcessStats::peakResidentBytes() << "}" << std::endl;
+    return 0;
+}
+
+// Run the game until its window closes and log how fast the frames went.
+static void runAndReport(std::shared_ptr<RaylibHeadless> raylibPtr, std::shared_ptr<Game> game)
+{
+    auto start = std::chrono::steady_clock::now();
+    game->run();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    RaylibHeadless::Counters_t counters = raylibPtr->getCounters();
+    Logger::getInstance().log(Logger::INFO,
+                              std::to_string(counters.m_frames) + " frames in " + std::to_string(elapsed.count()) + " s, " +
+                                  std::to_string(counters.m_frames / elapsed.count()) + " frames/s, " +
+                                  std::to_string(counters.m_textures) + " textures, " +
+                                  std::to_string(counters.m_texts) + " texts, " +
+                                  std::to_string(counters.m_sounds) + " sounds");
+}
+
+// Play a recorded session back as fast as it goes, with its seed and its input.
+static int replay(const std::string& fileName)
+{
+    std::shared_ptr<Replay::Reader> replayPtr = std::make_shared<Replay::Reader>(fileName);
+    if (!replayPtr->isOpen())
+    {
+        return 1;
+    }
+    Logger::getInstance().log(Logger::DEBUG, "asteroids game, headless, replay of " + fileName + ", seed " + std::to_string(replayPtr->getSeed()));
+    PROFILE_THREAD("main");
+
+    // the replay starts with the window
+    std::shared_ptr<RaylibHeadless> raylibPtr = std::make_shared<RaylibHeadless>(1.0f / 60);
+    raylibPtr->setReplay(replayPtr);
+    std::shared_ptr<Game> game = createGame(raylibPtr, replayPtr->getSeed());
+
+    runAndReport(raylibPtr, game);
+
+#ifdef PROFILER_
+    Profiler::getInstance().writeTrace(PROFILER_TRACE_FILE);
+#endif
+    return 0;
+}
+
+// asteroidsHeadless [frames [seed]] plays the scripted session,
+// asteroidsHeadless --bench [multiplier [frames [seed]]] measures how it scales,
+// asteroidsHeadless --replay file plays a session recorded by asteroids --record file.
+int main(int argc, char* argv[])
+{
+    if ((argc > 1) && (std::string(argv[1]) == "--bench"))
+    {
+        uint32_t multiplier = (argc > 2) ? std::stoul(argv[2]) : 100;
+        uint64_t frames     = (argc > 3) ? std::stoull(argv[3]) : 600;
+        uint64_t seed       = (argc > 4) ? std::stoull(argv[4]) : 1;
+        return bench(multiplier, frames, seed);
+    }
+    if ((argc > 2) && (std::string(argv[1]) == "--replay"))
+    {
+        return replay(argv[2]);
+    }
+
+    uint64_t frames = (argc > 1) ? std::stoull(argv[1]) : 10000;
+    uint64_t seed   = (argc > 2) ? std::stoull(argv[2]) : std::random_device()();
+    Logger::getInstance().log(Logger::DEBUG, "asteroids game, headless, " + std::to_string(frames) + " frames, seed " + std::to_string(seed));
+    PROFILE_THREAD("main");
+
+    std::shared_ptr<RaylibHeadless> raylibPtr = std::make_shared<RaylibHeadless>(1.0f / 60);
+    std::shared_ptr<Game>           game      = createGame(raylibPtr, seed);
+    raylibPtr->setFrameLimit(frames);
+    scriptSession(raylibPtr, frames);
+
+    runAndReport(raylibPtr, game);
+
+#ifdef PROFILER_
+    Profiler::getInstance().writeTrace(PROFILER_TRACE_FILE);
+#endif
+    return 0;
+}
+#else
+// asteroids --record file records the seed and the input of the session,
+// asteroidsHeadless --replay file plays it back.
+int main(int argc, char* argv[])
+{
+    // the seed is logged so that the session can be reproduced
+    uint64_t    seed       = std::random_device()();
+    std::string recordFile = ((argc > 2) && (std::string(argv[1]) == "--record")) ? argv[2] : "";
+    Logger::getInstance().log(Logger::DEBUG, "asteroids game, seed " + std::to_string(seed));
+    PROFILE_THREAD("main");
+
+    // a recorded session loads before its first frame, so that it starts on the
+    // welcome page like its headless playback, whose loader has no workers either
     std::shared_ptr<RaylibWrapper> raylibPtr  = std::make_shared<RaylibWrapper>();
-    std::shared_ptr<SpriteFactory> factoryPtr = std::make_shared<SpriteFactory>();
+    std::shared_ptr<Random>        randomPtr  = std::make_shared<Random>(seed);
+    std::shared_ptr<SpriteFactory> factoryPtr = std::make_shared<SpriteFactory>(randomPtr);
+    std::shared_ptr<TimerWheel>    timersPtr  = std::make_shared<TimerWheel>();
+    std::shared_ptr<AssetLoader>   loaderPtr  = std::make_shared<AssetLoader>(raylibPtr, recordFile.empty() ? ASSET_LOADER_THREADS : 0);
+    openArchive(loaderPtr);
+
+    // the game and the player draw into the render queue, a render thread
+    // submits to raylib while the next frame is simulated
+    std::shared_ptr<RenderQueue> renderPtr = std::make_shared<RenderQueue>(raylibPtr);
+    renderPtr->setThreading(RenderQueue::RENDER_THREAD);
+
+    // the recorder sees the input as the game and the player do, latched by the render queue
+    std::shared_ptr<InputRecorder>   recorderPtr = nullptr;
+    std::shared_ptr<RaylibInterface> inputPtr    = renderPtr;
+    if (!recordFile.empty())
+    {
+        recorderPtr = std::make_shared<InputRecorder>(renderPtr, recordFile, seed);
+        inputPtr    = recorderPtr;
+    }
+
+    // an audio thread plays the sounds and streams the music, straight to raylib
+    std::shared_ptr<AudioQueue> audioPtr = std::make_shared<AudioQueue>(inputPtr, raylibPtr);
+    audioPtr->setThreading(AudioQueue::AUDIO_THREAD);
 
-    std::shared_ptr<Game> game = std::make_shared<Game>(raylibPtr, factoryPtr);
+    std::shared_ptr<Game> game = std::make_shared<Game>(audioPtr, factoryPtr, timersPtr, loaderPtr);
 
-    std::shared_ptr<Player> player = std::make_shared<Player>(raylibPtr, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+    std::shared_ptr<Player> player = std::make_shared<Player>(audioPtr, timersPtr, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
     game->setPlayer(player);
+    game->setMenuRendering(Game::RETAINED_MENUS);
+    game->setSoundPlayback(Game::POOLED_VOICES);
+    game->setSpriteLayout(SpriteStore::PACKED_ARRAYS);
 
     game->run();
+    audioPtr->stop();
+    if (recorderPtr != nullptr)
+    {
+        recorderPtr->stop();
+    }
 
+#ifdef PROFILER_
+    Profiler::getInstance().writeTrace(PROFILER_TRACE_FILE);
+#endif
     return 0;
 }
+#endif
@@ -0,0 +1,467 @@
+#include "AssetArchive.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include "Logger.h"
+#ifdef _WIN32
+// without GDI, which defines ERROR
+#define NOGDI
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+const char     MAGIC[4]      = {'A', 'P', 'A', 'K'};
+const uint32_t MIN_MATCH     = 4;
+const uint32_t MAX_OFFSET    = 65535;
+const uint32_t HASH_BITS     = 14;
+const uint32_t NO_POSITION   = UINT32_MAX;
+const size_t   MAX_FILE_SIZE = UINT32_MAX;
+
+uint32_t read32(const uint8_t* bytes)
+{
+    uint32_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+// 15 in the nibble of the token, then bytes of 255 until the rest
+void writeLength(std::vector<uint8_t>& out, size_t length)
+{
+    for (length -= 15; length >= 255; length -= 255)
+    {
+        out.push_back(255);
+    }
+    out.push_back((uint8_t)length);
+}
+
+bool readLength(const uint8_t*& in, const uint8_t* end, size_t& length)
+{
+    uint8_t byte;
+    do
+    {
+        if (in == end)
+        {
+            return false;
+        }
+        byte    = *in++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+// a sequence is a token, the literals, then a match, except the last one which has no match
+void writeSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength, uint32_t offset, size_t matchLength)
+{
+    size_t  matchCode = (matchLength > 0) ? (matchLength - MIN_MATCH) : 0;
+    uint8_t token     = (uint8_t)((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15));
+
+    out.push_back(token);
+    if (literalLength >= 15)
+    {
+        writeLength(out, literalLength);
+    }
+    out.insert(out.end(), literals, literals + literalLength);
+
+    if (matchLength > 0)
+    {
+        out.push_back((uint8_t)(offset & 0xFF));
+        out.push_back((uint8_t)(offset >> 8));
+        if (matchCode >= 15)
+        {
+            writeLength(out, matchCode);
+        }
+    }
+}
+
+bool readFile(const std::filesystem::path& fileName, std::vector<uint8_t>& contents)
+{
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+    contents.resize((size_t)file.tellg());
+    file.seekg(0);
+    return (bool)file.read((char*)contents.data(), contents.size());
+}
+} // namespace
+
+AssetArchive::AssetArchive(const std::string& fileName)
+{
+    if (!map(fileName) || !index())
+    {
+        Logger::getInstance().log(Logger::WARNING, "asset archive not opened: " + fileName);
+        unmap();
+    }
+}
+
+AssetArchive::~AssetArchive(void)
+{
+    unmap();
+}
+
+bool AssetArchive::isOpen(void) const
+{
+    return (m_data != nullptr);
+}
+
+uint32_t AssetArchive::size(void) const
+{
+    return m_names.size();
+}
+
+bool AssetArchive::contains(const std::string& name) const
+{
+    return m_names.contains(std::filesystem::path(name).generic_string());
+}
+
+// The content of name, pointing into the mapping when it is stored or into
+// buffer when it had to be decompressed, nullptr when it is missing or corrupt.
+const uint8_t* AssetArchive::read(const std::string& name, std::vector<uint8_t>& buffer, uint32_t& size) const
+{
+    auto found = m_names.find(std::filesystem::path(name).generic_string());
+    if (found == m_names.end())
+    {
+        return nullptr;
+    }
+
+    // index() keeps every size within MAX_FILE_SIZE, which fits size
+    const Entry_t& entry  = m_entries[found->second];
+    const uint8_t* stored = m_data + entry.m_offset;
+    size                  = static_cast<uint32_t>(entry.m_size);
+    if (entry.m_compression == STORED)
+    {
+        return stored;
+    }
+
+    buffer.resize(entry.m_size);
+    if (!decompress(stored, entry.m_storedSize, buffer.data(), buffer.size()))
+    {
+        Logger::getInstance().log(Logger::ERROR, "corrupt asset in archive: " + name);
+        return nullptr;
+    }
+    return buffer.data();
+}
+
+// hash every content again, reads the whole archive
+bool AssetArchive::verify(void) const
+{
+    std::vector<uint8_t> buffer;
+    for (const auto& [name, index] : m_names)
+    {
+        uint32_t       size;
+        const uint8_t* data = read(name, buffer, size);
+        if ((data == nullptr) || (hash(data, size) != m_entries[index].m_hash))
+        {
+            Logger::getInstance().log(Logger::ERROR, "asset hash mismatch in archive: " + name);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Pack every file under root, in path order. A content is kept compressed only
+// when that saves at least an eighth of it, the images and the MP3 files
+// already are.
+bool AssetArchive::pack(const std::filesystem::path& root, const std::string& fileName)
+{
+    // the entries are named after the packed directory, with or without a trailing slash
+    std::filesystem::path base = root.lexically_normal();
+    if (!base.has_filename())
+    {
+        base = base.parent_path();
+    }
+
+    std::vector<std::filesystem::path> files;
+    for (const std::filesystem::directory_entry& file : std::filesystem::recursive_directory_iterator(root))
+    {
+        if (file.is_regular_file())
+        {
+            files.push_back(file.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<Entry_t>              entries(files.size());
+    std::vector<std::vector<uint8_t>> contents(files.size());
+    std::string                       names;
+    for (uint32_t index = 0; index < files.size(); index++)
+    {
+        std::string          name = (base.filename() / std::filesystem::relative(files[index], root)).generic_string();
+        std::vector<uint8_t> original;
+        if (!readFile(files[index], original) || (original.size() > MAX_FILE_SIZE) || (name.size() > UINT16_MAX))
+        {
+            Logger::getInstance().log(Logger::ERROR, "asset not packed: " + files[index].string());
+            return false;
+        }
+
+        Entry_t& entry      = entries[index];
+        entry.m_size        = original.size();
+        entry.m_hash        = hash(original.data(), original.size());
+        entry.m_nameOffset  = names.size();
+        entry.m_nameLength  = name.size();
+        entry.m_compression = STORED;
+        names              += name;
+
+        std::vector<uint8_t> compressed = compress(original.data(), original.size());
+        if (compressed.size() <= (original.size() - (original.size() / 8)))
+        {
+            entry.m_compression = LZ;
+            contents[index]     = std::move(compressed);
+        }
+        else
+        {
+            contents[index] = std::move(original);
+        }
+        entry.m_storedSize = contents[index].size();
+    }
+
+    Header_t header;
+    std::memcpy(header.m_magic, MAGIC, sizeof(MAGIC));
+    header.m_version    = VERSION;
+    header.m_entryCount = entries.size();
+    header.m_alignment  = ALIGNMENT;
+
+    uint64_t offset = sizeof(Header_t) + (entries.size() * sizeof(Entry_t)) + names.size();
+    for (uint32_t index = 0; index < entries.size(); index++)
+    {
+        offset                   = ((offset + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+        entries[index].m_offset  = offset;
+        offset                  += contents[index].size();
+    }
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)entries.data(), entries.size() * sizeof(Entry_t));
+    file.write(names.data(), names.size());
+    for (uint32_t index = 0; index < entries.size(); index++)
+    {
+        std::vector<char> padding(entries[index].m_offset - (uint64_t)file.tellp(), 0);
+        file.write(padding.data(), padding.size());
+        file.write((const char*)contents[index].data(), contents[index].size());
+    }
+
+    if (!file)
+    {
+        Logger::getInstance().log(Logger::ERROR, "asset archive not written: " + fileName);
+        return false;
+    }
+    return true;
+}
+
+// Byte oriented LZ77 in the spirit of LZ4: greedy matching of at least
+// MIN_MATCH bytes through a hash of the next 4 bytes, within the last 64 KiB.
+std::vector<uint8_t> AssetArchive::compress(const uint8_t* data, size_t size)
+{
+    std::vector<uint8_t>  out;
+    std::vector<uint32_t> table((1 << HASH_BITS), NO_POSITION);
+    size_t                anchor   = 0;
+    size_t                position = 0;
+
+    out.reserve(size / 2);
+    while ((position + MIN_MATCH) <= size)
+    {
+        uint32_t sequence  = read32(data + position);
+        uint32_t slot      = (sequence * 2654435761u) >> (32 - HASH_BITS);
+        uint32_t candidate = table[slot];
+        table[slot]        = position;
+
+        if ((candidate != NO_POSITION) && ((position - candidate) <= MAX_OFFSET) && (read32(data + candidate) == sequence))
+        {
+            size_t length = MIN_MATCH;
+            while (((position + length) < size) && (data[candidate + length] == data[position + length]))
+            {
+                length++;
+            }
+            writeSequence(out, data + anchor, position - anchor, position - candidate, length);
+            position += length;
+            anchor    = position;
+        }
+        else
+        {
+            position++;
+        }
+    }
+    writeSequence(out, data + anchor, size - anchor, 0, 0);
+    return out;
+}
+
+// false when data is not the compressed form of exactly outSize bytes
+bool AssetArchive::decompress(const uint8_t* data, size_t size, uint8_t* out, size_t outSize)
+{
+    const uint8_t* in     = data;
+    const uint8_t* end    = data + size;
+    size_t         cursor = 0;
+
+    while (in < end)
+    {
+        uint8_t token         = *in++;
+        size_t  literalLength = token >> 4;
+        if ((literalLength == 15) && !readLength(in, end, literalLength))
+        {
+            return false;
+        }
+        if ((literalLength > (size_t)(end - in)) || (literalLength > (outSize - cursor)))
+        {
+            return false;
+        }
+        std::memcpy(out + cursor, in, literalLength);
+        in     += literalLength;
+        cursor += literalLength;
+
+        if (in == end)
+        {
+            break;
+        }
+
+        if ((end - in) < 2)
+        {
+            return false;
+        }
+        size_t offset      = in[0] | ((size_t)in[1] << 8);
+        size_t matchLength = token & 0x0F;
+        in                += 2;
+        if ((matchLength == 15) && !readLength(in, end, matchLength))
+        {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+        if ((offset == 0) || (offset > cursor) || (matchLength > (outSize - cursor)))
+        {
+            return false;
+        }
+
+        // byte by byte, a match may overlap the bytes it produces
+        for (size_t index = 0; index < matchLength; index++, cursor++)
+        {
+            out[cursor] = out[cursor - offset];
+        }
+    }
+    return (cursor == outSize);
+}
+
+// 64 bit FNV-1a
+uint64_t AssetArchive::hash(const uint8_t* data, size_t size)
+{
+    uint64_t value = 0xcbf29ce484222325ULL;
+    for (size_t index = 0; index < size; index++)
+    {
+        value ^= data[index];
+        value *= 0x100000001b3ULL;
+    }
+    return value;
+}
+
+bool AssetArchive::map(const std::string& fileName)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart == 0))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    // the view keeps the mapping alive, the handles are not needed any more
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL)
+    {
+        return false;
+    }
+    m_mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (m_mapping == NULL)
+    {
+        m_mapping = nullptr;
+        return false;
+    }
+    m_size = (size_t)fileSize.QuadPart;
+#else
+    int file = ::open(fileName.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if ((fstat(file, &status) != 0) || (status.st_size == 0))
+    {
+        ::close(file);
+        return false;
+    }
+    // the mapping stays valid once the file is closed
+    void* mapping = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    m_mapping = mapping;
+    m_size    = status.st_size;
+#endif
+    m_data = (const uint8_t*)m_mapping;
+    return true;
+}
+
+void AssetArchive::unmap(void)
+{
+    if (m_mapping != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_mapping);
+#else
+        munmap(m_mapping, m_size);
+#endif
+    }
+    m_mapping = nullptr;
+    m_data    = nullptr;
+    m_size    = 0;
+    m_entries = nullptr;
+    m_names.clear();
+}
+
+// check the header and every entry against the size of the file and the
+// largest file pack() takes, then index the names
+bool AssetArchive::index(void)
+{
+    Header_t header;
+    if (m_size < sizeof(Header_t))
+    {
+        return false;
+    }
+    std::memcpy(&header, m_data, sizeof(header));
+    if ((std::memcmp(header.m_magic, MAGIC, sizeof(MAGIC)) != 0) || (header.m_version != VERSION) ||
+        (((m_size - sizeof(Header_t)) / sizeof(Entry_t)) < header.m_entryCount))
+    {
+        return false;
+    }
+
+    m_entries                 = (const Entry_t*)(m_data + sizeof(Header_t));
+    const char* names         = (const char*)(m_entries + header.m_entryCount);
+    size_t      namesCapacity = m_size - ((const uint8_t*)names - m_data);
+    for (uint32_t index = 0; index < header.m_entryCount; index++)
+    {
+        const Entry_t& entry = m_entries[index];
+        if (((entry.m_nameOffset + entry.m_nameLength) > namesCapacity) || (entry.m_offset > m_size) ||
+            (entry.m_storedSize > (m_size - entry.m_offset)) || (entry.m_size > MAX_FILE_SIZE) ||
+            (entry.m_compression > LZ) || ((entry.m_compression == STORED) && (entry.m_storedSize != entry.m_size)))
+        {
+            return false;
+        }
+        m_names[std::string(names + entry.m_nameOffset, entry.m_nameLength)] = index;
+    }
+    return true;
+}
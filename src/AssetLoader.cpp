@@ -0,0 +1,178 @@
+#include "AssetLoader.h"
+#include <cassert>
+#include <filesystem>
+#include "Profiler.h"
+
+AssetLoader::AssetLoader(std::shared_ptr<RaylibInterface> raylibPtr, uint32_t workers)
+{
+    assert(raylibPtr != nullptr);
+    m_raylibPtr = raylibPtr;
+
+    for (uint32_t index = 0; index < workers; index++)
+    {
+        m_workers.push_back(std::thread(&AssetLoader::work, this));
+    }
+}
+
+// The workers finish the file they are decoding, the files not started are dropped.
+AssetLoader::~AssetLoader(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobAdded.notify_all();
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    for (Job_t& job : m_jobs)
+    {
+        if (job.m_done && !job.m_taken)
+        {
+            if (job.m_type == IMAGE)
+            {
+                m_raylibPtr->unloadImage(job.m_image);
+            }
+            else
+            {
+                m_raylibPtr->unloadWave(job.m_wave);
+            }
+        }
+    }
+}
+
+// to be set before the first file is added
+void AssetLoader::setArchive(std::shared_ptr<AssetArchive> archivePtr)
+{
+    assert(archivePtr != nullptr);
+    assert(m_added == 0);
+    m_archivePtr = archivePtr;
+}
+
+// The bytes of fileName in the archive, nullptr without archive or when it
+// does not hold the file. See AssetArchive::read().
+const uint8_t* AssetLoader::read(const std::string& fileName, std::vector<uint8_t>& buffer, uint32_t& size) const
+{
+    return (m_archivePtr != nullptr) ? m_archivePtr->read(fileName, buffer, size) : nullptr;
+}
+
+AssetLoader::Handle_t AssetLoader::add(ASSET_t type, const std::string& fileName)
+{
+    Handle_t handle;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        handle = m_jobs.size();
+        m_jobs.push_back(Job_t(type, fileName));
+        m_added++;
+    }
+
+    if (m_workers.empty())
+    {
+        decode(m_jobs[handle]);
+    }
+    else
+    {
+        m_jobAdded.notify_one();
+    }
+    return handle;
+}
+
+bool AssetLoader::isDone(void) const
+{
+    return (m_decoded == m_added);
+}
+
+// decoded fraction of the files added so far, 1 when there is nothing to decode
+float AssetLoader::getProgress(void) const
+{
+    uint32_t added = m_added;
+    return (added > 0) ? ((float)m_decoded / added) : 1.0f;
+}
+
+void AssetLoader::wait(void)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_jobDone.wait(lock, [this](void) { return isDone(); });
+}
+
+// the caller owns the image from then on
+Image AssetLoader::takeImage(Handle_t handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assert(handle < m_jobs.size());
+    Job_t& job = m_jobs[handle];
+    assert((job.m_type == IMAGE) && job.m_done && !job.m_taken);
+    job.m_taken = true;
+    return job.m_image;
+}
+
+// the caller owns the wave from then on
+Wave AssetLoader::takeWave(Handle_t handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assert(handle < m_jobs.size());
+    Job_t& job = m_jobs[handle];
+    assert((job.m_type == WAVE) && job.m_done && !job.m_taken);
+    job.m_taken = true;
+    return job.m_wave;
+}
+
+// from the archive when it holds the file, else from disk
+void AssetLoader::decode(Job_t& job)
+{
+    PROFILE_ZONE("AssetLoader::decode");
+    Image                image = {nullptr, 0, 0, 0, 0};
+    Wave                 wave  = {0, 0, 0, 0, nullptr};
+    std::vector<uint8_t> buffer;
+    uint32_t             size  = 0;
+    const uint8_t*       data  = read(job.m_fileName, buffer, size);
+    std::string          type  = std::filesystem::path(job.m_fileName).extension().string();
+
+    if ((job.m_type == IMAGE) && (data != nullptr))
+    {
+        image = m_raylibPtr->loadImageFromMemory(type, data, size);
+    }
+    else if (job.m_type == IMAGE)
+    {
+        image = m_raylibPtr->loadImage(job.m_fileName);
+    }
+    else if (data != nullptr)
+    {
+        wave = m_raylibPtr->loadWaveFromMemory(type, data, size);
+    }
+    else
+    {
+        wave = m_raylibPtr->loadWave(job.m_fileName);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        job.m_image = image;
+        job.m_wave  = wave;
+        job.m_done  = true;
+        m_decoded++;
+    }
+    m_jobDone.notify_all();
+}
+
+// worker thread
+void AssetLoader::work(void)
+{
+    PROFILE_THREAD("asset loader");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_jobAdded.wait(lock, [this](void) { return (m_stopping || (m_nextJob < m_jobs.size())); });
+        if (m_stopping)
+        {
+            return;
+        }
+
+        Job_t& job = m_jobs[m_nextJob++];
+        lock.unlock();
+        decode(job);
+        lock.lock();
+    }
+}
@@ -0,0 +1,467 @@
+#include "AudioQueue.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include "Profiler.h"
+
+AudioQueue::AudioQueue(std::shared_ptr<RaylibInterface> raylibPtr, std::shared_ptr<RaylibInterface> audioPtr)
+{
+    assert(raylibPtr != nullptr);
+    assert(audioPtr != nullptr);
+    m_raylibPtr = raylibPtr;
+    m_audioPtr  = audioPtr;
+}
+
+AudioQueue::~AudioQueue(void)
+{
+    stop();
+}
+
+// Set before initAudioDevice(), the audio thread runs until stop().
+void AudioQueue::setThreading(THREADING_t threading)
+{
+    assert(m_threading == CALLING_THREAD);
+    m_threading = threading;
+    if (m_threading == AUDIO_THREAD)
+    {
+        m_stopping    = false;
+        m_audioThread = std::thread(&AudioQueue::audioLoop, this);
+    }
+}
+
+// The commands already pushed are executed before the audio thread stops, the
+// calls made after are made on the calling thread.
+void AudioQueue::stop(void)
+{
+    if (m_audioThread.joinable())
+    {
+        m_stopping.store(true, std::memory_order_release);
+        m_audioThread.join();
+    }
+    m_threading = CALLING_THREAD;
+}
+
+double AudioQueue::getTime(void)
+{
+    return m_raylibPtr->getTime();
+}
+
+void AudioQueue::initWindow(int width, int height, std::string title)
+{
+    m_raylibPtr->initWindow(width, height, title);
+}
+
+void AudioQueue::closeWindow(void)
+{
+    m_raylibPtr->closeWindow();
+}
+
+Texture2D AudioQueue::loadTexture(std::string filename)
+{
+    return m_raylibPtr->loadTexture(filename);
+}
+
+void AudioQueue::unloadTexture(Texture2D texture)
+{
+    m_raylibPtr->unloadTexture(texture);
+}
+
+bool AudioQueue::windowShouldClose(void)
+{
+    return m_raylibPtr->windowShouldClose();
+}
+
+float AudioQueue::getFrameTime(void)
+{
+    return m_raylibPtr->getFrameTime();
+}
+
+void AudioQueue::beginDrawing(void)
+{
+    m_raylibPtr->beginDrawing();
+}
+
+void AudioQueue::clearBackground(Color color)
+{
+    m_raylibPtr->clearBackground(color);
+}
+
+void AudioQueue::endDrawing(void)
+{
+    m_raylibPtr->endDrawing();
+}
+
+void AudioQueue::drawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    m_raylibPtr->drawTextureV(texture, position, tint);
+}
+
+bool AudioQueue::isKeyDown(int key)
+{
+    return m_raylibPtr->isKeyDown(key);
+}
+
+bool AudioQueue::isWindowReady(void)
+{
+    return m_raylibPtr->isWindowReady();
+}
+
+void AudioQueue::drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    m_raylibPtr->drawTextureEx(texture, position, rotation, scale, tint);
+}
+
+bool AudioQueue::isKeyPressed(int key)
+{
+    return m_raylibPtr->isKeyPressed(key);
+}
+
+bool AudioQueue::checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    return m_raylibPtr->checkCollisionCircles(center1, radius1, center2, radius2);
+}
+
+bool AudioQueue::checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
+{
+    return m_raylibPtr->checkCollisionCircleRec(center, radius, rec);
+}
+
+void AudioQueue::drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    m_raylibPtr->drawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+Font AudioQueue::loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount)
+{
+    return m_raylibPtr->loadFontEx(fileName, fontSize, codepoints, codepointCount);
+}
+
+void AudioQueue::drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    m_raylibPtr->drawTextEx(font, text, position, fontSize, spacing, tint);
+}
+
+void AudioQueue::unloadFont(Font font)
+{
+    m_raylibPtr->unloadFont(font);
+}
+
+// the sounds are loaded once the device is open
+void AudioQueue::initAudioDevice(void)
+{
+    Command_t command = {};
+    command.m_type    = INIT_DEVICE;
+    wait(push(command));
+}
+
+void AudioQueue::closeAudioDevice(void)
+{
+    Command_t command = {};
+    command.m_type    = CLOSE_DEVICE;
+    wait(push(command));
+}
+
+Sound AudioQueue::loadSound(std::string fileName)
+{
+    return m_raylibPtr->loadSound(fileName);
+}
+
+void AudioQueue::playSound(Sound sound)
+{
+    Command_t command = {};
+    command.m_type    = PLAY_SOUND;
+    command.m_sound   = sound;
+    push(command);
+}
+
+void AudioQueue::unloadSound(Sound sound)
+{
+    Command_t command = {};
+    command.m_type    = UNLOAD_SOUND;
+    command.m_sound   = sound;
+    push(command);
+}
+
+Music AudioQueue::loadMusicStream(std::string fileName)
+{
+    return m_raylibPtr->loadMusicStream(fileName);
+}
+
+void AudioQueue::unloadMusicStream(Music music)
+{
+    Command_t command = {};
+    command.m_type    = UNLOAD_MUSIC;
+    command.m_music   = music;
+    push(command);
+}
+
+// the audio thread refills the music itself
+void AudioQueue::updateMusicStream(Music music)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        m_audioPtr->updateMusicStream(music);
+    }
+}
+
+void AudioQueue::playMusicStream(Music music)
+{
+    Command_t command = {};
+    command.m_type    = PLAY_MUSIC;
+    command.m_music   = music;
+    push(command);
+}
+
+void AudioQueue::drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    m_raylibPtr->drawRectangleRounded(rec, roundness, segments, color);
+}
+
+Vector2 AudioQueue::getMousePosition(void)
+{
+    return m_raylibPtr->getMousePosition();
+}
+
+bool AudioQueue::checkCollisionPointRec(Vector2 point, Rectangle rec)
+{
+    return m_raylibPtr->checkCollisionPointRec(point, rec);
+}
+
+bool AudioQueue::isMouseButtonPressed(int button)
+{
+    return m_raylibPtr->isMouseButtonPressed(button);
+}
+
+Vector2 AudioQueue::measureTextEx(Font font, std::string text, float fontSize, float spacing)
+{
+    return m_raylibPtr->measureTextEx(font, text, fontSize, spacing);
+}
+
+Image AudioQueue::loadImage(std::string fileName)
+{
+    return m_raylibPtr->loadImage(fileName);
+}
+
+void AudioQueue::unloadImage(Image image)
+{
+    m_raylibPtr->unloadImage(image);
+}
+
+Image AudioQueue::genImageColor(int width, int height, Color color)
+{
+    return m_raylibPtr->genImageColor(width, height, color);
+}
+
+void AudioQueue::imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    m_raylibPtr->imageDraw(dst, src, srcRec, dstRec, tint);
+}
+
+Texture2D AudioQueue::loadTextureFromImage(Image image)
+{
+    return m_raylibPtr->loadTextureFromImage(image);
+}
+
+Wave AudioQueue::loadWave(std::string fileName)
+{
+    return m_raylibPtr->loadWave(fileName);
+}
+
+void AudioQueue::unloadWave(Wave wave)
+{
+    m_raylibPtr->unloadWave(wave);
+}
+
+Sound AudioQueue::loadSoundFromWave(Wave wave)
+{
+    return m_raylibPtr->loadSoundFromWave(wave);
+}
+
+Image AudioQueue::loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    return m_raylibPtr->loadImageFromMemory(fileType, fileData, dataSize);
+}
+
+Wave AudioQueue::loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    return m_raylibPtr->loadWaveFromMemory(fileType, fileData, dataSize);
+}
+
+Font AudioQueue::loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount)
+{
+    return m_raylibPtr->loadFontFromMemory(fileType, fileData, dataSize, fontSize, codepoints, codepointCount);
+}
+
+Music AudioQueue::loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize)
+{
+    return m_raylibPtr->loadMusicStreamFromMemory(fileType, data, dataSize);
+}
+
+RenderTexture2D AudioQueue::loadRenderTexture(int width, int height)
+{
+    return m_raylibPtr->loadRenderTexture(width, height);
+}
+
+void AudioQueue::unloadRenderTexture(RenderTexture2D target)
+{
+    m_raylibPtr->unloadRenderTexture(target);
+}
+
+void AudioQueue::beginTextureMode(RenderTexture2D target)
+{
+    m_raylibPtr->beginTextureMode(target);
+}
+
+void AudioQueue::endTextureMode(void)
+{
+    m_raylibPtr->endTextureMode();
+}
+
+void AudioQueue::beginScissorMode(int x, int y, int width, int height)
+{
+    m_raylibPtr->beginScissorMode(x, y, width, height);
+}
+
+void AudioQueue::endScissorMode(void)
+{
+    m_raylibPtr->endScissorMode();
+}
+
+void AudioQueue::drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint)
+{
+    m_raylibPtr->drawRenderTexture(target, position, tint);
+}
+
+Sound AudioQueue::loadSoundAlias(Sound source)
+{
+    return m_raylibPtr->loadSoundAlias(source);
+}
+
+void AudioQueue::unloadSoundAlias(Sound alias)
+{
+    Command_t command = {};
+    command.m_type    = UNLOAD_ALIAS;
+    command.m_sound   = alias;
+    push(command);
+}
+
+void AudioQueue::setSoundVolume(Sound sound, float volume)
+{
+    Command_t command = {};
+    command.m_type    = SET_VOLUME;
+    command.m_sound   = sound;
+    command.m_volume  = volume;
+    push(command);
+}
+
+// Execute command on the calling thread, or hand it to the audio thread.
+// Returns the number of the command, 0 when it was already executed.
+uint64_t AudioQueue::push(const Command_t& command)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        execute(command);
+        return 0;
+    }
+
+    // the slot is free once the command QUEUE_CAPACITY before was executed
+    uint64_t number = m_pushed.load(std::memory_order_relaxed) + 1;
+    while ((number - m_executed.load(std::memory_order_acquire)) > QUEUE_CAPACITY)
+    {
+        std::this_thread::yield();
+    }
+    m_commands[(number - 1) % QUEUE_CAPACITY] = command;
+    m_pushed.store(number, std::memory_order_release);
+    return number;
+}
+
+// returns once the audio thread has executed the commands up to command
+void AudioQueue::wait(uint64_t command)
+{
+    uint64_t executed = m_executed.load(std::memory_order_acquire);
+    while (executed < command)
+    {
+        m_executed.wait(executed, std::memory_order_acquire);
+        executed = m_executed.load(std::memory_order_acquire);
+    }
+}
+
+// audio thread
+void AudioQueue::audioLoop(void)
+{
+    PROFILE_THREAD("audio");
+    while (!m_stopping.load(std::memory_order_acquire))
+    {
+        drain();
+        for (const Music& music : m_playing)
+        {
+            m_audioPtr->updateMusicStream(music);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(REFILL_INTERVAL_MS));
+    }
+    drain();
+}
+
+// audio thread, every command pushed so far
+void AudioQueue::drain(void)
+{
+    uint64_t pushed   = m_pushed.load(std::memory_order_acquire);
+    uint64_t executed = m_executed.load(std::memory_order_relaxed);
+    while (executed < pushed)
+    {
+        execute(m_commands[executed % QUEUE_CAPACITY]);
+        executed++;
+        m_executed.store(executed, std::memory_order_release);
+        m_executed.notify_all();
+    }
+}
+
+void AudioQueue::execute(const Command_t& command)
+{
+    auto sameMusic = [&command](const Music& music) { return (music.stream.buffer == command.m_music.stream.buffer); };
+
+    switch (command.m_type)
+    {
+        case INIT_DEVICE:
+            m_audioPtr->initAudioDevice();
+            break;
+
+        case CLOSE_DEVICE:
+            m_playing.clear();
+            m_audioPtr->closeAudioDevice();
+            break;
+
+        case PLAY_SOUND:
+            m_audioPtr->playSound(command.m_sound);
+            break;
+
+        case SET_VOLUME:
+            m_audioPtr->setSoundVolume(command.m_sound, command.m_volume);
+            break;
+
+        case UNLOAD_SOUND:
+            m_audioPtr->unloadSound(command.m_sound);
+            break;
+
+        case UNLOAD_ALIAS:
+            m_audioPtr->unloadSoundAlias(command.m_sound);
+            break;
+
+        case PLAY_MUSIC:
+            m_audioPtr->playMusicStream(command.m_music);
+            if (std::none_of(m_playing.begin(), m_playing.end(), sameMusic))
+            {
+                m_playing.push_back(command.m_music);
+            }
+            break;
+
+        case UNLOAD_MUSIC:
+            m_playing.erase(std::remove_if(m_playing.begin(), m_playing.end(), sameMusic), m_playing.end());
+            m_audioPtr->unloadMusicStream(command.m_music);
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+}
@@ -0,0 +1,117 @@
+#include "CollisionGrid.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "SpriteStore.h"
+
+CollisionGrid::CollisionGrid(float width, float height, float cellSize)
+{
+    assert(cellSize > 0);
+    m_cellSize = cellSize;
+    m_columns  = std::max(1.0f, std::ceil(width / cellSize));
+    m_rows     = std::max(1.0f, std::ceil(height / cellSize));
+    m_cellStart.resize((m_columns * m_rows) + 1);
+}
+
+// Counting sort of the sprite indices by cell: count the entries of every cell,
+// turn the counts into end offsets, then fill each cell back to front. Walking
+// the sprites in reverse leaves the indices of a cell in ascending order.
+void CollisionGrid::build(const SpriteStore& store)
+{
+    uint32_t count = store.size();
+    uint32_t cells = m_columns * m_rows;
+
+    m_ranges.resize(count);
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        m_ranges[index] = cellRange(store.getBounds(index));
+        for (uint32_t row = m_ranges[index].m_firstRow; row <= m_ranges[index].m_lastRow; row++)
+        {
+            for (uint32_t column = m_ranges[index].m_firstColumn; column <= m_ranges[index].m_lastColumn; column++)
+            {
+                m_cellStart[(row * m_columns) + column]++;
+            }
+        }
+    }
+
+    for (uint32_t cell = 1; cell < cells; cell++)
+    {
+        m_cellStart[cell] += m_cellStart[cell - 1];
+    }
+    m_cellStart[cells] = m_cellStart[cells - 1];
+    m_entries.resize(m_cellStart[cells]);
+
+    for (uint32_t index = count; index > 0; index--)
+    {
+        const CellRange_t& range = m_ranges[index - 1];
+        for (uint32_t row = range.m_firstRow; row <= range.m_lastRow; row++)
+        {
+            for (uint32_t column = range.m_firstColumn; column <= range.m_lastColumn; column++)
+            {
+                m_entries[--m_cellStart[(row * m_columns) + column]] = index - 1;
+            }
+        }
+    }
+
+    m_stamps.assign(count, 0);
+    m_queryStamp = 0;
+}
+
+void CollisionGrid::query(Rectangle area, std::vector<uint32_t>& candidates)
+{
+    candidates.clear();
+    if (m_stamps.empty())
+    {
+        return;
+    }
+
+    m_queryStamp++;
+    if (m_queryStamp == 0)
+    {
+        std::fill(m_stamps.begin(), m_stamps.end(), 0);
+        m_queryStamp = 1;
+    }
+
+    CellRange_t range = cellRange(area);
+    for (uint32_t row = range.m_firstRow; row <= range.m_lastRow; row++)
+    {
+        for (uint32_t column = range.m_firstColumn; column <= range.m_lastColumn; column++)
+        {
+            uint32_t cell = (row * m_columns) + column;
+            for (uint32_t entry = m_cellStart[cell]; entry < m_cellStart[cell + 1]; entry++)
+            {
+                uint32_t index = m_entries[entry];
+                if (m_stamps[index] != m_queryStamp)
+                {
+                    m_stamps[index] = m_queryStamp;
+                    candidates.push_back(index);
+                }
+            }
+        }
+    }
+
+    // keep the order of the brute-force loops
+    std::sort(candidates.begin(), candidates.end());
+}
+
+CollisionGrid::CellRange_t CollisionGrid::cellRange(Rectangle area) const
+{
+    auto toCell = [this](float position, uint32_t cellCount) -> uint32_t
+    {
+        float cell = std::floor(position / m_cellSize);
+        if (!(cell > 0))
+        {
+            return 0;
+        }
+        return (cell < cellCount) ? (uint32_t)cell : (cellCount - 1);
+    };
+
+    CellRange_t range;
+    range.m_firstColumn = toCell(area.x, m_columns);
+    range.m_lastColumn  = toCell(area.x + area.width, m_columns);
+    range.m_firstRow    = toCell(area.y, m_rows);
+    range.m_lastRow     = toCell(area.y + area.height, m_rows);
+    return range;
+}
@@ -0,0 +1,287 @@
+#include "CollisionKernels.h"
+#include <bit>
+#include <cmath>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+// The lane types share one interface so that every kernel is written once and
+// instantiated for the scalar tail as well as for the SIMD body.
+struct ScalarLanes
+{
+    typedef float Value_t;
+    typedef bool  Mask_t;
+
+    static constexpr uint32_t WIDTH = 1;
+
+    static Value_t  broadcast(float value) { return value; }
+    static Value_t  gather(const float* base, const uint32_t* indices) { return base[indices[0]]; }
+    static Value_t  add(Value_t a, Value_t b) { return a + b; }
+    static Value_t  sub(Value_t a, Value_t b) { return a - b; }
+    static Value_t  mul(Value_t a, Value_t b) { return a * b; }
+    static Value_t  abs(Value_t a) { return std::fabs(a); }
+    static Mask_t   lessEqual(Value_t a, Value_t b) { return a <= b; }
+    static Mask_t   maskAnd(Mask_t a, Mask_t b) { return a & b; }
+    static Mask_t   maskOr(Mask_t a, Mask_t b) { return a | b; }
+    static uint32_t bits(Mask_t mask) { return mask ? 1 : 0; }
+};
+
+#if defined(__AVX512F__)
+struct SimdLanes
+{
+    typedef __m512    Value_t;
+    typedef __mmask16 Mask_t;
+
+    static constexpr uint32_t WIDTH = 16;
+
+    static Value_t broadcast(float value) { return _mm512_set1_ps(value); }
+    static Value_t gather(const float* base, const uint32_t* indices)
+    {
+        return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, _mm512_loadu_si512(indices), base, sizeof(float));
+    }
+    static Value_t  add(Value_t a, Value_t b) { return _mm512_add_ps(a, b); }
+    static Value_t  sub(Value_t a, Value_t b) { return _mm512_sub_ps(a, b); }
+    static Value_t  mul(Value_t a, Value_t b) { return _mm512_mul_ps(a, b); }
+    static Value_t  abs(Value_t a) { return _mm512_abs_ps(a); }
+    static Mask_t   lessEqual(Value_t a, Value_t b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static Mask_t   maskAnd(Mask_t a, Mask_t b) { return a & b; }
+    static Mask_t   maskOr(Mask_t a, Mask_t b) { return a | b; }
+    static uint32_t bits(Mask_t mask) { return mask; }
+};
+#elif defined(__AVX2__)
+struct SimdLanes
+{
+    typedef __m256 Value_t;
+    typedef __m256 Mask_t;
+
+    static constexpr uint32_t WIDTH = 8;
+
+    static Value_t broadcast(float value) { return _mm256_set1_ps(value); }
+    static Value_t gather(const float* base, const uint32_t* indices)
+    {
+        return _mm256_i32gather_ps(base, _mm256_loadu_si256((const __m256i*)indices), sizeof(float));
+    }
+    static Value_t  add(Value_t a, Value_t b) { return _mm256_add_ps(a, b); }
+    static Value_t  sub(Value_t a, Value_t b) { return _mm256_sub_ps(a, b); }
+    static Value_t  mul(Value_t a, Value_t b) { return _mm256_mul_ps(a, b); }
+    static Value_t  abs(Value_t a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static Mask_t   lessEqual(Value_t a, Value_t b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static Mask_t   maskAnd(Mask_t a, Mask_t b) { return _mm256_and_ps(a, b); }
+    static Mask_t   maskOr(Mask_t a, Mask_t b) { return _mm256_or_ps(a, b); }
+    static uint32_t bits(Mask_t mask) { return _mm256_movemask_ps(mask); }
+};
+#elif defined(__SSE2__)
+struct SimdLanes
+{
+    typedef __m128 Value_t;
+    typedef __m128 Mask_t;
+
+    static constexpr uint32_t WIDTH = 4;
+
+    static Value_t broadcast(float value) { return _mm_set1_ps(value); }
+    static Value_t gather(const float* base, const uint32_t* indices)
+    {
+        return _mm_setr_ps(base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]]);
+    }
+    static Value_t  add(Value_t a, Value_t b) { return _mm_add_ps(a, b); }
+    static Value_t  sub(Value_t a, Value_t b) { return _mm_sub_ps(a, b); }
+    static Value_t  mul(Value_t a, Value_t b) { return _mm_mul_ps(a, b); }
+    static Value_t  abs(Value_t a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static Mask_t   lessEqual(Value_t a, Value_t b) { return _mm_cmple_ps(a, b); }
+    static Mask_t   maskAnd(Mask_t a, Mask_t b) { return _mm_and_ps(a, b); }
+    static Mask_t   maskOr(Mask_t a, Mask_t b) { return _mm_or_ps(a, b); }
+    static uint32_t bits(Mask_t mask) { return _mm_movemask_ps(mask); }
+};
+#else
+typedef ScalarLanes SimdLanes;
+#endif
+
+template <typename Lanes>
+void appendHits(typename Lanes::Mask_t mask, const uint32_t* indices, std::vector<uint32_t>& hits)
+{
+    uint32_t bits = Lanes::bits(mask);
+    while (bits != 0)
+    {
+        hits.push_back(indices[std::countr_zero(bits)]);
+        bits &= (bits - 1);
+    }
+}
+
+// CheckCollisionCircleRec without the early returns, the rectangle given by its
+// center and half extents.
+template <typename Lanes>
+typename Lanes::Mask_t circleRecMask(typename Lanes::Value_t centerX,
+                                     typename Lanes::Value_t centerY,
+                                     typename Lanes::Value_t radius,
+                                     typename Lanes::Value_t recCenterX,
+                                     typename Lanes::Value_t recCenterY,
+                                     typename Lanes::Value_t halfWidth,
+                                     typename Lanes::Value_t halfHeight)
+{
+    typedef Lanes L;
+    typename L::Value_t dx      = L::abs(L::sub(centerX, recCenterX));
+    typename L::Value_t dy      = L::abs(L::sub(centerY, recCenterY));
+    typename L::Value_t cornerX = L::sub(dx, halfWidth);
+    typename L::Value_t cornerY = L::sub(dy, halfHeight);
+
+    typename L::Mask_t nearby = L::maskAnd(L::lessEqual(dx, L::add(halfWidth, radius)),
+                                           L::lessEqual(dy, L::add(halfHeight, radius)));
+    typename L::Mask_t inside = L::maskOr(L::maskOr(L::lessEqual(dx, halfWidth), L::lessEqual(dy, halfHeight)),
+                                          L::lessEqual(L::add(L::mul(cornerX, cornerX), L::mul(cornerY, cornerY)), L::mul(radius, radius)));
+    return L::maskAnd(nearby, inside);
+}
+
+// Each kernel walks the candidates from first in steps of the lane width and
+// returns where it stopped, so that the scalar instance finishes the tail.
+template <typename Lanes>
+uint32_t circlesVsRectLanes(const CollisionKernels::CircleBatch_t& circles,
+                            const std::vector<uint32_t>&           candidates,
+                            uint32_t                               first,
+                            Rectangle                              rect,
+                            std::vector<uint32_t>&                 hits)
+{
+    typedef Lanes L;
+    typename L::Value_t halfWidth  = L::broadcast(rect.width / 2.0f);
+    typename L::Value_t halfHeight = L::broadcast(rect.height / 2.0f);
+    typename L::Value_t recCenterX = L::broadcast(rect.x + (rect.width / 2.0f));
+    typename L::Value_t recCenterY = L::broadcast(rect.y + (rect.height / 2.0f));
+
+    uint32_t lane = first;
+    for (; (lane + L::WIDTH) <= candidates.size(); lane += L::WIDTH)
+    {
+        const uint32_t* indices = &candidates[lane];
+        appendHits<L>(circleRecMask<L>(L::gather(circles.m_centerX, indices),
+                                       L::gather(circles.m_centerY, indices),
+                                       L::gather(circles.m_radius, indices),
+                                       recCenterX,
+                                       recCenterY,
+                                       halfWidth,
+                                       halfHeight),
+                      indices,
+                      hits);
+    }
+    return lane;
+}
+
+template <typename Lanes>
+uint32_t rectsVsCircleLanes(const CollisionKernels::RectBatch_t& rects,
+                            const std::vector<uint32_t>&         candidates,
+                            uint32_t                             first,
+                            Vector2                              center,
+                            float                                radius,
+                            std::vector<uint32_t>&               hits)
+{
+    typedef Lanes L;
+    typename L::Value_t centerX = L::broadcast(center.x);
+    typename L::Value_t centerY = L::broadcast(center.y);
+    typename L::Value_t radii   = L::broadcast(radius);
+    typename L::Value_t half    = L::broadcast(0.5f);
+
+    uint32_t lane = first;
+    for (; (lane + L::WIDTH) <= candidates.size(); lane += L::WIDTH)
+    {
+        const uint32_t*     indices    = &candidates[lane];
+        typename L::Value_t x          = L::gather(rects.m_x, indices);
+        typename L::Value_t y          = L::gather(rects.m_y, indices);
+        typename L::Value_t halfWidth  = L::gather(rects.m_width, indices);
+        typename L::Value_t halfHeight = L::gather(rects.m_height, indices);
+
+        // exact halving, the same value as the division by 2.0f in raylib
+        halfWidth  = L::mul(halfWidth, half);
+        halfHeight = L::mul(halfHeight, half);
+
+        appendHits<L>(circleRecMask<L>(centerX,
+                                       centerY,
+                                       radii,
+                                       L::add(x, halfWidth),
+                                       L::add(y, halfHeight),
+                                       halfWidth,
+                                       halfHeight),
+                      indices,
+                      hits);
+    }
+    return lane;
+}
+
+template <typename Lanes>
+uint32_t circlesVsCircleLanes(const CollisionKernels::CircleBatch_t& circles,
+                              const std::vector<uint32_t>&           candidates,
+                              uint32_t                               first,
+                              Vector2                                center,
+                              float                                  radius,
+                              std::vector<uint32_t>&                 hits)
+{
+    typedef Lanes L;
+    typename L::Value_t centerX = L::broadcast(center.x);
+    typename L::Value_t centerY = L::broadcast(center.y);
+    typename L::Value_t radii   = L::broadcast(radius);
+
+    uint32_t lane = first;
+    for (; (lane + L::WIDTH) <= candidates.size(); lane += L::WIDTH)
+    {
+        const uint32_t*     indices   = &candidates[lane];
+        typename L::Value_t dx        = L::sub(L::gather(circles.m_centerX, indices), centerX);
+        typename L::Value_t dy        = L::sub(L::gather(circles.m_centerY, indices), centerY);
+        typename L::Value_t radiusSum = L::add(radii, L::gather(circles.m_radius, indices));
+
+        appendHits<L>(L::lessEqual(L::add(L::mul(dx, dx), L::mul(dy, dy)), L::mul(radiusSum, radiusSum)), indices, hits);
+    }
+    return lane;
+}
+} // namespace
+
+CollisionKernels::CollisionKernels(KERNEL_t kernel)
+{
+    m_kernel = kernel;
+}
+
+uint32_t CollisionKernels::lanes(void) const
+{
+    return (m_kernel == SIMD) ? SimdLanes::WIDTH : ScalarLanes::WIDTH;
+}
+
+void CollisionKernels::circlesVsRect(const CircleBatch_t&         circles,
+                                     const std::vector<uint32_t>& candidates,
+                                     Rectangle                    rect,
+                                     std::vector<uint32_t>&       hits) const
+{
+    uint32_t lane = 0;
+    hits.clear();
+    if (m_kernel == SIMD)
+    {
+        lane = circlesVsRectLanes<SimdLanes>(circles, candidates, lane, rect, hits);
+    }
+    circlesVsRectLanes<ScalarLanes>(circles, candidates, lane, rect, hits);
+}
+
+void CollisionKernels::circlesVsCircle(const CircleBatch_t&         circles,
+                                       const std::vector<uint32_t>& candidates,
+                                       Vector2                      center,
+                                       float                        radius,
+                                       std::vector<uint32_t>&       hits) const
+{
+    uint32_t lane = 0;
+    hits.clear();
+    if (m_kernel == SIMD)
+    {
+        lane = circlesVsCircleLanes<SimdLanes>(circles, candidates, lane, center, radius, hits);
+    }
+    circlesVsCircleLanes<ScalarLanes>(circles, candidates, lane, center, radius, hits);
+}
+
+void CollisionKernels::rectsVsCircle(const RectBatch_t&           rects,
+                                     const std::vector<uint32_t>& candidates,
+                                     Vector2                      center,
+                                     float                        radius,
+                                     std::vector<uint32_t>&       hits) const
+{
+    uint32_t lane = 0;
+    hits.clear();
+    if (m_kernel == SIMD)
+    {
+        lane = rectsVsCircleLanes<SimdLanes>(rects, candidates, lane, center, radius, hits);
+    }
+    rectsVsCircleLanes<ScalarLanes>(rects, candidates, lane, center, radius, hits);
+}
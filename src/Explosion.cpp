@@ -8,14 +8,25 @@ Explosion::Explosion(std::shared_ptr<RaylibInterface> raylibPtr,
 {
     assert(raylibPtr->isWindowReady());
     m_raylibPtr = raylibPtr;
-    m_position  = position;
-    m_scale     = scale;
+
+    Sprite::SpriteAttr_t attr;
+    attr.m_position = position;
+    attr.m_scale    = scale;
+    reset(attr);
+}
+
+void Explosion::reset(Sprite::SpriteAttr_t attr)
+{
+    m_position = attr.m_position;
+    m_scale    = attr.m_scale;
+    m_index    = 0;
+    m_discard  = false;
 }
 
 void Explosion::update(void)
 {
     assert(m_textures.size() > 1);
-    float dt  = m_raylibPtr->getFrameTime();
+    float dt  = frameTime();
     m_index  += (uint32_t)(EXPLOSION_SPEED * dt);
     if (m_index >= m_textures.size())
     {
@@ -28,7 +39,7 @@ void Explosion::draw(void)
 {
     assert(m_textures.size() > 1);
     assert(m_index < m_textures.size());
-    m_raylibPtr->drawTextureEx(m_textures[m_index], m_position, 0, m_scale, WHITE);
+    drawFrame(m_textures[m_index], m_position, 0, m_scale, WHITE);
 }
 
 Vector2 Explosion::getCenter(void)
@@ -49,10 +60,21 @@ Rectangle Explosion::getRect(void)
     return (Rectangle(0, 0, 0, 0));
 }
 
-void Explosion::setTextures(std::vector<Texture2D> textures)
+Sprite::Body_t Explosion::getBody(void)
+{
+    assert(m_textures.size() > 1);
+    Body_t body;
+    body.m_frames    = m_textures;
+    body.m_position  = m_position;
+    body.m_scale     = m_scale;
+    body.m_frameRate = EXPLOSION_SPEED;
+    return body;
+}
+
+void Explosion::setTextures(TextureAtlas::Frames_t textures)
 {
     assert(textures.size() > 1);
     m_textures   = textures;
-    m_position.x = m_position.x - (m_textures[0].width / 2) * m_scale;
-    m_position.y = m_position.y - (m_textures[0].height / 2) * m_scale;
+    m_position.x = m_position.x - (m_textures[0].m_source.width / 2) * m_scale;
+    m_position.y = m_position.y - (m_textures[0].m_source.height / 2) * m_scale;
 }
@@ -1,20 +1,64 @@
 #include "Game.h"
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <format>
+#include "Logger.h"
 #include "PlayerInterface.h"
+#include "Profiler.h"
 #include "SpriteFactory.h"
-#include "Timer.h"
+#include "TimerWheel.h"
 
-Game::Game(std::shared_ptr<RaylibInterface> raylibPtr, std::shared_ptr<SpriteFactory> factoryPtr)
+namespace
+{
+// adds the time spent in its scope to a counter of Game::Stats_t
+class StatsTimer
+{
+public:
+    StatsTimer(uint64_t& counter)
+    {
+        m_counter = &counter;
+        m_start   = std::chrono::steady_clock::now();
+    }
+
+    ~StatsTimer(void)
+    {
+        *m_counter += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+private:
+    uint64_t*                             m_counter = nullptr;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// the playfield grown by margin on every side
+Rectangle worldBounds(float margin)
+{
+    return (Rectangle(-margin, -margin, WINDOW_WIDTH + (2 * margin), WINDOW_HEIGHT + (2 * margin)));
+}
+
+bool sameColor(Color first, Color second)
+{
+    return ((first.r == second.r) && (first.g == second.g) && (first.b == second.b) && (first.a == second.a));
+}
+} // namespace
+
+Game::Game(std::shared_ptr<RaylibInterface> raylibPtr,
+           std::shared_ptr<SpriteFactory>   factoryPtr,
+           std::shared_ptr<TimerWheel>      timersPtr,
+           std::shared_ptr<AssetLoader>     loaderPtr)
 {
     assert(raylibPtr != nullptr);
     assert(factoryPtr != nullptr);
+    assert(timersPtr != nullptr);
+    assert(loaderPtr != nullptr);
     m_raylibPtr = raylibPtr;
     m_factory   = factoryPtr;
+    m_timers    = timersPtr;
+    m_loader    = loaderPtr;
 
     ////// raylib init //////
-    m_state = WELCOME;
+    m_state = LOADING;
     m_raylibPtr->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, m_gameName);
     m_raylibPtr->initAudioDevice();
     loadResources();
@@ -105,40 +149,32 @@ Game::Game(std::shared_ptr<RaylibInterface> raylibPtr, std::shared_ptr<SpriteFac
     m_gameoverQuitButton.m_position.y = (m_gameoverQuitButton.m_selectArea.y + ((m_gameoverQuitButton.m_selectArea.height - textsize.y) / 2));
 
     ////// playing page //////
-    m_meteorTimer = std::make_shared<Timer>(m_raylibPtr,
-                                            METEOR_TIMER_DURATION,
-                                            true,
-                                            true,
-                                            std::bind(&Game::createMeteor, this));
-
-    m_rampdownTimer = std::make_shared<Timer>(m_raylibPtr,
-                                              1,
-                                              false,
-                                              false,
-                                              std::bind(&Game::gameoverReset, this));
-
-    m_opponentTimer = std::make_shared<Timer>(m_raylibPtr,
-                                              OPPONENT_TIMER_DURATION,
-                                              true,
-                                              true,
-                                              std::bind(&Game::createOpponent, this));
-
-    m_dispersionTimer = std::make_shared<Timer>(m_raylibPtr,
-                                                DISPERSION_TIMER_DURATION,
-                                                true,
-                                                true,
-                                                std::bind(&Game::createPowerupDispersion, this));
+    // the callbacks only capture this, which fits in the small buffer of std::function.
+    // The ramp down can end the game earlier in the same advance(), the spawn timers
+    // expiring after it then spawn nothing.
+    m_meteorTimer     = m_timers->add(METEOR_TIMER_DURATION, true, true, [this](void) { spawn(&Game::createMeteor); });
+    m_rampdownTimer   = m_timers->add(1, false, false, [this](void) { gameoverReset(); });
+    m_opponentTimer   = m_timers->add(OPPONENT_TIMER_DURATION, true, true, [this](void) { spawn(&Game::createOpponent); });
+    m_dispersionTimer = m_timers->add(DISPERSION_TIMER_DURATION, true, true, [this](void) {
+        if (m_state == PLAYING)
+        {
+            createPowerupDispersion();
+        }
+    });
 
-    Sprite::SpriteAttr_t attr;
-    for (uint32_t index = 0; index < NUMBER_OF_STARS; index++)
+    // a loader without workers has already decoded everything
+    if (m_loader->isDone())
     {
-        m_starsList[index] = m_factory->getSprite(SpriteFactory::STAR, m_raylibPtr, attr);
-        m_starsList[index]->setTextures(m_texturesMap["star"]);
+        finishLoading();
     }
 }
 
 Game::~Game(void)
 {
+    m_timers->remove(m_dispersionTimer);
+    m_timers->remove(m_opponentTimer);
+    m_timers->remove(m_rampdownTimer);
+    m_timers->remove(m_meteorTimer);
     unloadResources();
     m_raylibPtr->closeAudioDevice();
 }
@@ -150,6 +186,10 @@ void Game::run(void)
     {
         switch (m_state)
         {
+            case LOADING:
+                refreshLoadingPage();
+                break;
+
             case WELCOME:
                 refreshWelcomePage();
                 break;
@@ -174,31 +214,47 @@ void Game::run(void)
                 assert(false);
                 break;
         }
+        if (m_voices != nullptr)
+        {
+            m_voices->update();
+        }
+#ifdef PROFILER_
+        if (m_raylibPtr->isKeyPressed(PROFILER_TRACE_KEY))
+        {
+            Profiler::getInstance().writeTrace(PROFILER_TRACE_FILE);
+        }
+#endif
     }
 }
 
 void Game::setPlayer(std::shared_ptr<PlayerInterface> player)
 {
     m_player = player;
-    m_player->setTextures(m_texturesMap["player"]);
+    if (m_resourcesReady)
+    {
+        m_player->setTextures(m_textureSets.m_player);
+    }
 }
 
 void Game::playerShootLaser(Sprite::SpriteAttr_t attr)
 {
     assert(m_state == PLAYING);
-    std::shared_ptr<Sprite> laserM = m_factory->getSprite(SpriteFactory::RED_LASER, m_raylibPtr, attr);
-    laserM->setTextures(m_texturesMap["laser"]);
-    m_playerLasersList.push_back(laserM);
+    for (uint32_t count = 0; count < m_spawnMultiplier; count++)
+    {
+        std::shared_ptr<Sprite> laserM = m_factory->getSprite(SpriteFactory::RED_LASER, m_raylibPtr, attr);
+        laserM->setTextures(m_textureSets.m_laser);
+        m_playerLasersList.add(laserM);
+    }
 
-    m_raylibPtr->playSound(m_laserSound);
+    playSound(m_laserSound, m_laserVoice);
 }
 
 void Game::opponentShootLaser(Sprite::SpriteAttr_t attr)
 {
     assert(m_state == PLAYING);
     std::shared_ptr<Sprite> laserM = m_factory->getSprite(SpriteFactory::YELLOW_LASER, m_raylibPtr, attr);
-    laserM->setTextures(m_texturesMap["laser"]);
-    m_opponentLasersList.push_back(laserM);
+    laserM->setTextures(m_textureSets.m_laser);
+    m_opponentLasersList.add(laserM);
 }
 
 void Game::createMeteor(void)
@@ -206,20 +262,31 @@ void Game::createMeteor(void)
     assert(m_state == PLAYING);
     Sprite::SpriteAttr_t    attr;
     std::shared_ptr<Sprite> meteor = m_factory->getSprite(SpriteFactory::METEOR, m_raylibPtr, attr);
-    meteor->setTextures(m_texturesMap["meteor"]);
-    m_meteorsList.push_back(meteor);
+    meteor->setTextures(m_textureSets.m_meteor);
+    m_meteorsList.add(meteor);
 }
 
 void Game::createOpponent(void)
 {
     assert(m_state == PLAYING);
     Sprite::SpriteAttr_t    attr;
+    SpriteStore::Handle_t   shooter  = m_opponentsList.nextHandle();
     std::shared_ptr<Sprite> opponent = m_factory->getSprite(SpriteFactory::OPPONENT,
                                                             m_raylibPtr,
                                                             attr,
-                                                            std::bind(&Game::opponentShootLaser, this, std::placeholders::_1));
-    opponent->setTextures(m_texturesMap["player"]);
-    m_opponentsList.push_back(opponent);
+                                                            [this, shooter](Sprite::SpriteAttr_t laserAttr) { checkedOpponentShootLaser(shooter, laserAttr); });
+    opponent->setTextures(m_textureSets.m_player);
+    m_opponentsList.add(opponent);
+}
+
+void Game::checkedOpponentShootLaser(SpriteStore::Handle_t shooter, Sprite::SpriteAttr_t attr)
+{
+    if (!m_opponentsList.contains(shooter))
+    {
+        Logger::getInstance().log(Logger::WARNING, "laser shot from a discarded opponent ignored");
+        return;
+    }
+    opponentShootLaser(attr);
 }
 
 void Game::createPowerupDispersion(void)
@@ -227,8 +294,94 @@ void Game::createPowerupDispersion(void)
     assert(m_state == PLAYING);
     Sprite::SpriteAttr_t    attr;
     std::shared_ptr<Sprite> powerup = m_factory->getSprite(SpriteFactory::POWERUP, m_raylibPtr, attr);
-    powerup->setTextures(m_texturesMap["dispersion"]);
-    m_dispersionsList.push_back(powerup);
+    powerup->setTextures(m_textureSets.m_dispersion);
+    m_dispersionsList.add(powerup);
+}
+
+void Game::setBroadphase(BROADPHASE_t broadphase)
+{
+    m_broadphase = broadphase;
+}
+
+// the sprites already created are packed too
+void Game::setSpriteLayout(SpriteStore::LAYOUT_t layout)
+{
+    m_starsList.setLayout(layout, m_raylibPtr);
+    m_playerLasersList.setLayout(layout, m_raylibPtr);
+    m_meteorsList.setLayout(layout, m_raylibPtr);
+    m_explosionsList.setLayout(layout, m_raylibPtr);
+    m_opponentsList.setLayout(layout, m_raylibPtr);
+    m_opponentLasersList.setLayout(layout, m_raylibPtr);
+    m_dispersionsList.setLayout(layout, m_raylibPtr);
+    m_invincibilitiesList.setLayout(layout, m_raylibPtr);
+    m_extralifesList.setLayout(layout, m_raylibPtr);
+}
+
+void Game::setNarrowphase(NARROWPHASE_t narrowphase)
+{
+    m_narrowphase = narrowphase;
+}
+
+void Game::setTimestep(TIMESTEP_t timestep)
+{
+    m_timestep    = timestep;
+    m_accumulator = 0;
+}
+
+void Game::setTickRate(uint32_t ticksPerSecond)
+{
+    assert(ticksPerSecond > 0);
+    m_tickTime    = (1.0f / ticksPerSecond);
+    m_accumulator = 0;
+}
+
+// Scale the playing page for benchmarking: every meteor, opponent and player
+// laser spawn creates multiplier sprites, the opponent lasers follow the
+// opponents, and the stars are topped up to NUMBER_OF_STARS times multiplier.
+void Game::setSpawnMultiplier(uint32_t multiplier)
+{
+    assert(multiplier > 0);
+    m_spawnMultiplier = multiplier;
+    if (m_resourcesReady)
+    {
+        createStars();
+    }
+}
+
+// with UNLIMITED_LIVES the player is still hit, but the game never ends
+void Game::setLives(LIVES_t lives)
+{
+    m_livesMode = lives;
+}
+
+// With RETAINED_MENUS the welcome, settings and game over pages keep their
+// title, texts and buttons in render textures, see UiLayer, and draw the star
+// field and a single quad per frame.
+void Game::setMenuRendering(MENUS_t menus)
+{
+    if (menus == m_menus)
+    {
+        return;
+    }
+    m_menus = menus;
+    if (m_menus == RETAINED_MENUS)
+    {
+        createMenuLayers();
+    }
+    else
+    {
+        releaseMenuLayers();
+    }
+}
+
+Game::Stats_t Game::getStats(void) const
+{
+    return m_stats;
+}
+
+void Game::resetStats(void)
+{
+    m_stats = Stats_t();
 }
 #ifdef DEBUG_
 void Game::setState(STATE_t state)
@@ -237,406 +390,523 @@ void Game::setState(STATE_t state)
 }
 #endif
 
+// Only the font, needed by the first frame, is loaded here. The images and
+// sounds are queued on the loader and decoded in the background while the
+// loading page is shown, finishLoading() uploads them once they are all done.
 void Game::loadResources(void)
 {
+    PROFILE_ZONE("Game::loadResources");
     std::filesystem::path audioPath  = m_resourcePath / "audio";
     std::filesystem::path fontPath   = m_resourcePath / "font";
     std::filesystem::path imagesPath = m_resourcePath / "images";
 
-    m_texturesMap["player"]        = {m_raylibPtr->loadTexture((imagesPath / "spaceship.png").string())};
-    m_texturesMap["star"]          = {m_raylibPtr->loadTexture((imagesPath / "star.png").string())};
-    m_texturesMap["laser"]         = {m_raylibPtr->loadTexture((imagesPath / "laser.png").string())};
-    m_texturesMap["meteor"]        = {m_raylibPtr->loadTexture((imagesPath / "meteor.png").string())};
-    m_texturesMap["dispersion"]    = {m_raylibPtr->loadTexture((imagesPath / "dispersion.png").string())};
-    m_texturesMap["invincibility"] = {m_raylibPtr->loadTexture((imagesPath / "invincibility.png").string())};
+    // raylib copies what it needs of the font file
+    std::vector<uint8_t> fontBuffer;
+    uint32_t             fontSize = 0;
+    const uint8_t*       fontData = m_loader->read((fontPath / "Stormfaze.otf").string(), fontBuffer, fontSize);
+    if (fontData != nullptr)
+    {
+        m_fontType = m_raylibPtr->loadFontFromMemory(".otf", fontData, fontSize, GAME_OVER_FONTSIZE, NULL, 0);
+    }
+    else
+    {
+        m_fontType = m_raylibPtr->loadFontEx((fontPath / "Stormfaze.otf").string(), GAME_OVER_FONTSIZE, NULL, 0);
+    }
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> images = {
+        {"player", {(imagesPath / "spaceship.png").string()}},
+        {"star", {(imagesPath / "star.png").string()}},
+        {"laser", {(imagesPath / "laser.png").string()}},
+        {"meteor", {(imagesPath / "meteor.png").string()}},
+        {"dispersion", {(imagesPath / "dispersion.png").string()}},
+        {"invincibility", {(imagesPath / "invincibility.png").string()}},
+        {"explosion", {}}};
 
-    uint32_t               numberOfExplosionTextures = 28;
-    std::vector<Texture2D> explosionTextures(numberOfExplosionTextures);
+    uint32_t numberOfExplosionTextures = 28;
     for (uint32_t index = 0; index < numberOfExplosionTextures; index++)
     {
-        explosionTextures[index] = m_raylibPtr->loadTexture((imagesPath / "explosion" / (std::to_string(index + 1) + ".png")).string());
+        images.back().second.push_back((imagesPath / "explosion" / (std::to_string(index + 1) + ".png")).string());
     }
-    m_texturesMap["explosion"] = explosionTextures;
 
-    m_fontType           = m_raylibPtr->loadFontEx((fontPath / "Stormfaze.otf").string(), GAME_OVER_FONTSIZE, NULL, 0);
-    m_explosionSound     = m_raylibPtr->loadSound((audioPath / "explosion.wav").string());
-    m_laserSound         = m_raylibPtr->loadSound((audioPath / "laser.wav").string());
-    m_selectSound        = m_raylibPtr->loadSound((audioPath / "select.mp3").string());
-    m_dispersionSound    = m_raylibPtr->loadSound((audioPath / "dispersion.mp3").string());
-    m_invincibilitySound = m_raylibPtr->loadSound((audioPath / "invincibility.mp3").string());
-    m_extralifeSound     = m_raylibPtr->loadSound((audioPath / "extralife.mp3").string());
-    m_backGroundMusic    = m_raylibPtr->loadMusicStream((audioPath / "music.wav").string());
+    for (const auto& [name, fileNames] : images)
+    {
+        std::vector<AssetLoader::Handle_t> handles;
+        for (const std::string& fileName : fileNames)
+        {
+            handles.push_back(m_loader->add(AssetLoader::IMAGE, fileName));
+        }
+        m_imageHandles.push_back({name, handles});
+    }
 
-    m_raylibPtr->playMusicStream(m_backGroundMusic);
+    // in the order of the sounds in finishLoading()
+    for (std::string fileName : {"explosion.wav", "laser.wav", "select.mp3", "dispersion.mp3", "invincibility.mp3", "extralife.mp3"})
+    {
+        m_waveHandles.push_back(m_loader->add(AssetLoader::WAVE, (audioPath / fileName).string()));
+    }
 }
 
-void Game::unloadResources(void)
+// Upload the decoded images into the atlas and the decoded waves into sounds,
+// open the music stream, then create the sprites that need the textures.
+void Game::finishLoading(void)
 {
-    m_raylibPtr->unloadMusicStream(m_backGroundMusic);
-    m_raylibPtr->unloadSound(m_dispersionSound);
-    m_raylibPtr->unloadSound(m_invincibilitySound);
-    m_raylibPtr->unloadSound(m_extralifeSound);
-    m_raylibPtr->unloadSound(m_selectSound);
-    m_raylibPtr->unloadSound(m_laserSound);
-    m_raylibPtr->unloadSound(m_explosionSound);
-    m_raylibPtr->unloadFont(m_fontType);
+    PROFILE_ZONE("Game::finishLoading");
+    assert(!m_resourcesReady);
+    m_loader->wait();
 
-    for (uint32_t index = 0; index < m_texturesMap["explosion"].size(); index++)
+    // every image goes into the atlas, the sprites only get their frames in it
+    m_atlas = std::make_shared<TextureAtlas>(m_raylibPtr, ATLAS_PAGE_SIZE, ATLAS_PADDING);
+    for (const auto& [name, handles] : m_imageHandles)
     {
-        m_raylibPtr->unloadTexture(m_texturesMap["explosion"][index]);
+        std::vector<Image> images;
+        for (AssetLoader::Handle_t handle : handles)
+        {
+            images.push_back(m_loader->takeImage(handle));
+        }
+        m_atlas->add(name, images);
     }
-
-    m_raylibPtr->unloadTexture(m_texturesMap["invincibility"][0]);
-    m_raylibPtr->unloadTexture(m_texturesMap["dispersion"][0]);
-    m_raylibPtr->unloadTexture(m_texturesMap["meteor"][0]);
-    m_raylibPtr->unloadTexture(m_texturesMap["laser"][0]);
-    m_raylibPtr->unloadTexture(m_texturesMap["star"][0]);
-    m_raylibPtr->unloadTexture(m_texturesMap["player"][0]);
-}
-
-void Game::updatePlayingPage(void)
-{
-    m_meteorTimer->update();
-    m_dispersionTimer->update();
-    m_opponentTimer->update();
-    m_rampdownTimer->update();
-    m_player->update();
-    for (uint32_t index = 0; index < NUMBER_OF_STARS; index++)
+    m_atlas->build();
+
+    m_textureSets.m_player        = m_atlas->getFrames("player");
+    m_textureSets.m_star          = m_atlas->getFrames("star");
+    m_textureSets.m_laser         = m_atlas->getFrames("laser");
+    m_textureSets.m_meteor        = m_atlas->getFrames("meteor");
+    m_textureSets.m_dispersion    = m_atlas->getFrames("dispersion");
+    m_textureSets.m_invincibility = m_atlas->getFrames("invincibility");
+    m_textureSets.m_explosion     = m_atlas->getFrames("explosion");
+    m_imageHandles.clear();
+
+    std::vector<Sound*> sounds = {&m_explosionSound, &m_laserSound, &m_selectSound, &m_dispersionSound, &m_invincibilitySound, &m_extralifeSound};
+    for (uint32_t index = 0; index < sounds.size(); index++)
     {
-        m_starsList[index]->update();
+        Wave wave      = m_loader->takeWave(m_waveHandles[index]);
+        *sounds[index] = m_raylibPtr->loadSoundFromWave(wave);
+        m_raylibPtr->unloadWave(wave);
     }
-    for (uint32_t index = 0; index < m_playerLasersList.size(); index++)
+    m_waveHandles.clear();
+    if (m_soundPlayback == POOLED_VOICES)
     {
-        m_playerLasersList[index]->update();
+        createVoices();
     }
-    for (uint32_t index = 0; index < m_meteorsList.size(); index++)
+
+    // the music is streamed, opening it decodes nothing, and it is streamed from
+    // m_musicBuffer or the mapping of the archive when it comes from there
+    std::string    musicFile = (m_resourcePath / "audio" / "music.wav").string();
+    uint32_t       musicSize = 0;
+    const uint8_t* musicData = m_loader->read(musicFile, m_musicBuffer, musicSize);
+    if (musicData != nullptr)
     {
-        m_meteorsList[index]->update();
+        m_backGroundMusic = m_raylibPtr->loadMusicStreamFromMemory(".wav", musicData, musicSize);
     }
-    for (uint32_t index = 0; index < m_explosionsList.size(); index++)
+    else
     {
-        m_explosionsList[index]->update();
+        m_backGroundMusic = m_raylibPtr->loadMusicStream(musicFile);
     }
-    for (uint32_t index = 0; index < m_opponentsList.size(); index++)
+    m_raylibPtr->playMusicStream(m_backGroundMusic);
+
+    createStars();
+    if (m_player != nullptr)
     {
-        m_opponentsList[index]->update();
+        m_player->setTextures(m_textureSets.m_player);
     }
-    for (uint32_t index = 0; index < m_opponentLasersList.size(); index++)
+
+    m_resourcesReady = true;
+    m_state          = WELCOME;
+}
+
+// the buffers still being decoded are released by the loader
+void Game::unloadResources(void)
+{
+    PROFILE_ZONE("Game::unloadResources");
+    if (m_resourcesReady)
     {
-        m_opponentLasersList[index]->update();
+        m_voices = nullptr;
+        m_raylibPtr->unloadMusicStream(m_backGroundMusic);
+        m_raylibPtr->unloadSound(m_dispersionSound);
+        m_raylibPtr->unloadSound(m_invincibilitySound);
+        m_raylibPtr->unloadSound(m_extralifeSound);
+        m_raylibPtr->unloadSound(m_selectSound);
+        m_raylibPtr->unloadSound(m_laserSound);
+        m_raylibPtr->unloadSound(m_explosionSound);
     }
-    for (uint32_t index = 0; index < m_dispersionsList.size(); index++)
+    releaseMenuLayers();
+    m_raylibPtr->unloadFont(m_fontType);
+
+    if (m_resourcesReady)
     {
-        m_dispersionsList[index]->update();
+        m_textureSets = TextureSets_t();
+        m_atlas->unload();
     }
-    m_raylibPtr->updateMusicStream(m_backGroundMusic);
 }
 
-void Game::drawPlayingPage(void)
+// tickTime is the simulated time in seconds, 0 simulates raylib's frame time
+void Game::updatePlayingPage(float tickTime)
 {
-    m_raylibPtr->beginDrawing();
+    PROFILE_ZONE("Game::updatePlayingPage");
+    StatsTimer timer(m_stats.m_updateNs);
+    m_timers->advance((tickTime > 0) ? tickTime : m_raylibPtr->getFrameTime());
+    m_player->step(tickTime);
+    m_starsList.step(tickTime);
+    m_playerLasersList.step(tickTime);
+    m_meteorsList.step(tickTime);
+    m_explosionsList.step(tickTime);
+    m_opponentsList.step(tickTime);
+    m_opponentLasersList.step(tickTime);
+    m_dispersionsList.step(tickTime);
+
+    uint32_t sprites = liveSprites();
+    m_stats.m_ticks++;
+    m_stats.m_tickSprites += sprites;
+    m_stats.m_peakSprites  = std::max<uint64_t>(m_stats.m_peakSprites, sprites);
+}
 
-    m_raylibPtr->clearBackground(BLACK);
-    drawStars();
-    m_player->draw();
-    drawSprites();
-    drawStats();
+// blend places the moving sprites between their last two simulated positions
+void Game::drawPlayingPage(float blend)
+{
+    PROFILE_ZONE("Game::drawPlayingPage");
+    {
+        StatsTimer timer(m_stats.m_recordNs);
+        m_raylibPtr->beginDrawing();
+
+        m_raylibPtr->clearBackground(BLACK);
+        drawStars(blend);
+        m_player->drawBlended(blend);
+        drawSprites(blend);
+        drawStats();
+    }
+    m_stats.m_frames++;
+    m_stats.m_frameSprites += liveSprites();
+    m_stats.m_live          = liveCounts();
 
+    StatsTimer timer(m_stats.m_submitNs);
     m_raylibPtr->endDrawing();
 }
 
-void Game::drawStars(void)
+void Game::drawStars(float blend)
 {
-    for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
-    {
-        m_starsList[n]->draw();
-    }
+    m_starsList.drawBlended(blend);
 }
 
-void Game::drawSprites(void)
+void Game::drawSprites(float blend)
 {
-    for (uint32_t index = 0; index < m_playerLasersList.size(); index++)
-    {
-        m_playerLasersList[index]->draw();
-    }
-    for (uint32_t index = 0; index < m_meteorsList.size(); index++)
+    m_playerLasersList.drawBlended(blend);
+    m_meteorsList.drawBlended(blend);
+    m_explosionsList.drawBlended(blend);
+    m_opponentsList.drawBlended(blend);
+    m_opponentLasersList.drawBlended(blend);
+    m_dispersionsList.drawBlended(blend);
+}
+
+void Game::discardSprites(void)
+{
+    PROFILE_ZONE("Game::discardSprites");
+    m_playerLasersList.discardMarked(recycler(SpriteFactory::RED_LASER));
+    m_meteorsList.discardMarked(recycler(SpriteFactory::METEOR));
+    m_explosionsList.discardMarked(recycler(SpriteFactory::EXPLOSION));
+    m_opponentsList.discardMarked(recycler(SpriteFactory::OPPONENT));
+    m_opponentLasersList.discardMarked(recycler(SpriteFactory::YELLOW_LASER));
+    m_dispersionsList.discardMarked(recycler(SpriteFactory::POWERUP));
+}
+
+void Game::discardAllSprites(void)
+{
+    m_playerLasersList.clear(recycler(SpriteFactory::RED_LASER));
+    m_meteorsList.clear(recycler(SpriteFactory::METEOR));
+    m_explosionsList.clear(recycler(SpriteFactory::EXPLOSION));
+    m_opponentsList.clear(recycler(SpriteFactory::OPPONENT));
+    m_opponentLasersList.clear(recycler(SpriteFactory::YELLOW_LASER));
+    m_dispersionsList.clear(recycler(SpriteFactory::POWERUP));
+}
+
+// The captures fit in the small buffer of std::function, so handing out a
+// recycler every frame does not allocate.
+SpriteStore::Recycler_t Game::recycler(SpriteFactory::SpriteType type)
+{
+    return [this, type](std::shared_ptr<Sprite> sprite) { m_factory->recycleSprite(type, sprite); };
+}
+
+// the player and the sprites of every store
+uint32_t Game::liveSprites(void) const
+{
+    return (1 + m_starsList.size() + m_playerLasersList.size() + m_meteorsList.size() + m_explosionsList.size() + m_opponentsList.size() +
+            m_opponentLasersList.size() + m_dispersionsList.size());
+}
+
+Game::LiveCounts_t Game::liveCounts(void) const
+{
+    LiveCounts_t counts;
+    counts.m_playerLasers   = m_playerLasersList.size();
+    counts.m_meteors        = m_meteorsList.size();
+    counts.m_explosions     = m_explosionsList.size();
+    counts.m_opponents      = m_opponentsList.size();
+    counts.m_opponentLasers = m_opponentLasersList.size();
+    counts.m_dispersions    = m_dispersionsList.size();
+    return counts;
+}
+
+// Whatever leaves the playfield, in any direction, is discarded once it is
+// wholly past the margin of its type. The enemies spawn above the playfield
+// and the opponents shoot from there, so their margin covers the spawn band.
+// The stars wrap around and the explosions expire on their own.
+void Game::cullSprites(void)
+{
+    m_stats.m_culled += m_playerLasersList.cull(worldBounds(PLAYER_LASER_CULL_MARGIN));
+    m_stats.m_culled += m_meteorsList.cull(worldBounds(ENEMY_CULL_MARGIN));
+    m_stats.m_culled += m_opponentsList.cull(worldBounds(ENEMY_CULL_MARGIN));
+    m_stats.m_culled += m_opponentLasersList.cull(worldBounds(ENEMY_CULL_MARGIN));
+    m_stats.m_culled += m_dispersionsList.cull(worldBounds(ENEMY_CULL_MARGIN));
+}
+
+void Game::spawn(void (Game::*create)(void))
+{
+    if (m_state != PLAYING)
     {
-        m_meteorsList[index]->draw();
+        return;
     }
-    for (uint32_t index = 0; index < m_explosionsList.size(); index++)
+    for (uint32_t count = 0; count < m_spawnMultiplier; count++)
     {
-        m_explosionsList[index]->draw();
+        (this->*create)();
     }
-    for (uint32_t index = 0; index < m_opponentsList.size(); index++)
+}
+
+void Game::createStars(void)
+{
+    Sprite::SpriteAttr_t attr;
+    while (m_starsList.size() < (NUMBER_OF_STARS * m_spawnMultiplier))
     {
-        m_opponentsList[index]->draw();
+        std::shared_ptr<Sprite> star = m_factory->getSprite(SpriteFactory::STAR, m_raylibPtr, attr);
+        star->setTextures(m_textureSets.m_star);
+        m_starsList.add(star);
     }
-    for (uint32_t index = 0; index < m_opponentLasersList.size(); index++)
+}
+
+void Game::loseLife(void)
+{
+    if (m_livesMode == UNLIMITED_LIVES)
     {
-        m_opponentLasersList[index]->draw();
+        return;
     }
-    for (uint32_t index = 0; index < m_dispersionsList.size(); index++)
+    m_lives--;
+    if (m_lives == 0)
     {
-        m_dispersionsList[index]->draw();
+        m_timers->activate(m_rampdownTimer);
     }
 }
 
-void Game::discardSprites(void)
+void Game::checkCollisions(void)
 {
-    for (auto it = m_playerLasersList.begin(); it != m_playerLasersList.end();)
+    PROFILE_ZONE("Game::checkCollisions");
+    StatsTimer timer(m_stats.m_collisionNs);
+    m_playerLasersList.sync();
+    m_meteorsList.sync();
+    m_opponentsList.sync();
+    m_opponentLasersList.sync();
+    m_dispersionsList.sync();
+    cullSprites();
+
+    if (m_broadphase == UNIFORM_GRID)
     {
-        if ((*(*it)).m_discard)
-        {
-            it = m_playerLasersList.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+        m_meteorsGrid.build(m_meteorsList);
+        m_opponentsGrid.build(m_opponentsList);
+        m_opponentLasersGrid.build(m_opponentLasersList);
+        m_dispersionsGrid.build(m_dispersionsList);
     }
-    for (auto it = m_meteorsList.begin(); it != m_meteorsList.end();)
+
+    for (uint32_t ilaser = 0; ilaser < m_playerLasersList.size(); ilaser++)
     {
-        if ((*(*it)).m_discard)
+        if (m_playerLasersList.isCulled(ilaser))
         {
-            it = m_meteorsList.erase(it);
+            continue;
         }
-        else
-        {
-            ++it;
-        }
-    }
-    for (auto it = m_explosionsList.begin(); it != m_explosionsList.end();)
-    {
-        if ((*(*it)).m_discard)
+        Rectangle laserRect = m_playerLasersList.getRect(ilaser);
+
+        collisionCandidates(m_meteorsList, m_meteorsGrid, laserRect);
+        circlesHitByRect(m_meteorsList, laserRect);
+        for (uint32_t imeteor : m_hits)
         {
-            it = m_explosionsList.erase(it);
+            m_playerLasersList.discard(ilaser);
+            m_meteorsList.discard(imeteor);
+            createExplosion(m_meteorsList.getCenter(imeteor), 2);
+
+            m_score++;
         }
-        else
+
+        collisionCandidates(m_opponentsList, m_opponentsGrid, laserRect);
+        circlesHitByRect(m_opponentsList, laserRect);
+        for (uint32_t ioppo : m_hits)
         {
-            ++it;
+            m_playerLasersList.discard(ilaser);
+            m_opponentsList.discard(ioppo);
+            createExplosion(m_opponentsList.getCenter(ioppo), 3);
+
+            m_score += 10;
         }
     }
-    for (auto it = m_opponentsList.begin(); it != m_opponentsList.end();)
+
+    bool playerVulnerable = !(m_player->m_discard) && ((m_meteorsList.size() + m_opponentLasersList.size() + m_opponentsList.size()) > 0);
+    if ((m_dispersionsList.size() == 0) && !playerVulnerable)
     {
-        if ((*(*it)).m_discard)
-        {
-            it = m_opponentsList.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+        return;
     }
-    for (auto it = m_opponentLasersList.begin(); it != m_opponentLasersList.end();)
+
+    float     playerRadius = m_player->getRadius();
+    Vector2   playerCenter = m_player->getCenter();
+    Rectangle playerBounds = {playerCenter.x - playerRadius, playerCenter.y - playerRadius, 2 * playerRadius, 2 * playerRadius};
+
+    collisionCandidates(m_dispersionsList, m_dispersionsGrid, playerBounds);
+    circlesHitByCircle(m_dispersionsList, playerCenter, playerRadius);
+    for (uint32_t index : m_hits)
     {
-        if ((*(*it)).m_discard)
-        {
-            it = m_opponentLasersList.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+        m_dispersionsList.discard(index);
+        m_player->setDispersedlaser();
+        playSound(m_dispersionSound, m_dispersionVoice);
     }
-    for (auto it = m_dispersionsList.begin(); it != m_dispersionsList.end();)
+
+    if (playerVulnerable)
     {
-        if ((*(*it)).m_discard)
+        collisionCandidates(m_meteorsList, m_meteorsGrid, playerBounds);
+        circlesHitByCircle(m_meteorsList, playerCenter, playerRadius);
+        for (uint32_t index : m_hits)
         {
-            it = m_dispersionsList.erase(it);
+            loseLife();
+            m_meteorsList.discard(index);
+            m_player->m_discard = true;
+            createExplosion(playerCenter, 3);
         }
-        else
+
+        collisionCandidates(m_opponentLasersList, m_opponentLasersGrid, playerBounds);
+        rectsHitByCircle(m_opponentLasersList, playerCenter, playerRadius);
+        for (uint32_t ilaser : m_hits)
         {
-            ++it;
+            loseLife();
+            m_opponentLasersList.discard(ilaser);
+            m_player->m_discard = true;
+            createExplosion(playerCenter, 3);
+        }
+
+        collisionCandidates(m_opponentsList, m_opponentsGrid, playerBounds);
+        circlesHitByCircle(m_opponentsList, playerCenter, playerRadius);
+        for (uint32_t index : m_hits)
+        {
+            loseLife();
+            m_opponentsList.discard(index);
+            m_player->m_discard = true;
+            createExplosion(playerCenter, 3);
         }
     }
 }
 
-void Game::discardAllSprites(void)
+// Fill m_candidates with the indices of the sprites of store that may collide
+// with area: every sprite for the brute-force path, the neighbour cells of
+// area for the grid. Either way the narrow-phase checks stay the same. The
+// sprites culled this frame are left out, they are already off the playfield.
+void Game::collisionCandidates(const SpriteStore& store, CollisionGrid& grid, Rectangle area)
 {
-    for (auto it = m_playerLasersList.begin(); it != m_playerLasersList.end();)
+    if (m_broadphase == UNIFORM_GRID)
     {
-        it = m_playerLasersList.erase(it);
+        grid.query(area, m_candidates);
     }
-    for (auto it = m_meteorsList.begin(); it != m_meteorsList.end();)
-    {
-        it = m_meteorsList.erase(it);
-    }
-    for (auto it = m_explosionsList.begin(); it != m_explosionsList.end();)
-    {
-        it = m_explosionsList.erase(it);
-    }
-    for (auto it = m_opponentsList.begin(); it != m_opponentsList.end();)
-    {
-        it = m_opponentsList.erase(it);
-    }
-    for (auto it = m_opponentLasersList.begin(); it != m_opponentLasersList.end();)
-    {
-        it = m_opponentLasersList.erase(it);
-    }
-    for (auto it = m_dispersionsList.begin(); it != m_dispersionsList.end();)
+    else
     {
-        it = m_dispersionsList.erase(it);
+        m_candidates.resize(store.size());
+        for (uint32_t index = 0; index < store.size(); index++)
+        {
+            m_candidates[index] = index;
+        }
     }
+
+    std::erase_if(m_candidates, [&store](uint32_t index) { return store.isCulled(index); });
 }
 
-void Game::checkCollisions(void)
+// The narrowphase helpers fill m_hits with the candidates that do collide with
+// the given shape, in candidate order, through the batched kernels or one
+// RaylibInterface call per candidate.
+void Game::circlesHitByRect(const SpriteStore& circles, Rectangle rect)
 {
-    for (uint32_t ilaser = 0; ilaser < m_playerLasersList.size(); ilaser++)
+    if (m_narrowphase == BATCHED_KERNELS)
     {
-        for (uint32_t imeteor = 0; imeteor < m_meteorsList.size(); imeteor++)
-        {
-            if (m_raylibPtr->checkCollisionCircleRec(m_meteorsList[imeteor]->getCenter(),
-                                                     m_meteorsList[imeteor]->getRadius(),
-                                                     m_playerLasersList[ilaser]->getRect()))
-            {
-                m_playerLasersList[ilaser]->m_discard = true;
-                m_meteorsList[imeteor]->m_discard     = true;
-
-                Sprite::SpriteAttr_t attr;
-                attr.m_position                   = m_meteorsList[imeteor]->getCenter();
-                attr.m_scale                      = 2;
-                std::shared_ptr<Sprite> explosion = m_factory->getSprite(SpriteFactory::EXPLOSION, m_raylibPtr, attr);
-                explosion->setTextures(m_texturesMap["explosion"]);
-                m_explosionsList.push_back(explosion);
-                m_raylibPtr->playSound(m_explosionSound);
-
-                m_score++;
-            }
-        }
+        m_kernels.circlesVsRect(circles.circleBatch(), m_candidates, rect, m_hits);
+        return;
+    }
 
-        for (uint32_t ioppo = 0; ioppo < m_opponentsList.size(); ioppo++)
+    m_hits.clear();
+    for (uint32_t index : m_candidates)
+    {
+        if (m_raylibPtr->checkCollisionCircleRec(circles.getCenter(index), circles.getRadius(index), rect))
         {
-            if (m_raylibPtr->checkCollisionCircleRec(m_opponentsList[ioppo]->getCenter(),
-                                                     m_opponentsList[ioppo]->getRadius(),
-                                                     m_playerLasersList[ilaser]->getRect()))
-            {
-                m_playerLasersList[ilaser]->m_discard = true;
-                m_opponentsList[ioppo]->m_discard     = true;
-
-                Sprite::SpriteAttr_t attr;
-                attr.m_position                   = m_opponentsList[ioppo]->getCenter();
-                attr.m_scale                      = 3;
-                std::shared_ptr<Sprite> explosion = m_factory->getSprite(SpriteFactory::EXPLOSION, m_raylibPtr, attr);
-                explosion->setTextures(m_texturesMap["explosion"]);
-                m_explosionsList.push_back(explosion);
-                m_raylibPtr->playSound(m_explosionSound);
-
-                m_score += 10;
-            }
+            m_hits.push_back(index);
         }
     }
+}
 
-    for (uint32_t index = 0; index < m_dispersionsList.size(); index++)
+void Game::circlesHitByCircle(const SpriteStore& circles, Vector2 center, float radius)
+{
+    if (m_narrowphase == BATCHED_KERNELS)
     {
-        if (m_raylibPtr->checkCollisionCircles(m_player->getCenter(),
-                                               m_player->getRadius(),
-                                               m_dispersionsList[index]->getCenter(),
-                                               m_dispersionsList[index]->getRadius()))
-        {
-            m_dispersionsList[index]->m_discard = true;
-            m_player->setDispersedlaser();
-            m_raylibPtr->playSound(m_dispersionSound);
-        }
+        m_kernels.circlesVsCircle(circles.circleBatch(), m_candidates, center, radius, m_hits);
+        return;
     }
 
-    if (!(m_player->m_discard))
+    m_hits.clear();
+    for (uint32_t index : m_candidates)
     {
-        for (uint32_t index = 0; index < m_meteorsList.size(); index++)
+        if (m_raylibPtr->checkCollisionCircles(center, radius, circles.getCenter(index), circles.getRadius(index)))
         {
-            if (m_raylibPtr->checkCollisionCircles(m_player->getCenter(),
-                                                   m_player->getRadius(),
-                                                   m_meteorsList[index]->getCenter(),
-                                                   m_meteorsList[index]->getRadius()))
-            {
-                m_lives--;
-                if (m_lives == 0)
-                {
-                    m_rampdownTimer->activate();
-                }
-                m_meteorsList[index]->m_discard = true;
-                m_player->m_discard             = true;
-
-                Sprite::SpriteAttr_t attr;
-                attr.m_position                   = m_player->getCenter();
-                attr.m_scale                      = 3;
-                std::shared_ptr<Sprite> explosion = m_factory->getSprite(SpriteFactory::EXPLOSION, m_raylibPtr, attr);
-                explosion->setTextures(m_texturesMap["explosion"]);
-                m_explosionsList.push_back(explosion);
-                m_raylibPtr->playSound(m_explosionSound);
-            }
+            m_hits.push_back(index);
         }
+    }
+}
 
-        for (uint32_t ilaser = 0; ilaser < m_opponentLasersList.size(); ilaser++)
-        {
-            if (m_raylibPtr->checkCollisionCircleRec(m_player->getCenter(),
-                                                     m_player->getRadius(),
-                                                     m_opponentLasersList[ilaser]->getRect()))
-            {
-                m_lives--;
-                if (m_lives == 0)
-                {
-                    m_rampdownTimer->activate();
-                }
-                m_opponentLasersList[ilaser]->m_discard = true;
-                m_player->m_discard                     = true;
-
-                Sprite::SpriteAttr_t attr;
-                attr.m_position                   = m_player->getCenter();
-                attr.m_scale                      = 3;
-                std::shared_ptr<Sprite> explosion = m_factory->getSprite(SpriteFactory::EXPLOSION, m_raylibPtr, attr);
-                explosion->setTextures(m_texturesMap["explosion"]);
-                m_explosionsList.push_back(explosion);
-                m_raylibPtr->playSound(m_explosionSound);
-            }
-        }
+void Game::rectsHitByCircle(const SpriteStore& rects, Vector2 center, float radius)
+{
+    if (m_narrowphase == BATCHED_KERNELS)
+    {
+        m_kernels.rectsVsCircle(rects.rectBatch(), m_candidates, center, radius, m_hits);
+        return;
+    }
 
-        for (uint32_t index = 0; index < m_opponentsList.size(); index++)
+    m_hits.clear();
+    for (uint32_t index : m_candidates)
+    {
+        if (m_raylibPtr->checkCollisionCircleRec(center, radius, rects.getRect(index)))
         {
-            if (m_raylibPtr->checkCollisionCircles(m_player->getCenter(),
-                                                   m_player->getRadius(),
-                                                   m_opponentsList[index]->getCenter(),
-                                                   m_opponentsList[index]->getRadius()))
-            {
-                m_lives--;
-                if (m_lives == 0)
-                {
-                    m_rampdownTimer->activate();
-                }
-                m_opponentsList[index]->m_discard = true;
-                m_player->m_discard               = true;
-
-                Sprite::SpriteAttr_t attr;
-                attr.m_position                   = m_player->getCenter();
-                attr.m_scale                      = 3;
-                std::shared_ptr<Sprite> explosion = m_factory->getSprite(SpriteFactory::EXPLOSION, m_raylibPtr, attr);
-                explosion->setTextures(m_texturesMap["explosion"]);
-                m_explosionsList.push_back(explosion);
-                m_raylibPtr->playSound(m_explosionSound);
-            }
+            m_hits.push_back(index);
         }
     }
 }
 
+void Game::createExplosion(Vector2 position, float scale)
+{
+    Sprite::SpriteAttr_t attr;
+    attr.m_position                   = position;
+    attr.m_scale                      = scale;
+    std::shared_ptr<Sprite> explosion = m_factory->getSprite(SpriteFactory::EXPLOSION, m_raylibPtr, attr);
+    explosion->setTextures(m_textureSets.m_explosion);
+    m_explosionsList.add(explosion);
+    playSound(m_explosionSound, m_explosionVoice);
+}
+
 void Game::drawStats(void)
 {
-    m_raylibPtr->drawTextEx(m_fontType,
-                            "lives: " + std::format("{:>5}", std::to_string(m_lives)),
-                            Vector2((WINDOW_WIDTH - 150), 30),
-                            STAT_FONTSIZE,
-                            0,
-                            WHITE);
+    if (m_livesTextValue != m_lives)
+    {
+        m_livesTextValue = m_lives;
+        m_livesText      = "lives: " + std::format("{:>5}", std::to_string(m_lives));
+    }
+    if (m_scoreTextValue != m_score)
+    {
+        m_scoreTextValue = m_score;
+        m_scoreText      = "score: " + std::format("{:>4}", std::to_string(m_score));
+    }
 
-    m_raylibPtr->drawTextEx(m_fontType,
-                            "score: " + std::format("{:>4}", std::to_string(m_score)),
-                            Vector2((WINDOW_WIDTH - 150), (30 + STAT_FONTSIZE)),
-                            STAT_FONTSIZE,
-                            0,
-                            WHITE);
+    m_raylibPtr->drawTextEx(m_fontType, m_livesText, Vector2((WINDOW_WIDTH - 150), 30), STAT_FONTSIZE, 0, WHITE);
+    m_raylibPtr->drawTextEx(m_fontType, m_scoreText, Vector2((WINDOW_WIDTH - 150), (30 + STAT_FONTSIZE)), STAT_FONTSIZE, 0, WHITE);
 }
 
+// a button whose background changed is drawn again into its layer
 void Game::checkButtonUpdate(GameButton_t& button)
 {
-    Vector2 mousePosition = m_raylibPtr->getMousePosition();
+    Vector2 mousePosition   = m_raylibPtr->getMousePosition();
+    Color   backgroundColor = button.m_backgroundColor;
 
     if (m_raylibPtr->checkCollisionPointRec(mousePosition, button.m_selectArea))
     {
@@ -649,7 +919,7 @@ void Game::checkButtonUpdate(GameButton_t& button)
 
         if (!(button.m_selectSoundPlayed))
         {
-            m_raylibPtr->playSound(m_selectSound);
+            playSound(m_selectSound, m_selectVoice);
             button.m_selectSoundPlayed = true;
         }
     }
@@ -662,14 +932,91 @@ void Game::checkButtonUpdate(GameButton_t& button)
             button.m_selectSoundPlayed = false;
         }
     }
+
+    if ((button.m_layer != nullptr) && !sameColor(backgroundColor, button.m_backgroundColor))
+    {
+        button.m_layer->invalidate(button.m_widget);
+    }
 }
 
-void Game::drawButton(GameButton_t button)
+void Game::drawButton(const GameButton_t& button)
 {
     m_raylibPtr->drawRectangleRounded(button.m_selectArea, 0.2, 0, button.m_backgroundColor);
     m_raylibPtr->drawTextEx(m_fontType, button.m_displayText, button.m_position, button.m_textSize, 0, LIGHTGRAY);
 }
 
+// The sounds triggered during a frame are played at its end, see VoicePool.
+// Set before the sounds are loaded or after.
+void Game::setSoundPlayback(SOUNDS_t sounds)
+{
+    m_soundPlayback = sounds;
+    m_voices        = nullptr;
+    if ((m_soundPlayback == POOLED_VOICES) && m_resourcesReady)
+    {
+        createVoices();
+    }
+}
+
+void Game::createVoices(void)
+{
+    m_voices             = std::make_shared<VoicePool>(m_raylibPtr);
+    m_explosionVoice     = m_voices->add(m_explosionSound, EXPLOSION_VOICES);
+    m_laserVoice         = m_voices->add(m_laserSound, LASER_VOICES);
+    m_selectVoice        = m_voices->add(m_selectSound, EFFECT_VOICES);
+    m_dispersionVoice    = m_voices->add(m_dispersionSound, EFFECT_VOICES);
+    m_invincibilityVoice = m_voices->add(m_invincibilitySound, EFFECT_VOICES);
+    m_extralifeVoice     = m_voices->add(m_extralifeSound, EFFECT_VOICES);
+}
+
+void Game::playSound(Sound sound, uint32_t voice)
+{
+    if (m_voices != nullptr)
+    {
+        m_voices->play(voice);
+    }
+    else
+    {
+        m_raylibPtr->playSound(sound);
+    }
+}
+
+void Game::addButton(std::shared_ptr<UiLayer> layer, GameButton_t& button)
+{
+    button.m_layer  = layer;
+    button.m_widget = layer->add(button.m_selectArea, [this, &button](void) { drawButton(button); });
+}
+
+void Game::createMenuLayers(void)
+{
+    m_welcomeLayer = std::make_shared<UiLayer>(m_raylibPtr, WINDOW_WIDTH, WINDOW_HEIGHT);
+    m_welcomeLayer->add(Rectangle(0, m_titlePosition.y, WINDOW_WIDTH, GAME_TITLE_FONTSIZE),
+                        [this](void) { m_raylibPtr->drawTextEx(m_fontType, m_gameName, m_titlePosition, GAME_TITLE_FONTSIZE, 0, GOLD); });
+    addButton(m_welcomeLayer, m_startButton);
+    addButton(m_welcomeLayer, m_settingsButton);
+    addButton(m_welcomeLayer, m_quitButton);
+
+    m_settingsLayer = std::make_shared<UiLayer>(m_raylibPtr, WINDOW_WIDTH, WINDOW_HEIGHT);
+    m_settingsLayer->add(m_settingsPageBackground, [this](void) { m_raylibPtr->drawRectangleRounded(m_settingsPageBackground, 0.05, 0, {30, 30, 30, 200}); });
+    m_settingsLayer->add(m_settingsPageBackground, [this](void) { drawSettingsText(); });
+    addButton(m_settingsLayer, m_backButton);
+
+    // the game over text scrolls in, it is drawn every frame
+    m_gameoverLayer = std::make_shared<UiLayer>(m_raylibPtr, WINDOW_WIDTH, WINDOW_HEIGHT);
+    addButton(m_gameoverLayer, m_newgameButton);
+    addButton(m_gameoverLayer, m_gameoverQuitButton);
+}
+
+void Game::releaseMenuLayers(void)
+{
+    for (GameButton_t* button : {&m_startButton, &m_settingsButton, &m_quitButton, &m_backButton, &m_newgameButton, &m_gameoverQuitButton})
+    {
+        button->m_layer = nullptr;
+    }
+    m_welcomeLayer  = nullptr;
+    m_settingsLayer = nullptr;
+    m_gameoverLayer = nullptr;
+}
+
 void Game::drawSettingsText(void)
 {
     std::string row1col1 = "Spacebar";
@@ -694,29 +1041,88 @@ void Game::gameoverReset(void)
 
 void Game::refreshPlayingPage(void)
 {
-    discardSprites();
-    updatePlayingPage();
-    drawPlayingPage();
-    checkCollisions();
+    PROFILE_ZONE("Game::refreshPlayingPage");
+    if (m_timestep == VARIABLE_STEP)
+    {
+        discardSprites();
+        updatePlayingPage(0);
+        updateMusic();
+        drawPlayingPage(1);
+        checkCollisions();
+        return;
+    }
+
+    // Spend the frame time in whole ticks, at most MAX_TICKS_PER_FRAME of them so
+    // that a long frame is not followed by an even longer one. Collisions are
+    // resolved within each tick, so their outcome does not depend on the frame rate.
+    // The game over ramp down ends the ticks of the frame.
+    m_accumulator = std::min((m_accumulator + m_raylibPtr->getFrameTime()), (MAX_TICKS_PER_FRAME * m_tickTime));
+    m_player->latchInput();
+    while ((m_accumulator >= m_tickTime) && (m_state == PLAYING))
+    {
+        updatePlayingPage(m_tickTime);
+        checkCollisions();
+        discardSprites();
+        m_accumulator -= m_tickTime;
+    }
+    updateMusic();
+    drawPlayingPage(m_accumulator / m_tickTime);
 }
 
-void Game::refreshWelcomePage(void)
+void Game::updateMusic(void)
 {
-    for (uint32_t index = 0; index < NUMBER_OF_STARS; index++)
+    PROFILE_ZONE("Game::updateMusic");
+    m_raylibPtr->updateMusicStream(m_backGroundMusic);
+}
+
+// shown from the first frame until the loader has decoded every file
+void Game::refreshLoadingPage(void)
+{
+    PROFILE_ZONE("Game::refreshLoadingPage");
+    if (m_loader->isDone())
     {
-        m_starsList[index]->update();
+        finishLoading();
+        return;
     }
 
+    Rectangle bar      = {m_titlePosition.x + 20, ((WINDOW_HEIGHT / 2) - 30), 280, 20};
+    Rectangle progress = {bar.x, bar.y, (bar.width * m_loader->getProgress()), bar.height};
+
+    m_raylibPtr->beginDrawing();
+
+    m_raylibPtr->clearBackground(BLACK);
+    m_raylibPtr->drawTextEx(m_fontType, m_gameName, m_titlePosition, GAME_TITLE_FONTSIZE, 0, GOLD);
+    m_raylibPtr->drawRectangleRounded(bar, 0.5, 0, DARKGRAY);
+    m_raylibPtr->drawRectangleRounded(progress, 0.5, 0, GOLD);
+
+    m_raylibPtr->endDrawing();
+}
+
+void Game::refreshWelcomePage(void)
+{
+    PROFILE_ZONE("Game::refreshWelcomePage");
+    m_starsList.update();
+
     checkButtonUpdate(m_startButton);
     checkButtonUpdate(m_settingsButton);
     checkButtonUpdate(m_quitButton);
 
-    m_raylibPtr->updateMusicStream(m_backGroundMusic);
+    updateMusic();
 
     m_raylibPtr->beginDrawing();
 
+    if (m_welcomeLayer != nullptr)
+    {
+        m_welcomeLayer->update();
+        m_raylibPtr->clearBackground(BLACK);
+        drawStars(1);
+        m_welcomeLayer->draw();
+        m_raylibPtr->endDrawing();
+        return;
+    }
+
     m_raylibPtr->clearBackground(BLACK);
-    drawStars();
+    drawStars(1);
     m_raylibPtr->drawTextEx(m_fontType, m_gameName, m_titlePosition, GAME_TITLE_FONTSIZE, 0, GOLD);
     drawButton(m_startButton);
     drawButton(m_settingsButton);
@@ -727,18 +1133,26 @@ void Game::refreshWelcomePage(void)
 
 void Game::refreshSettingsPage(void)
 {
-    for (uint32_t index = 0; index < NUMBER_OF_STARS; index++)
-    {
-        m_starsList[index]->update();
-    }
+    PROFILE_ZONE("Game::refreshSettingsPage");
+    m_starsList.update();
 
     checkButtonUpdate(m_backButton);
-    m_raylibPtr->updateMusicStream(m_backGroundMusic);
+    updateMusic();
 
     m_raylibPtr->beginDrawing();
 
+    if (m_settingsLayer != nullptr)
+    {
+        m_settingsLayer->update();
+        m_raylibPtr->clearBackground(BLACK);
+        drawStars(1);
+        m_settingsLayer->draw();
+        m_raylibPtr->endDrawing();
+        return;
+    }
+
     m_raylibPtr->clearBackground(BLACK);
-    drawStars();
+    drawStars(1);
     m_raylibPtr->drawRectangleRounded(m_settingsPageBackground, 0.05, 0, {30, 30, 30, 200});
     drawSettingsText();
     drawButton(m_backButton);
@@ -747,10 +1161,8 @@ void Game::refreshSettingsPage(void)
 
 void Game::refreshGameOverPage(void)
 {
-    for (uint32_t index = 0; index < NUMBER_OF_STARS; index++)
-    {
-        m_starsList[index]->update();
-    }
+    PROFILE_ZONE("Game::refreshGameOverPage");
+    m_starsList.update();
 
     if (m_gameoverTextPosition.y > m_gameoverTextMaxHeight)
     {
@@ -763,14 +1175,22 @@ void Game::refreshGameOverPage(void)
         checkButtonUpdate(m_gameoverQuitButton);
     }
 
-    m_raylibPtr->updateMusicStream(m_backGroundMusic);
+    updateMusic();
 
     m_raylibPtr->beginDrawing();
 
+    if (m_gameoverLayer != nullptr)
+    {
+        m_gameoverLayer->update();
+    }
     m_raylibPtr->clearBackground(BLACK);
-    drawStars();
+    drawStars(1);
     m_raylibPtr->drawTextEx(m_fontType, m_gameoverText, m_gameoverTextPosition, GAME_OVER_FONTSIZE, 0, RED);
-    if (m_gameoverTextPosition.y == m_gameoverTextMaxHeight)
+    if ((m_gameoverTextPosition.y == m_gameoverTextMaxHeight) && (m_gameoverLayer != nullptr))
+    {
+        m_gameoverLayer->draw();
+    }
+    else if (m_gameoverTextPosition.y == m_gameoverTextMaxHeight)
     {
         drawButton(m_newgameButton);
         drawButton(m_gameoverQuitButton);
@@ -0,0 +1,329 @@
+#include "InputRecorder.h"
+#include <cassert>
+
+InputRecorder::InputRecorder(std::shared_ptr<RaylibInterface> raylibPtr, const std::string& fileName, uint64_t seed)
+{
+    assert(raylibPtr != nullptr);
+    m_raylibPtr = raylibPtr;
+    m_writer    = std::make_shared<Replay::Writer>(fileName, seed);
+}
+
+bool InputRecorder::isRecording(void) const
+{
+    return m_writer->isOpen();
+}
+
+// the frames recorded so far are the whole session
+void InputRecorder::stop(void)
+{
+    m_writer->close();
+}
+
+double InputRecorder::getTime(void)
+{
+    return m_raylibPtr->getTime();
+}
+
+void InputRecorder::initWindow(int width, int height, std::string title)
+{
+    m_raylibPtr->initWindow(width, height, title);
+}
+
+void InputRecorder::closeWindow(void)
+{
+    m_raylibPtr->closeWindow();
+    stop();
+}
+
+Texture2D InputRecorder::loadTexture(std::string filename)
+{
+    return m_raylibPtr->loadTexture(filename);
+}
+
+void InputRecorder::unloadTexture(Texture2D texture)
+{
+    m_raylibPtr->unloadTexture(texture);
+}
+
+bool InputRecorder::windowShouldClose(void)
+{
+    return m_raylibPtr->windowShouldClose();
+}
+
+float InputRecorder::getFrameTime(void)
+{
+    m_frame.m_frameTime = m_raylibPtr->getFrameTime();
+    return m_frame.m_frameTime;
+}
+
+void InputRecorder::beginDrawing(void)
+{
+    m_raylibPtr->beginDrawing();
+}
+
+void InputRecorder::clearBackground(Color color)
+{
+    m_raylibPtr->clearBackground(color);
+}
+
+// The frame is over, what was queried during it makes a frame of the replay.
+// The frame time and the mouse position hold until they are queried again.
+void InputRecorder::endDrawing(void)
+{
+    m_raylibPtr->endDrawing();
+    m_writer->write(m_frame);
+    m_frame.m_keysDown.reset();
+    m_frame.m_keysPressed.reset();
+    m_frame.m_mousePressed = 0;
+}
+
+void InputRecorder::drawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    m_raylibPtr->drawTextureV(texture, position, tint);
+}
+
+bool InputRecorder::isKeyDown(int key)
+{
+    bool down = m_raylibPtr->isKeyDown(key);
+    if (down && (key > 0) && (key < (int)Replay::MAX_KEYS))
+    {
+        m_frame.m_keysDown[key] = true;
+    }
+    return down;
+}
+
+bool InputRecorder::isWindowReady(void)
+{
+    return m_raylibPtr->isWindowReady();
+}
+
+void InputRecorder::drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    m_raylibPtr->drawTextureEx(texture, position, rotation, scale, tint);
+}
+
+bool InputRecorder::isKeyPressed(int key)
+{
+    bool pressed = m_raylibPtr->isKeyPressed(key);
+    if (pressed && (key > 0) && (key < (int)Replay::MAX_KEYS))
+    {
+        m_frame.m_keysPressed[key] = true;
+    }
+    return pressed;
+}
+
+bool InputRecorder::checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    return m_raylibPtr->checkCollisionCircles(center1, radius1, center2, radius2);
+}
+
+bool InputRecorder::checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
+{
+    return m_raylibPtr->checkCollisionCircleRec(center, radius, rec);
+}
+
+void InputRecorder::drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    m_raylibPtr->drawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+Font InputRecorder::loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount)
+{
+    return m_raylibPtr->loadFontEx(fileName, fontSize, codepoints, codepointCount);
+}
+
+void InputRecorder::drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    m_raylibPtr->drawTextEx(font, text, position, fontSize, spacing, tint);
+}
+
+void InputRecorder::unloadFont(Font font)
+{
+    m_raylibPtr->unloadFont(font);
+}
+
+void InputRecorder::initAudioDevice(void)
+{
+    m_raylibPtr->initAudioDevice();
+}
+
+void InputRecorder::closeAudioDevice(void)
+{
+    m_raylibPtr->closeAudioDevice();
+}
+
+Sound InputRecorder::loadSound(std::string fileName)
+{
+    return m_raylibPtr->loadSound(fileName);
+}
+
+void InputRecorder::playSound(Sound sound)
+{
+    m_raylibPtr->playSound(sound);
+}
+
+void InputRecorder::unloadSound(Sound sound)
+{
+    m_raylibPtr->unloadSound(sound);
+}
+
+Music InputRecorder::loadMusicStream(std::string fileName)
+{
+    return m_raylibPtr->loadMusicStream(fileName);
+}
+
+void InputRecorder::unloadMusicStream(Music music)
+{
+    m_raylibPtr->unloadMusicStream(music);
+}
+
+void InputRecorder::updateMusicStream(Music music)
+{
+    m_raylibPtr->updateMusicStream(music);
+}
+
+void InputRecorder::playMusicStream(Music music)
+{
+    m_raylibPtr->playMusicStream(music);
+}
+
+void InputRecorder::drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    m_raylibPtr->drawRectangleRounded(rec, roundness, segments, color);
+}
+
+Vector2 InputRecorder::getMousePosition(void)
+{
+    m_frame.m_mousePosition = m_raylibPtr->getMousePosition();
+    return m_frame.m_mousePosition;
+}
+
+bool InputRecorder::checkCollisionPointRec(Vector2 point, Rectangle rec)
+{
+    return m_raylibPtr->checkCollisionPointRec(point, rec);
+}
+
+bool InputRecorder::isMouseButtonPressed(int button)
+{
+    bool pressed = m_raylibPtr->isMouseButtonPressed(button);
+    if (pressed && (button >= 0) && (button < (int)Replay::MAX_MOUSE_BUTTONS))
+    {
+        m_frame.m_mousePressed |= (uint8_t)(1 << button);
+    }
+    return pressed;
+}
+
+Vector2 InputRecorder::measureTextEx(Font font, std::string text, float fontSize, float spacing)
+{
+    return m_raylibPtr->measureTextEx(font, text, fontSize, spacing);
+}
+
+Image InputRecorder::loadImage(std::string fileName)
+{
+    return m_raylibPtr->loadImage(fileName);
+}
+
+void InputRecorder::unloadImage(Image image)
+{
+    m_raylibPtr->unloadImage(image);
+}
+
+Image InputRecorder::genImageColor(int width, int height, Color color)
+{
+    return m_raylibPtr->genImageColor(width, height, color);
+}
+
+void InputRecorder::imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    m_raylibPtr->imageDraw(dst, src, srcRec, dstRec, tint);
+}
+
+Texture2D InputRecorder::loadTextureFromImage(Image image)
+{
+    return m_raylibPtr->loadTextureFromImage(image);
+}
+
+Wave InputRecorder::loadWave(std::string fileName)
+{
+    return m_raylibPtr->loadWave(fileName);
+}
+
+void InputRecorder::unloadWave(Wave wave)
+{
+    m_raylibPtr->unloadWave(wave);
+}
+
+Sound InputRecorder::loadSoundFromWave(Wave wave)
+{
+    return m_raylibPtr->loadSoundFromWave(wave);
+}
+
+Image InputRecorder::loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    return m_raylibPtr->loadImageFromMemory(fileType, fileData, dataSize);
+}
+
+Wave InputRecorder::loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    return m_raylibPtr->loadWaveFromMemory(fileType, fileData, dataSize);
+}
+
+Font InputRecorder::loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount)
+{
+    return m_raylibPtr->loadFontFromMemory(fileType, fileData, dataSize, fontSize, codepoints, codepointCount);
+}
+
+Music InputRecorder::loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize)
+{
+    return m_raylibPtr->loadMusicStreamFromMemory(fileType, data, dataSize);
+}
+
+RenderTexture2D InputRecorder::loadRenderTexture(int width, int height)
+{
+    return m_raylibPtr->loadRenderTexture(width, height);
+}
+
+void InputRecorder::unloadRenderTexture(RenderTexture2D target)
+{
+    m_raylibPtr->unloadRenderTexture(target);
+}
+
+void InputRecorder::beginTextureMode(RenderTexture2D target)
+{
+    m_raylibPtr->beginTextureMode(target);
+}
+
+void InputRecorder::endTextureMode(void)
+{
+    m_raylibPtr->endTextureMode();
+}
+
+void InputRecorder::beginScissorMode(int x, int y, int width, int height)
+{
+    m_raylibPtr->beginScissorMode(x, y, width, height);
+}
+
+void InputRecorder::endScissorMode(void)
+{
+    m_raylibPtr->endScissorMode();
+}
+
+void InputRecorder::drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint)
+{
+    m_raylibPtr->drawRenderTexture(target, position, tint);
+}
+
+Sound InputRecorder::loadSoundAlias(Sound source)
+{
+    return m_raylibPtr->loadSoundAlias(source);
+}
+
+void InputRecorder::unloadSoundAlias(Sound alias)
+{
+    m_raylibPtr->unloadSoundAlias(alias);
+}
+
+void InputRecorder::setSoundVolume(Sound sound, float volume)
+{
+    m_raylibPtr->setSoundVolume(sound, volume);
+}
@@ -11,16 +11,28 @@ Laser::Laser(std::shared_ptr<RaylibInterface> raylibPtr,
 {
     assert(raylibPtr->isWindowReady());
     m_raylibPtr = raylibPtr;
-    m_position  = position;
-    m_direction = direction;
-    m_rotation  = rotation;
-    m_color     = color;
     m_speed     = LASER_SPEED;
+
+    Sprite::SpriteAttr_t attr;
+    attr.m_position  = position;
+    attr.m_direction = direction;
+    attr.m_rotation  = rotation;
+    attr.m_color     = color;
+    reset(attr);
+}
+
+void Laser::reset(Sprite::SpriteAttr_t attr)
+{
+    m_position  = attr.m_position;
+    m_direction = attr.m_direction;
+    m_rotation  = attr.m_rotation;
+    m_color     = attr.m_color;
+    m_discard   = false;
 }
 
 void Laser::move(void)
 {
-    float dt      = m_raylibPtr->getFrameTime();
+    float dt      = frameTime();
     m_position.x += m_direction.x * m_speed * dt;
     m_position.y += m_direction.y * m_speed * dt;
 }
@@ -29,17 +41,12 @@ void Laser::update(void)
 {
     assert(m_textures.size() == 1);
     move();
-
-    if ((m_position.y + m_textures[0].height) < 0)
-    {
-        m_discard = true;
-    }
 }
 
 void Laser::draw(void)
 {
     assert(m_textures.size() == 1);
-    m_raylibPtr->drawTextureEx(m_textures[0], m_position, m_rotation, 1, m_color);
+    drawFrame(m_textures[0], drawPosition(), m_rotation, 1, m_color);
 }
 
 Vector2 Laser::getCenter(void)
@@ -57,12 +64,26 @@ float Laser::getRadius(void)
 Rectangle Laser::getRect(void)
 {
     assert(m_textures.size() == 1);
-    return (Rectangle(m_position.x, m_position.y, m_textures[0].width, m_textures[0].height));
+    return (Rectangle(m_position.x, m_position.y, m_textures[0].m_source.width, m_textures[0].m_source.height));
+}
+
+Sprite::Body_t Laser::getBody(void)
+{
+    assert(m_textures.size() == 1);
+    Body_t body;
+    body.m_frames    = m_textures;
+    body.m_position  = m_position;
+    body.m_direction = m_direction;
+    body.m_speed     = m_speed;
+    body.m_rotation  = m_rotation;
+    body.m_tint      = m_color;
+    body.m_size      = Vector2(m_textures[0].m_source.width, m_textures[0].m_source.height);
+    return body;
 }
 
-void Laser::setTextures(std::vector<Texture2D> textures)
+void Laser::setTextures(TextureAtlas::Frames_t textures)
 {
     assert(textures.size() == 1);
     m_textures = textures;
-    m_position = {m_position.x + m_textures[0].width, m_position.y + m_textures[0].height};
+    m_position = {m_position.x + m_textures[0].m_source.width, m_position.y + m_textures[0].m_source.height};
 }
@@ -1,8 +1,9 @@
 #include "Logger.h"
-#include <chrono>
-#include <ctime>
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 
 Logger& Logger::getInstance(void)
 {
@@ -16,6 +17,8 @@ Logger::Logger(void)
 
 Logger::~Logger(void)
 {
+    // everything logged so far is written before the file is closed
+    stopWorker();
     if (m_logFile.is_open())
     {
         m_logFile.close();
@@ -24,7 +27,6 @@ Logger::~Logger(void)
 
 void Logger::setVerbosityLevel(int level)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
     m_verbosityLevel = level;
 }
 
@@ -51,19 +53,216 @@ void Logger::setLogFile(const std::string& logFilePath)
     }
 }
 
+// Switch between synchronous and asynchronous logging. Leaving ASYNCHRONOUS
+// writes every message already logged. Not to be called while other threads log.
+void Logger::setMode(MODE_t mode, OVERFLOW_t overflow)
+{
+    stopWorker();
+    m_overflow = overflow;
+
+    if (mode == ASYNCHRONOUS)
+    {
+        if (m_queue == nullptr)
+        {
+            m_queue = std::make_unique<Record_t[]>(QUEUE_CAPACITY);
+            for (uint32_t index = 0; index < QUEUE_CAPACITY; index++)
+            {
+                m_queue[index].m_sequence.store(index, std::memory_order_relaxed);
+            }
+        }
+        m_stop         = false;
+        m_asynchronous = true;
+        m_worker       = std::thread(&Logger::consume, this);
+    }
+}
+
 // Log a message with the specified verbosity level
 void Logger::log(int level, const std::string& message)
 {
+    if (level < m_verbosityLevel.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    if (m_asynchronous.load(std::memory_order_relaxed))
+    {
+        while (!push(level, message))
+        {
+            // wake the background thread early, it may be sleeping on a full ring; the
+            // flag is set under the lock so the wait predicate cannot miss it
+            if (!m_ringFull.load(std::memory_order_relaxed))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_workerMutex);
+                    m_ringFull.store(true, std::memory_order_relaxed);
+                }
+                m_wakeup.notify_one();
+            }
+            if (m_overflow != BLOCK)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            std::this_thread::yield();
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
-    if (level >= m_verbosityLevel)
+    write(format(level, std::chrono::system_clock::now(), message));
+}
+
+// Block until every message logged before the call is written.
+void Logger::flush(void)
+{
+    if (!m_asynchronous)
+    {
+        return;
+    }
+
+    uint64_t                     target = m_enqueuePosition.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(m_workerMutex);
+    m_flushRequested = true;
+    m_wakeup.notify_one();
+    m_flushed.wait(lock, [this, target] { return (m_written.load(std::memory_order_acquire) >= target); });
+}
+
+uint64_t Logger::getDroppedCount(void) const
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+// Claim the next position and copy the message into its record, the message is
+// truncated to MESSAGE_SIZE characters. Returns false if the ring is full.
+bool Logger::push(int level, const std::string& message)
+{
+    uint64_t  position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Record_t* record   = nullptr;
+
+    while (true)
+    {
+        record            = &m_queue[position & (QUEUE_CAPACITY - 1)];
+        uint64_t sequence = record->m_sequence.load(std::memory_order_acquire);
+
+        if (sequence == position)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position)
+        {
+            return false;
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->m_level  = level;
+    record->m_time   = std::chrono::system_clock::now();
+    record->m_length = std::min((uint32_t)message.size(), MESSAGE_SIZE);
+    std::memcpy(record->m_message, message.data(), record->m_length);
+    record->m_sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+// background thread of ASYNCHRONOUS mode
+void Logger::consume(void)
+{
+    std::string                  batch;
+    std::unique_lock<std::mutex> lock(m_workerMutex);
+
+    while (true)
+    {
+        bool stop = m_stop;
+        lock.unlock();
+
+        drain(batch);
+        if (stop)
+        {
+            // wait for the producers that claimed a record but have not filled it yet
+            while (m_dequeuePosition != m_enqueuePosition.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+                drain(batch);
+            }
+        }
+
+        lock.lock();
+        m_flushed.notify_all();
+        if (stop)
+        {
+            break;
+        }
+        m_wakeup.wait_for(lock, FLUSH_INTERVAL, [this] { return (m_stop || m_flushRequested || m_ringFull); });
+        m_flushRequested = false;
+        m_ringFull       = false;
+    }
+}
+
+// format and write every ready record, then report the messages dropped so far
+void Logger::drain(std::string& batch)
+{
+    batch.clear();
+    while (true)
+    {
+        Record_t& record = m_queue[m_dequeuePosition & (QUEUE_CAPACITY - 1)];
+        if (record.m_sequence.load(std::memory_order_acquire) != (m_dequeuePosition + 1))
+        {
+            break;
+        }
+
+        batch += format(record.m_level, record.m_time, std::string_view(record.m_message, record.m_length));
+        record.m_sequence.store(m_dequeuePosition + QUEUE_CAPACITY, std::memory_order_release);
+        m_dequeuePosition++;
+    }
+
+    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+    if ((m_overflow == COUNT_DROPPED) && (dropped > m_droppedReported))
+    {
+        batch += format(Logger::WARNING, std::chrono::system_clock::now(), std::to_string(dropped - m_droppedReported) + " log messages dropped");
+        m_droppedReported = dropped;
+    }
+
+    if (!batch.empty())
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        write(batch);
+    }
+    m_written.store(m_dequeuePosition, std::memory_order_release);
+}
+
+void Logger::stopWorker(void)
+{
+    if (!m_worker.joinable())
+    {
+        return;
+    }
+
+    m_asynchronous = false;
+    {
+        std::lock_guard<std::mutex> lock(m_workerMutex);
+        m_stop = true;
+    }
+    m_wakeup.notify_one();
+    m_worker.join();
+}
+
+// The local time is only formatted once per second. Called with m_mutex held or
+// from the background thread.
+std::string Logger::format(int level, std::chrono::system_clock::time_point time, std::string_view message)
+{
+    std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    if ((seconds != m_stampTime) || m_stamp.empty())
     {
-        auto               now  = std::chrono::system_clock::now();
-        auto               time = std::chrono::system_clock::to_time_t(now);
         std::ostringstream oss;
 
 #ifdef _WIN32
         std::tm tm_buf;
-        if (localtime_s(&tm_buf, &time) != 0)
+        if (localtime_s(&tm_buf, &seconds) != 0)
         {
             oss << "[ERROR: Failed to get local time] ";
         }
@@ -72,47 +271,55 @@ void Logger::log(int level, const std::string& message)
             oss << "[" << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S") << "] ";
         }
 #else
-        std::tm* tm_ptr = std::localtime(&time);
-        if (!tm_ptr)
+        std::tm tm_buf;
+        if (localtime_r(&seconds, &tm_buf) == nullptr)
         {
             oss << "[ERROR: Failed to get local time] ";
         }
         else
         {
-            oss << "[" << std::put_time(tm_ptr, "%Y-%m-%d %H:%M:%S") << "] ";
+            oss << "[" << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S") << "] ";
         }
 #endif
 
-        // Format the log message
-        std::string logMessage = "";
-        switch (level)
-        {
-            case Logger::DEBUG:
-                logMessage += "[DEBUG] ";
-                break;
-            case Logger::INFO:
-                logMessage += "[INFO] ";
-                break;
-            case Logger::WARNING:
-                logMessage += "\033[33m[WARNING] ";
-                break;
-            case Logger::ERROR:
-                logMessage += "\033[31m[ERROR] ";
-                break;
-            case Logger::FATAL:
-                logMessage += "\033[31m[FATAL] ";
-                break;
-        }
-        logMessage += oss.str().substr(0, 24) + " " + message + "\033[0m\n";
+        m_stampTime = seconds;
+        m_stamp     = oss.str().substr(0, 24);
+    }
 
-        // Print the log message to the console
-        std::cout << logMessage;
+    // Format the log message
+    std::string logMessage = "";
+    switch (level)
+    {
+        case Logger::DEBUG:
+            logMessage += "[DEBUG] ";
+            break;
+        case Logger::INFO:
+            logMessage += "[INFO] ";
+            break;
+        case Logger::WARNING:
+            logMessage += "\033[33m[WARNING] ";
+            break;
+        case Logger::ERROR:
+            logMessage += "\033[31m[ERROR] ";
+            break;
+        case Logger::FATAL:
+            logMessage += "\033[31m[FATAL] ";
+            break;
+    }
+    logMessage += m_stamp + " ";
+    logMessage += message;
+    logMessage += "\033[0m\n";
+    return logMessage;
+}
 
-        // Write the log message to the file if it's open
-        if (m_logFile.is_open())
-        {
-            m_logFile << logMessage;
-            m_logFile.flush();
-        }
+// Print to the console and write to the file if it's open, called with m_mutex held
+void Logger::write(const std::string& text)
+{
+    std::cout << text;
+
+    if (m_logFile.is_open())
+    {
+        m_logFile << text;
+        m_logFile.flush();
     }
 }
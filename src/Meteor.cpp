@@ -1,51 +1,43 @@
 #include "Meteor.h"
 #include <cassert>
-#include <random>
-#include "GameSettings.h"
 
-Meteor::Meteor(std::shared_ptr<RaylibInterface> raylibPtr)
+Meteor::Meteor(std::shared_ptr<RaylibInterface> raylibPtr, Sprite::SpriteAttr_t attr)
 {
     assert(raylibPtr->isWindowReady());
     m_raylibPtr = raylibPtr;
+    reset(attr);
+}
 
-    // Random number generator
-    std::random_device rd;
-    std::mt19937       gen(rd()); // Mersenne Twister engine
-
-    std::uniform_int_distribution<>       distX(0, WINDOW_WIDTH);
-    std::uniform_int_distribution<>       distY(-150, -50);
-    std::uniform_int_distribution<>       distSpeed(300, 400);
-    std::uniform_real_distribution<float> distDirection(-0.5, 0.5);
-
-    m_position  = {(float)distX(gen), (float)distY(gen)};
-    m_speed     = distSpeed(gen);
-    m_direction = {distDirection(gen), 1};
+void Meteor::reset(Sprite::SpriteAttr_t attr)
+{
+    // the spawn position, speed and direction are drawn by SpriteFactory
+    m_position  = attr.m_position;
+    m_speed     = attr.m_speed;
+    m_direction = attr.m_direction;
+    m_rotation  = 0;
+    m_discard   = false;
 }
 
 void Meteor::move(void)
 {
-    float dt      = m_raylibPtr->getFrameTime();
+    float dt      = frameTime();
     m_position.x += m_direction.x * m_speed * dt;
     m_position.y += m_direction.y * m_speed * dt;
-    m_rotation   += 50 * dt;
+    m_rotation   += SPIN_SPEED * dt;
 }
 
 void Meteor::update(void)
 {
     assert(m_textures.size() == 1);
     move();
-
-    if ((m_position.y - m_textures[0].height) > WINDOW_HEIGHT)
-    {
-        m_discard = true;
-    }
 }
 
 void Meteor::draw(void)
 {
     assert(m_textures.size() == 1);
-    Rectangle targetRect = Rectangle(m_position.x, m_position.y, m_textures[0].width, m_textures[0].height);
-    m_raylibPtr->drawTexturePro(m_textures[0], m_rect, targetRect, m_origin, m_rotation, WHITE);
+    Vector2   position   = drawPosition();
+    Rectangle targetRect = Rectangle(position.x, position.y, m_textures[0].m_source.width, m_textures[0].m_source.height);
+    m_raylibPtr->drawTexturePro(m_textures[0].m_texture, m_textures[0].m_source, targetRect, m_origin, m_rotation, WHITE);
 }
 
 Vector2 Meteor::getCenter(void)
@@ -66,11 +58,25 @@ Rectangle Meteor::getRect(void)
     return (Rectangle(0, 0, 0, 0));
 }
 
-void Meteor::setTextures(std::vector<Texture2D> textures)
+Sprite::Body_t Meteor::getBody(void)
+{
+    assert(m_textures.size() == 1);
+    Body_t body;
+    body.m_frames    = m_textures;
+    body.m_position  = m_position;
+    body.m_direction = m_direction;
+    body.m_speed     = m_speed;
+    body.m_rotation  = m_rotation;
+    body.m_spin      = SPIN_SPEED;
+    body.m_origin    = m_origin;
+    body.m_radius    = m_radius;
+    return body;
+}
+
+void Meteor::setTextures(TextureAtlas::Frames_t textures)
 {
     assert(textures.size() == 1);
     m_textures = textures;
-    m_radius   = (float)(std::min(m_textures[0].width, m_textures[0].height)) / 2;
-    m_rect     = Rectangle(0, 0, m_textures[0].width, m_textures[0].height);
-    m_origin   = Vector2(m_textures[0].width / 2, m_textures[0].height / 2);
+    m_radius   = (float)(std::min(m_textures[0].m_source.width, m_textures[0].m_source.height)) / 2;
+    m_origin   = Vector2(m_textures[0].m_source.width / 2, m_textures[0].m_source.height / 2);
 }
@@ -1,42 +1,51 @@
 #include "Opponent.h"
 #include <cassert>
-#include <random>
 #include "GameSettings.h"
 
 Opponent::Opponent(std::shared_ptr<RaylibInterface>          raylibPtr,
-                   std::function<void(Sprite::SpriteAttr_t)> shootLaser)
+                   std::function<void(Sprite::SpriteAttr_t)> shootLaser,
+                   Sprite::SpriteAttr_t                      attr)
 {
     assert(raylibPtr->isWindowReady());
-    assert(shootLaser);
     m_raylibPtr     = raylibPtr;
-    m_shootLaser    = shootLaser;
     m_direction     = {0, 1};
     m_speed         = OPPONENT_SPEED;
     m_laserInterval = 3000;
+    setShootLaser(shootLaser);
+    reset(attr);
+}
 
-    // Random number generator
-    std::random_device rd;
-    std::mt19937       gen(rd()); // Mersenne Twister engine
-
-    std::uniform_int_distribution<> distX(0, WINDOW_WIDTH);
-    std::uniform_int_distribution<> distY(-150, -50);
+void Opponent::setShootLaser(std::function<void(Sprite::SpriteAttr_t)> shootLaser)
+{
+    assert(shootLaser);
+    m_shootLaser = shootLaser;
+}
 
-    m_position = {(float)distX(gen), (float)distY(gen)};
+void Opponent::reset(Sprite::SpriteAttr_t attr)
+{
+    // the spawn position is drawn by SpriteFactory
+    m_position        = attr.m_position;
+    m_intervalCounter = 0;
+    m_discard         = false;
 }
 
 void Opponent::move(void)
 {
-    float dt      = m_raylibPtr->getFrameTime();
+    float dt      = frameTime();
     m_position.x += m_direction.x * m_speed * dt;
     m_position.y += m_direction.y * m_speed * dt;
+    shootOnInterval();
+}
 
+void Opponent::shootOnInterval(void)
+{
     m_intervalCounter++;
 
     if (m_intervalCounter >= m_laserInterval)
     {
         Sprite::SpriteAttr_t laserAttr;
-        laserAttr.m_position.x = m_position.x - (m_textures[0].width * 0.66);
-        laserAttr.m_position.y = m_position.y - (m_textures[0].height * 0.66);
+        laserAttr.m_position.x = m_position.x - (m_textures[0].m_source.width * 0.66);
+        laserAttr.m_position.y = m_position.y - (m_textures[0].m_source.height * 0.66);
 
         laserAttr.m_direction = {0, 1};
         laserAttr.m_rotation  = 0;
@@ -58,24 +67,26 @@ void Opponent::update(void)
 {
     assert(m_textures.size() == 1);
     move();
+}
 
-    if ((m_position.y - m_textures[0].height) > WINDOW_HEIGHT)
-    {
-        m_discard = true;
-    }
+void Opponent::act(Vector2 position)
+{
+    assert(m_textures.size() == 1);
+    m_position = position;
+    shootOnInterval();
 }
 
 void Opponent::draw(void)
 {
     assert(m_textures.size() == 1);
-    m_raylibPtr->drawTextureEx(m_textures[0], m_position, 180, 1, RED);
+    drawFrame(m_textures[0], drawPosition(), 180, 1, RED);
 }
 
 Vector2 Opponent::getCenter(void)
 {
     assert(m_textures.size() == 1);
-    return (Vector2((m_position.x - ((float)(m_textures[0].width) * 0.4)),
-                    (m_position.y - ((float)(m_textures[0].height) * 0.4))));
+    return (Vector2((m_position.x - ((float)(m_textures[0].m_source.width) * 0.4)),
+                    (m_position.y - ((float)(m_textures[0].m_source.height) * 0.4))));
 }
 
 float Opponent::getRadius(void)
@@ -90,9 +101,25 @@ Rectangle Opponent::getRect(void)
     return (Rectangle(0, 0, 0, 0));
 }
 
-void Opponent::setTextures(std::vector<Texture2D> textures)
+Sprite::Body_t Opponent::getBody(void)
+{
+    assert(m_textures.size() == 1);
+    Body_t body;
+    body.m_frames    = m_textures;
+    body.m_position  = m_position;
+    body.m_direction = m_direction;
+    body.m_speed     = m_speed;
+    body.m_rotation  = 180;
+    body.m_tint      = RED;
+    body.m_offset    = Vector2(-((float)(m_textures[0].m_source.width) * 0.4), -((float)(m_textures[0].m_source.height) * 0.4));
+    body.m_radius    = m_radius;
+    body.m_acts      = true;
+    return body;
+}
+
+void Opponent::setTextures(TextureAtlas::Frames_t textures)
 {
     assert(textures.size() == 1);
     m_textures = textures;
-    m_radius   = (float)(std::min(m_textures[0].width, m_textures[0].height)) / 2;
+    m_radius   = (float)(std::min(m_textures[0].m_source.width, m_textures[0].m_source.height)) / 2;
 }
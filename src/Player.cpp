@@ -2,47 +2,58 @@
 #include <algorithm>
 #include <cassert>
 #include "GameSettings.h"
-#include "Timer.h"
+#include "TimerWheel.h"
 
 Player::Player(std::shared_ptr<RaylibInterface>          raylibPtr,
+               std::shared_ptr<TimerWheel>               timersPtr,
                std::function<void(Sprite::SpriteAttr_t)> shootLaser)
 {
     assert(raylibPtr->isWindowReady());
+    assert(timersPtr != nullptr);
     assert(shootLaser);
     m_raylibPtr  = raylibPtr;
+    m_timers     = timersPtr;
     m_shootLaser = shootLaser;
     m_speed      = PLAYER_SPEED;
 
-    std::function<void(void)> renderWarmupCallback        = std::bind(&Player::renderWarmup, this);
-    std::function<void(void)> renderVincibleCallback      = std::bind(&Player::renderPlayable, this);
-    std::function<void(void)> resetDispersedlaserCallback = std::bind(&Player::resetDispersedlaser, this);
-
-    m_invisibleTimer      = std::make_shared<Timer>(m_raylibPtr, 1, false, false, renderWarmupCallback);
-    m_warmupTimer         = std::make_shared<Timer>(m_raylibPtr, 4, false, false, renderVincibleCallback);
-    m_dispersedLaserTimer = std::make_shared<Timer>(m_raylibPtr, 15, false, false, resetDispersedlaserCallback);
+    m_invisibleTimer      = m_timers->add(1, false, false, [this](void) { renderWarmup(); });
+    m_warmupTimer         = m_timers->add(4, false, false, [this](void) { renderPlayable(); });
+    m_dispersedLaserTimer = m_timers->add(15, false, false, [this](void) { resetDispersedlaser(); });
 
     m_state   = PLAYABLE;
     m_discard = true;
 }
 
+Player::~Player(void)
+{
+    m_timers->remove(m_dispersedLaserTimer);
+    m_timers->remove(m_warmupTimer);
+    m_timers->remove(m_invisibleTimer);
+}
+
+void Player::latchInput(void)
+{
+    m_inputLatched = true;
+    m_shootLatched = m_shootLatched || m_raylibPtr->isKeyPressed(KEY_SPACE);
+}
+
 void Player::input(void)
 {
     m_direction.x = int(m_raylibPtr->isKeyDown(KEY_RIGHT)) - int(m_raylibPtr->isKeyDown(KEY_LEFT));
     m_direction.y = int(m_raylibPtr->isKeyDown(KEY_DOWN)) - int(m_raylibPtr->isKeyDown(KEY_UP));
 
-    if (m_raylibPtr->isKeyPressed(KEY_SPACE))
+    bool shoot = m_inputLatched ? m_shootLatched : m_raylibPtr->isKeyPressed(KEY_SPACE);
+    if (shoot)
     {
         Sprite::SpriteAttr_t laserAttr;
-        laserAttr.m_position.x = m_position.x + (m_textures[0].width / 2);
-        laserAttr.m_position.y = m_position.y - (m_textures[0].height / 2);
+        laserAttr.m_position.x = m_position.x + (m_textures[0].m_source.width / 2);
+        laserAttr.m_position.y = m_position.y - (m_textures[0].m_source.height / 2);
         laserAttr.m_direction  = {0, -1};
         laserAttr.m_rotation   = 180;
         m_shootLaser(laserAttr);
 
         if (m_dispersedLaser)
         {
-            m_dispersedLaserTimer->update();
-
             laserAttr.m_direction = {-0.25, -1};
             laserAttr.m_rotation  = 173.875;
             m_shootLaser(laserAttr);
@@ -56,7 +67,7 @@ void Player::input(void)
 
 void Player::move(void)
 {
-    float dt      = m_raylibPtr->getFrameTime();
+    float dt      = frameTime();
     m_position.x += m_direction.x * m_speed * dt;
     m_position.y += m_direction.y * m_speed * dt;
     m_position.x  = std::clamp(m_position.x, (float)0, m_maxXPos);
@@ -77,7 +88,8 @@ void Player::update(void)
                 m_dispersedLaser = false;
                 m_position.x     = m_startXPos;
                 m_position.y     = WINDOW_HEIGHT + 100;
-                m_invisibleTimer->activate();
+                settle();
+                m_timers->activate(m_invisibleTimer);
             }
             else
             {
@@ -88,7 +100,6 @@ void Player::update(void)
         }
 
         case INVISIBLE:
-            m_invisibleTimer->update();
             break;
 
         case MOVE_IN:
@@ -99,7 +110,6 @@ void Player::update(void)
         {
             input();
             move();
-            m_warmupTimer->update();
             break;
         }
 
@@ -108,6 +118,9 @@ void Player::update(void)
             assert(false);
             break;
     }
+
+    // a latched press is used by this tick or dropped
+    m_shootLatched = false;
 }
 
 void Player::draw(void)
@@ -117,7 +130,7 @@ void Player::draw(void)
     switch (m_state)
     {
         case PLAYABLE:
-            m_raylibPtr->drawTextureV(m_textures[0], m_position, WHITE);
+            drawFrame(m_textures[0], drawPosition(), 0, 1, WHITE);
             break;
 
         case INVISIBLE:
@@ -126,7 +139,7 @@ void Player::draw(void)
         case MOVE_IN:
         case WARMUP:
         case INVINCIBLE:
-            m_raylibPtr->drawTextureV(m_textures[0], m_position, DARKGRAY);
+            drawFrame(m_textures[0], drawPosition(), 0, 1, DARKGRAY);
             break;
 
         default:
@@ -138,8 +151,8 @@ void Player::draw(void)
 Vector2 Player::getCenter(void)
 {
     assert(m_textures.size() == 1);
-    return (Vector2((m_position.x + ((float)(m_textures[0].width) / 2)),
-                    (m_position.y + ((float)(m_textures[0].height) / 2))));
+    return (Vector2((m_position.x + ((float)(m_textures[0].m_source.width) / 2)),
+                    (m_position.y + ((float)(m_textures[0].m_source.height) / 2))));
 }
 
 float Player::getRadius(void)
@@ -148,19 +161,19 @@ float Player::getRadius(void)
     return m_radius;
 }
 
-void Player::setTextures(std::vector<Texture2D> textures)
+void Player::setTextures(TextureAtlas::Frames_t textures)
 {
     assert(textures.size() == 1);
     m_textures  = textures;
-    m_maxXPos   = (float)(WINDOW_WIDTH - m_textures[0].width);
-    m_maxYPos   = (float)(WINDOW_HEIGHT - m_textures[0].height);
+    m_maxXPos   = (float)(WINDOW_WIDTH - m_textures[0].m_source.width);
+    m_maxYPos   = (float)(WINDOW_HEIGHT - m_textures[0].m_source.height);
     m_startXPos = (m_maxXPos / 2);
     m_startYPos = (m_maxYPos - 100);
 
     m_position.x = m_startXPos;
     m_position.y = m_startYPos;
 
-    m_radius = (float)(std::min(m_textures[0].width, m_textures[0].height)) / 2;
+    m_radius = (float)(std::min(m_textures[0].m_source.width, m_textures[0].m_source.height)) / 2;
 }
 
 void Player::setInvincible(void)
@@ -173,7 +186,7 @@ void Player::setDispersedlaser(void)
     if (m_state != INVISIBLE)
     {
         m_dispersedLaser = true;
-        m_dispersedLaserTimer->activate();
+        m_timers->activate(m_dispersedLaserTimer);
     }
 }
 
@@ -185,7 +198,7 @@ void Player::resetDispersedlaser(void)
 void Player::moveIntoWindow(void)
 {
     assert(m_state == MOVE_IN);
-    float dt      = m_raylibPtr->getFrameTime();
+    float dt      = frameTime();
     m_position.y += (-1) * m_speed * dt;
 
     if (m_position.y <= m_startYPos)
@@ -198,7 +211,7 @@ void Player::renderWarmup(void)
 {
     assert(m_state == INVISIBLE);
     m_state = MOVE_IN;
-    m_warmupTimer->activate();
+    m_timers->activate(m_warmupTimer);
 }
 
 void Player::renderPlayable(void)
@@ -1,30 +1,25 @@
 #include "Powerup.h"
 #include <cassert>
-#include <random>
-#include "GameSettings.h"
 
-Powerup::Powerup(std::shared_ptr<RaylibInterface> raylibPtr)
+Powerup::Powerup(std::shared_ptr<RaylibInterface> raylibPtr, Sprite::SpriteAttr_t attr)
 {
     assert(raylibPtr->isWindowReady());
     m_raylibPtr = raylibPtr;
+    reset(attr);
+}
 
-    // Random number generator
-    std::random_device rd;
-    std::mt19937       gen(rd()); // Mersenne Twister engine
-
-    std::uniform_int_distribution<>       distX(0, WINDOW_WIDTH);
-    std::uniform_int_distribution<>       distY(-150, -50);
-    std::uniform_int_distribution<>       distSpeed(350, 450);
-    std::uniform_real_distribution<float> distDirection(-0.5, 0.5);
-
-    m_position  = {(float)distX(gen), 0};
-    m_speed     = distSpeed(gen);
-    m_direction = {distDirection(gen), 1};
+void Powerup::reset(Sprite::SpriteAttr_t attr)
+{
+    // the spawn position, speed and direction are drawn by SpriteFactory
+    m_position  = attr.m_position;
+    m_speed     = attr.m_speed;
+    m_direction = attr.m_direction;
+    m_discard   = false;
 }
 
 void Powerup::move(void)
 {
-    float dt      = m_raylibPtr->getFrameTime();
+    float dt      = frameTime();
     m_position.x += m_direction.x * m_speed * dt;
     m_position.y += m_direction.y * m_speed * dt;
 }
@@ -33,17 +28,12 @@ void Powerup::update(void)
 {
     assert(m_textures.size() == 1);
     move();
-
-    if ((m_position.y - m_textures[0].height) > WINDOW_HEIGHT)
-    {
-        m_discard = true;
-    }
 }
 
 void Powerup::draw(void)
 {
     assert(m_textures.size() == 1);
-    m_raylibPtr->drawTextureV(m_textures[0], m_position, WHITE);
+    drawFrame(m_textures[0], drawPosition(), 0, 1, WHITE);
 }
 
 Vector2 Powerup::getCenter(void)
@@ -64,9 +54,21 @@ Rectangle Powerup::getRect(void)
     return (Rectangle(0, 0, 0, 0));
 }
 
-void Powerup::setTextures(std::vector<Texture2D> textures)
+Sprite::Body_t Powerup::getBody(void)
+{
+    assert(m_textures.size() == 1);
+    Body_t body;
+    body.m_frames    = m_textures;
+    body.m_position  = m_position;
+    body.m_direction = m_direction;
+    body.m_speed     = m_speed;
+    body.m_radius    = m_radius;
+    return body;
+}
+
+void Powerup::setTextures(TextureAtlas::Frames_t textures)
 {
     assert(textures.size() == 1);
     m_textures = textures;
-    m_radius   = (float)(std::min(m_textures[0].width, m_textures[0].height)) / 2;
+    m_radius   = (float)(std::min(m_textures[0].m_source.width, m_textures[0].m_source.height)) / 2;
 }
@@ -0,0 +1,152 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <fstream>
+#include "Logger.h"
+
+namespace
+{
+// microseconds with the nanoseconds as decimals, the unit of the trace format
+std::string microseconds(uint64_t nanoseconds)
+{
+    std::string decimals = std::to_string(nanoseconds % 1000);
+    return (std::to_string(nanoseconds / 1000) + "." + std::string(3 - decimals.size(), '0') + decimals);
+}
+
+std::string quoted(const std::string& text)
+{
+    std::string result = "\"";
+    for (char character : text)
+    {
+        if ((character == '"') || (character == '\\'))
+        {
+            result += '\\';
+        }
+        result += character;
+    }
+    return (result + "\"");
+}
+} // namespace
+
+Profiler& Profiler::getInstance(void)
+{
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler(void)
+{
+    m_start = std::chrono::steady_clock::now();
+}
+
+uint64_t Profiler::now(void) const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+// The position is claimed before the slot is written and published once it is,
+// a reader finding the claim ahead of what it copied knows the copy is stale.
+void Profiler::record(const char* name, uint64_t begin, uint64_t end)
+{
+    Ring_t*  ring     = threadRing();
+    uint64_t position = ring->m_claimed.load(std::memory_order_relaxed);
+    ring->m_claimed.store(position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Slot_t& slot = ring->m_slots[position % RING_CAPACITY];
+    slot.m_name.store(name, std::memory_order_relaxed);
+    slot.m_begin.store(begin, std::memory_order_relaxed);
+    slot.m_end.store(end, std::memory_order_relaxed);
+    ring->m_written.store(position + 1, std::memory_order_release);
+}
+
+// shown as the name of the thread in the trace
+void Profiler::setThreadName(const std::string& name)
+{
+    Ring_t*                     ring = threadRing();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ring->m_name = name;
+}
+
+// The zones still in the rings, by start time. The zones a thread overwrote
+// while they were copied are left out.
+std::vector<Profiler::Event_t> Profiler::getEvents(void)
+{
+    std::vector<Event_t>        events;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const std::unique_ptr<Ring_t>& ring : m_rings)
+    {
+        uint64_t written = ring->m_written.load(std::memory_order_acquire);
+        uint64_t first   = (written > RING_CAPACITY) ? (written - RING_CAPACITY) : 0;
+        size_t   copied  = events.size();
+        for (uint64_t position = first; position < written; position++)
+        {
+            const Slot_t& slot = ring->m_slots[position % RING_CAPACITY];
+            events.push_back(Event_t(slot.m_name.load(std::memory_order_relaxed),
+                                     slot.m_begin.load(std::memory_order_relaxed),
+                                     slot.m_end.load(std::memory_order_relaxed),
+                                     ring->m_thread));
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t claimed = ring->m_claimed.load(std::memory_order_relaxed);
+        if (claimed > (first + RING_CAPACITY))
+        {
+            uint64_t stale = std::min((claimed - RING_CAPACITY - first), (written - first));
+            events.erase(events.begin() + copied, events.begin() + copied + stale);
+        }
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const Event_t& first, const Event_t& second) { return (first.m_begin < second.m_begin); });
+    return events;
+}
+
+// complete events, one per zone, and the names of the threads
+bool Profiler::writeTrace(const std::string& fileName)
+{
+    std::vector<Event_t> events = getEvents();
+    std::ofstream        file(fileName, std::ios::trunc);
+    if (!file)
+    {
+        Logger::getInstance().log(Logger::WARNING, "profiler trace not written: " + fileName);
+        return false;
+    }
+
+    const char* separator = "";
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const std::unique_ptr<Ring_t>& ring : m_rings)
+        {
+            if (!ring->m_name.empty())
+            {
+                file << separator << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ring->m_thread
+                     << ",\"args\":{\"name\":" << quoted(ring->m_name) << "}}";
+                separator = ",";
+            }
+        }
+    }
+    for (const Event_t& event : events)
+    {
+        file << separator << "\n{\"name\":" << quoted(event.m_name) << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.m_thread
+             << ",\"ts\":" << microseconds(event.m_begin) << ",\"dur\":" << microseconds(event.m_end - event.m_begin) << "}";
+        separator = ",";
+    }
+    file << "\n]}\n";
+
+    Logger::getInstance().log(Logger::INFO, "profiler trace written: " + fileName + ", " + std::to_string(events.size()) + " zones");
+    return (bool)file;
+}
+
+// the ring of the calling thread, created the first time the thread records
+Profiler::Ring_t* Profiler::threadRing(void)
+{
+    thread_local Ring_t* ring = nullptr;
+    if (ring == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_rings.push_back(std::make_unique<Ring_t>());
+        ring           = m_rings.back().get();
+        ring->m_thread = m_rings.size();
+    }
+    return ring;
+}
@@ -0,0 +1,116 @@
+#include "Random.h"
+#include <cassert>
+
+static inline uint64_t rotateLeft(uint64_t value, int shift)
+{
+    return ((value << shift) | (value >> (64 - shift)));
+}
+
+Random::Random(uint64_t seed)
+{
+    this->seed(seed);
+}
+
+// expand the seed with splitmix64, which never gives an all zero state
+void Random::seed(uint64_t seed)
+{
+    uint64_t value = seed;
+
+    m_seed = seed;
+    for (uint64_t& state : m_state)
+    {
+        value          += 0x9e3779b97f4a7c15ULL;
+        uint64_t mixed  = value;
+        mixed           = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        mixed           = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+        state           = mixed ^ (mixed >> 31);
+    }
+}
+
+uint64_t Random::getSeed(void) const
+{
+    return m_seed;
+}
+
+uint64_t Random::next(void)
+{
+    uint64_t result  = rotateLeft(m_state[1] * 5, 7) * 9;
+    uint64_t shifted = m_state[1] << 17;
+
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= shifted;
+    m_state[3]  = rotateLeft(m_state[3], 45);
+
+    return result;
+}
+
+// The returned generator carries on with the current sequence while this one
+// jumps 2^128 numbers ahead, so the two never overlap.
+Random Random::split(void)
+{
+    Random ret = *this;
+    jump();
+    return ret;
+}
+
+// multiply-shift on the upper 32 bits, the bias is below 2^-32 for the ranges of the game
+int32_t Random::uniformInt(int32_t min, int32_t max)
+{
+    assert(min <= max);
+    uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+    return (int32_t)((int64_t)min + (int64_t)(((next() >> 32) * range) >> 32));
+}
+
+float Random::uniformFloat(float min, float max)
+{
+    assert(min <= max);
+    float scale = (max - min) * (1.0f / (1 << 24));
+    return (min + ((float)(next() >> 40) * scale));
+}
+
+void Random::fillInt(int32_t* values, uint32_t count, int32_t min, int32_t max)
+{
+    assert(min <= max);
+    uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        values[index] = (int32_t)((int64_t)min + (int64_t)(((next() >> 32) * range) >> 32));
+    }
+}
+
+void Random::fillFloat(float* values, uint32_t count, float min, float max)
+{
+    assert(min <= max);
+    float scale = (max - min) * (1.0f / (1 << 24));
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        values[index] = min + ((float)(next() >> 40) * scale);
+    }
+}
+
+void Random::jump(void)
+{
+    static constexpr std::array<uint64_t, 4> JUMP = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+    std::array<uint64_t, 4>                  state = {0, 0, 0, 0};
+
+    for (uint64_t word : JUMP)
+    {
+        for (int bit = 0; bit < 64; bit++)
+        {
+            if ((word & (1ULL << bit)) != 0)
+            {
+                for (uint32_t index = 0; index < 4; index++)
+                {
+                    state[index] ^= m_state[index];
+                }
+            }
+            next();
+        }
+    }
+    m_state = state;
+}
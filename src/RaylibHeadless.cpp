@@ -0,0 +1,717 @@
+#include "RaylibHeadless.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include "Logger.h"
+
+namespace
+{
+uint32_t readBigEndian32(const uint8_t* bytes)
+{
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
+
+uint32_t readLittleEndian32(const uint8_t* bytes)
+{
+    return ((uint32_t)bytes[3] << 24) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[1] << 8) | (uint32_t)bytes[0];
+}
+
+uint16_t readLittleEndian16(const uint8_t* bytes)
+{
+    return (uint16_t)(((uint32_t)bytes[1] << 8) | (uint32_t)bytes[0]);
+}
+
+// width and height from the IHDR chunk, which a PNG file must start with
+bool parsePngSize(const uint8_t* data, size_t size, int& width, int& height)
+{
+    const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    if ((size < 24) ||
+        (std::memcmp(data, signature, sizeof(signature)) != 0) ||
+        (std::memcmp(&data[12], "IHDR", 4) != 0))
+    {
+        return false;
+    }
+
+    width  = readBigEndian32(&data[16]);
+    height = readBigEndian32(&data[20]);
+    return true;
+}
+
+// stream format and length from the fmt and data chunks of a RIFF/WAVE file,
+// other formats are only checked for existence by the callers
+bool parseWaveFormat(const uint8_t* data, size_t size, AudioStream& stream, uint32_t& frameCount)
+{
+    if ((size < 12) ||
+        (std::memcmp(data, "RIFF", 4) != 0) ||
+        (std::memcmp(&data[8], "WAVE", 4) != 0))
+    {
+        return false;
+    }
+
+    const uint8_t* format   = nullptr;
+    uint32_t       dataSize = 0;
+    size_t         position = 12;
+    while ((size - position) >= 8)
+    {
+        const uint8_t* chunk     = &data[position];
+        uint32_t       chunkSize = readLittleEndian32(&chunk[4]);
+        position                += 8;
+        if ((std::memcmp(chunk, "fmt ", 4) == 0) && (chunkSize >= 16) && ((size - position) >= 16))
+        {
+            format = &data[position];
+        }
+        else if (std::memcmp(chunk, "data", 4) == 0)
+        {
+            dataSize = chunkSize;
+            break;
+        }
+
+        if ((size - position) < ((size_t)chunkSize + (chunkSize & 1)))
+        {
+            break;
+        }
+        position += chunkSize + (chunkSize & 1);
+    }
+
+    if (format == nullptr)
+    {
+        return false;
+    }
+
+    stream.channels   = readLittleEndian16(&format[2]);
+    stream.sampleRate = readLittleEndian32(&format[4]);
+    stream.sampleSize = readLittleEndian16(&format[14]);
+
+    uint32_t frameSize = stream.channels * (stream.sampleSize / 8);
+    frameCount         = (frameSize > 0) ? (dataSize / frameSize) : 0;
+    return true;
+}
+
+bool readFile(const std::string& fileName, std::vector<uint8_t>& contents)
+{
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+    contents.resize((size_t)file.tellg());
+    file.seekg(0);
+    return (bool)file.read((char*)contents.data(), contents.size());
+}
+
+bool readPngSize(const std::string& fileName, int& width, int& height)
+{
+    std::vector<uint8_t> contents;
+    return (readFile(fileName, contents) && parsePngSize(contents.data(), contents.size(), width, height));
+}
+
+bool readWaveFormat(const std::string& fileName, AudioStream& stream, uint32_t& frameCount)
+{
+    std::vector<uint8_t> contents;
+    return (readFile(fileName, contents) && parseWaveFormat(contents.data(), contents.size(), stream, frameCount));
+}
+
+bool fileExists(const std::string& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    return file.good();
+}
+} // namespace
+
+RaylibHeadless::RaylibHeadless(float frameTime)
+{
+    assert(frameTime > 0);
+    m_frameTime = frameTime;
+}
+
+RaylibHeadless::~RaylibHeadless(void)
+{
+}
+
+// Stop the game loop after frameLimit frames, 0 runs until closeWindow().
+void RaylibHeadless::setFrameLimit(uint64_t frameLimit)
+{
+    m_frameLimit = frameLimit;
+}
+
+// Hold key from the start of firstFrame to the end of lastFrame.
+void RaylibHeadless::scriptKeyDown(uint64_t firstFrame, uint64_t lastFrame, int key)
+{
+    assert(firstFrame <= lastFrame);
+    assert((key > 0) && (key < (int)MAX_KEYS));
+    addEvent(ScriptEvent_t(firstFrame, KEY_DOWN_EVENT, key, {0, 0}));
+    addEvent(ScriptEvent_t(lastFrame + 1, KEY_UP_EVENT, key, {0, 0}));
+}
+
+void RaylibHeadless::scriptKeyPressed(uint64_t frame, int key)
+{
+    assert((key > 0) && (key < (int)MAX_KEYS));
+    addEvent(ScriptEvent_t(frame, KEY_PRESSED_EVENT, key, {0, 0}));
+}
+
+// The mouse stays at position until the next scripted move.
+void RaylibHeadless::scriptMouse(uint64_t frame, Vector2 position, bool leftPressed)
+{
+    addEvent(ScriptEvent_t(frame, MOUSE_MOVE_EVENT, 0, position));
+    if (leftPressed)
+    {
+        addEvent(ScriptEvent_t(frame, MOUSE_PRESSED_EVENT, MOUSE_BUTTON_LEFT, position));
+    }
+}
+
+// Play the input of a recorded session back from its first frame, so before
+// the window is created.
+void RaylibHeadless::setReplay(std::shared_ptr<Replay::Reader> replay)
+{
+    assert(!m_windowReady);
+    m_replay = replay;
+}
+
+RaylibHeadless::Counters_t RaylibHeadless::getCounters(void) const
+{
+    return m_counters;
+}
+
+double RaylibHeadless::getTime(void)
+{
+    return m_time;
+}
+
+void RaylibHeadless::initWindow(int width, int height, std::string title)
+{
+    Logger::getInstance().log(Logger::INFO, "headless window " + std::to_string(width) + "x" + std::to_string(height) + " \"" + title + "\"");
+    m_windowReady = true;
+    applyScript();
+}
+
+void RaylibHeadless::closeWindow(void)
+{
+    m_windowReady = false;
+}
+
+Texture2D RaylibHeadless::loadTexture(std::string filename)
+{
+    Texture2D texture = {0, 0, 0, 0, 0};
+    if (!readPngSize(filename, texture.width, texture.height))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless texture not loaded: " + filename);
+        return texture;
+    }
+
+    texture.id      = nextId();
+    texture.mipmaps = 1;
+    texture.format  = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return texture;
+}
+
+void RaylibHeadless::unloadTexture(Texture2D texture)
+{
+    (void)texture;
+}
+
+bool RaylibHeadless::windowShouldClose(void)
+{
+    return (!m_windowReady || m_replayEnded || ((m_frameLimit != 0) && (m_counters.m_frames >= m_frameLimit)));
+}
+
+float RaylibHeadless::getFrameTime(void)
+{
+    return m_frameTime;
+}
+
+void RaylibHeadless::beginDrawing(void)
+{
+    m_boundTexture = UINT32_MAX;
+}
+
+void RaylibHeadless::clearBackground(Color color)
+{
+    (void)color;
+}
+
+// Like raylib's EndDrawing, this is where time advances and input gets polled.
+void RaylibHeadless::endDrawing(void)
+{
+    m_counters.m_frames++;
+    m_time += m_frameTime;
+    applyScript();
+}
+
+void RaylibHeadless::drawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    (void)position;
+    (void)tint;
+    bindTexture(texture.id);
+    m_counters.m_textures++;
+}
+
+bool RaylibHeadless::isKeyDown(int key)
+{
+    return ((key > 0) && (key < (int)MAX_KEYS) && m_keysDown[key]);
+}
+
+bool RaylibHeadless::isWindowReady(void)
+{
+    return m_windowReady;
+}
+
+void RaylibHeadless::drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    (void)position;
+    (void)rotation;
+    (void)scale;
+    (void)tint;
+    bindTexture(texture.id);
+    m_counters.m_textures++;
+}
+
+bool RaylibHeadless::isKeyPressed(int key)
+{
+    return ((key > 0) && (key < (int)MAX_KEYS) && m_keysPressed[key]);
+}
+
+// The collision checks are those of raylib 5.5, the simulation depends on them.
+bool RaylibHeadless::checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    float dx              = center2.x - center1.x;
+    float dy              = center2.y - center1.y;
+    float distanceSquared = (dx * dx) + (dy * dy);
+    float radiusSum       = radius1 + radius2;
+    return (distanceSquared <= (radiusSum * radiusSum));
+}
+
+bool RaylibHeadless::checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
+{
+    float halfWidth  = rec.width / 2.0f;
+    float halfHeight = rec.height / 2.0f;
+    float dx         = std::fabs(center.x - (rec.x + halfWidth));
+    float dy         = std::fabs(center.y - (rec.y + halfHeight));
+
+    if ((dx > (halfWidth + radius)) || (dy > (halfHeight + radius)))
+    {
+        return false;
+    }
+    if ((dx <= halfWidth) || (dy <= halfHeight))
+    {
+        return true;
+    }
+
+    float cornerDistanceSq = ((dx - halfWidth) * (dx - halfWidth)) + ((dy - halfHeight) * (dy - halfHeight));
+    return (cornerDistanceSq <= (radius * radius));
+}
+
+void RaylibHeadless::drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    (void)source;
+    (void)dest;
+    (void)origin;
+    (void)rotation;
+    (void)tint;
+    bindTexture(texture.id);
+    m_counters.m_textures++;
+}
+
+Font RaylibHeadless::loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount)
+{
+    (void)codepoints;
+    Font font = {0, 0, 0, {0, 0, 0, 0, 0}, nullptr, nullptr};
+    if (!fileExists(fileName))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless font not loaded: " + fileName);
+        return font;
+    }
+
+    font.baseSize   = fontSize;
+    font.glyphCount = (codepointCount > 0) ? codepointCount : 95;
+    font.texture.id = nextId();
+    return font;
+}
+
+void RaylibHeadless::drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    (void)text;
+    (void)position;
+    (void)fontSize;
+    (void)spacing;
+    (void)tint;
+    bindTexture(font.texture.id);
+    m_counters.m_texts++;
+}
+
+void RaylibHeadless::unloadFont(Font font)
+{
+    (void)font;
+}
+
+void RaylibHeadless::initAudioDevice(void)
+{
+}
+
+void RaylibHeadless::closeAudioDevice(void)
+{
+}
+
+Sound RaylibHeadless::loadSound(std::string fileName)
+{
+    Sound sound = {{nullptr, nullptr, 0, 0, 0}, 0};
+    if (!readWaveFormat(fileName, sound.stream, sound.frameCount) && !fileExists(fileName))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless sound not loaded: " + fileName);
+    }
+    return sound;
+}
+
+void RaylibHeadless::unloadSound(Sound sound)
+{
+    (void)sound;
+}
+
+Music RaylibHeadless::loadMusicStream(std::string fileName)
+{
+    Music music = {{nullptr, nullptr, 0, 0, 0}, 0, true, 0, nullptr};
+    if (!readWaveFormat(fileName, music.stream, music.frameCount) && !fileExists(fileName))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless music not loaded: " + fileName);
+    }
+    return music;
+}
+
+void RaylibHeadless::unloadMusicStream(Music music)
+{
+    (void)music;
+}
+
+void RaylibHeadless::updateMusicStream(Music music)
+{
+    (void)music;
+}
+
+void RaylibHeadless::playSound(Sound sound)
+{
+    (void)sound;
+    m_counters.m_sounds++;
+}
+
+void RaylibHeadless::playMusicStream(Music music)
+{
+    (void)music;
+}
+
+void RaylibHeadless::drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    (void)rec;
+    (void)roundness;
+    (void)segments;
+    (void)color;
+    // shapes are drawn with raylib's default texture
+    bindTexture(0);
+    m_counters.m_shapes++;
+}
+
+Vector2 RaylibHeadless::getMousePosition(void)
+{
+    return m_mousePosition;
+}
+
+bool RaylibHeadless::checkCollisionPointRec(Vector2 point, Rectangle rec)
+{
+    return ((point.x >= rec.x) && (point.x < (rec.x + rec.width)) && (point.y >= rec.y) && (point.y < (rec.y + rec.height)));
+}
+
+bool RaylibHeadless::isMouseButtonPressed(int button)
+{
+    return ((button >= 0) && (button < (int)MAX_MOUSE_BUTTONS) && m_mousePressed[button]);
+}
+
+// Every glyph is taken half as wide as it is high.
+Vector2 RaylibHeadless::measureTextEx(Font font, std::string text, float fontSize, float spacing)
+{
+    (void)font;
+    if (text.empty())
+    {
+        return Vector2(0, 0);
+    }
+    return Vector2((text.length() * fontSize / 2) + ((text.length() - 1) * spacing), fontSize);
+}
+
+Image RaylibHeadless::loadImage(std::string fileName)
+{
+    Image image = {nullptr, 0, 0, 0, 0};
+    if (!readPngSize(fileName, image.width, image.height))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless image not loaded: " + fileName);
+        return image;
+    }
+
+    image.mipmaps = 1;
+    image.format  = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return image;
+}
+
+void RaylibHeadless::unloadImage(Image image)
+{
+    (void)image;
+}
+
+Image RaylibHeadless::genImageColor(int width, int height, Color color)
+{
+    (void)color;
+    return Image(nullptr, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+}
+
+void RaylibHeadless::imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    (void)dst;
+    (void)src;
+    (void)srcRec;
+    (void)dstRec;
+    (void)tint;
+}
+
+Texture2D RaylibHeadless::loadTextureFromImage(Image image)
+{
+    return Texture2D(nextId(), image.width, image.height, image.mipmaps, image.format);
+}
+
+// like loadImage(), safe to call from the decoding threads
+Wave RaylibHeadless::loadWave(std::string fileName)
+{
+    Wave        wave   = {0, 0, 0, 0, nullptr};
+    AudioStream stream = {nullptr, nullptr, 0, 0, 0};
+    if (!readWaveFormat(fileName, stream, wave.frameCount) && !fileExists(fileName))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless wave not loaded: " + fileName);
+    }
+    wave.sampleRate = stream.sampleRate;
+    wave.sampleSize = stream.sampleSize;
+    wave.channels   = stream.channels;
+    return wave;
+}
+
+void RaylibHeadless::unloadWave(Wave wave)
+{
+    (void)wave;
+}
+
+Sound RaylibHeadless::loadSoundFromWave(Wave wave)
+{
+    Sound sound = {{nullptr, nullptr, wave.sampleRate, wave.sampleSize, wave.channels}, wave.frameCount};
+    return sound;
+}
+
+void RaylibHeadless::addEvent(ScriptEvent_t event)
+{
+    assert(event.m_frame >= m_counters.m_frames);
+    auto position = std::upper_bound(m_script.begin() + m_scriptCursor,
+                                     m_script.end(),
+                                     event,
+                                     [](const ScriptEvent_t& a, const ScriptEvent_t& b) { return a.m_frame < b.m_frame; });
+    m_script.insert(position, event);
+}
+
+// Pressed states last one frame, held keys and the mouse position persist.
+void RaylibHeadless::applyScript(void)
+{
+    m_keysPressed.fill(false);
+    m_mousePressed.fill(false);
+
+    while ((m_scriptCursor < m_script.size()) && (m_script[m_scriptCursor].m_frame <= m_counters.m_frames))
+    {
+        const ScriptEvent_t& event = m_script[m_scriptCursor++];
+        switch (event.m_type)
+        {
+            case KEY_DOWN_EVENT:
+                m_keysDown[event.m_key] = true;
+                break;
+
+            case KEY_UP_EVENT:
+                m_keysDown[event.m_key] = false;
+                break;
+
+            case KEY_PRESSED_EVENT:
+                m_keysPressed[event.m_key] = true;
+                break;
+
+            case MOUSE_MOVE_EVENT:
+                m_mousePosition = event.m_position;
+                break;
+
+            case MOUSE_PRESSED_EVENT:
+                m_mousePressed[event.m_key] = true;
+                break;
+
+            default:
+                assert(false);
+                break;
+        }
+    }
+
+    if (m_replay != nullptr)
+    {
+        applyReplay();
+    }
+}
+
+// The input of the frame is the recorded one, so is the frame time.
+void RaylibHeadless::applyReplay(void)
+{
+    static_assert((MAX_KEYS == Replay::MAX_KEYS) && (MAX_MOUSE_BUTTONS == Replay::MAX_MOUSE_BUTTONS));
+
+    Replay::Frame_t frame;
+    if (!m_replay->read(frame))
+    {
+        m_replayEnded = true;
+        return;
+    }
+
+    m_frameTime     = frame.m_frameTime;
+    m_mousePosition = frame.m_mousePosition;
+    for (uint32_t key = 0; key < MAX_KEYS; key++)
+    {
+        m_keysDown[key]    = frame.m_keysDown[key];
+        m_keysPressed[key] = frame.m_keysPressed[key];
+    }
+    for (uint32_t button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    {
+        m_mousePressed[button] = ((frame.m_mousePressed >> button) & 1);
+    }
+}
+
+uint32_t RaylibHeadless::nextId(void)
+{
+    return ++m_lastId;
+}
+
+void RaylibHeadless::bindTexture(uint32_t textureId)
+{
+    if (textureId != m_boundTexture)
+    {
+        m_boundTexture = textureId;
+        m_counters.m_batches++;
+    }
+}
+
+Image RaylibHeadless::loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    Image image = {nullptr, 0, 0, 0, 0};
+    if ((fileType != ".png") || !parsePngSize(fileData, dataSize, image.width, image.height))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless image not loaded from memory");
+        return image;
+    }
+
+    image.mipmaps = 1;
+    image.format  = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return image;
+}
+
+Wave RaylibHeadless::loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    Wave        wave   = {0, 0, 0, 0, nullptr};
+    AudioStream stream = {nullptr, nullptr, 0, 0, 0};
+    if ((fileType == ".wav") && parseWaveFormat(fileData, dataSize, stream, wave.frameCount))
+    {
+        wave.sampleRate = stream.sampleRate;
+        wave.sampleSize = stream.sampleSize;
+        wave.channels   = stream.channels;
+    }
+    return wave;
+}
+
+Font RaylibHeadless::loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount)
+{
+    (void)fileType;
+    (void)codepoints;
+    Font font = {0, 0, 0, {0, 0, 0, 0, 0}, nullptr, nullptr};
+    if ((fileData == nullptr) || (dataSize <= 0))
+    {
+        Logger::getInstance().log(Logger::WARNING, "headless font not loaded from memory");
+        return font;
+    }
+
+    font.baseSize   = fontSize;
+    font.glyphCount = (codepointCount > 0) ? codepointCount : 95;
+    font.texture.id = nextId();
+    return font;
+}
+
+Music RaylibHeadless::loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize)
+{
+    Music music = {{nullptr, nullptr, 0, 0, 0}, 0, true, 0, nullptr};
+    if (fileType == ".wav")
+    {
+        parseWaveFormat(data, dataSize, music.stream, music.frameCount);
+    }
+    return music;
+}
+
+RenderTexture2D RaylibHeadless::loadRenderTexture(int width, int height)
+{
+    RenderTexture2D target = {0, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}};
+    target.id              = nextId();
+    target.texture         = Texture2D(nextId(), width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    target.depth           = Texture2D(nextId(), width, height, 1, 0);
+    return target;
+}
+
+void RaylibHeadless::unloadRenderTexture(RenderTexture2D target)
+{
+    (void)target;
+}
+
+// switching the target ends raylib's draw batch
+void RaylibHeadless::beginTextureMode(RenderTexture2D target)
+{
+    assert(!m_textureMode);
+    (void)target;
+    m_textureMode  = true;
+    m_boundTexture = UINT32_MAX;
+}
+
+void RaylibHeadless::endTextureMode(void)
+{
+    assert(m_textureMode);
+    m_textureMode  = false;
+    m_boundTexture = UINT32_MAX;
+}
+
+void RaylibHeadless::beginScissorMode(int x, int y, int width, int height)
+{
+    (void)x;
+    (void)y;
+    (void)width;
+    (void)height;
+    m_boundTexture = UINT32_MAX;
+}
+
+void RaylibHeadless::endScissorMode(void)
+{
+    m_boundTexture = UINT32_MAX;
+}
+
+void RaylibHeadless::drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint)
+{
+    (void)position;
+    (void)tint;
+    bindTexture(target.texture.id);
+    m_counters.m_textures++;
+}
+
+Sound RaylibHeadless::loadSoundAlias(Sound source)
+{
+    return source;
+}
+
+void RaylibHeadless::unloadSoundAlias(Sound alias)
+{
+    (void)alias;
+}
+
+void RaylibHeadless::setSoundVolume(Sound sound, float volume)
+{
+    (void)sound;
+    (void)volume;
+}
@@ -1,4 +1,5 @@
 #include "RaylibWrapper.h"
+#include "rlgl.h"
 
 RaylibWrapper::RaylibWrapper(void)
 {
@@ -57,6 +58,7 @@ void RaylibWrapper::clearBackground(Color color)
 void RaylibWrapper::endDrawing(void)
 {
     EndDrawing();
+    m_textCache.endFrame();
 }
 
 void RaylibWrapper::drawTextureV(Texture2D texture, Vector2 position, Color tint)
@@ -105,14 +107,24 @@ Font RaylibWrapper::loadFontEx(std::string fileName, int fontSize, int* codepoin
     return (LoadFontEx(filefullpath, fontSize, codepoints, codepointCount));
 }
 
+// DrawTextEx() walks the codepoints and looks their glyphs up at every draw,
+// the quads of a text are only laid out the first frame it is drawn
 void RaylibWrapper::drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint)
 {
-    const char* charText = text.c_str();
-    DrawTextEx(font, charText, position, fontSize, spacing, tint);
+    if (font.texture.id == 0)
+    {
+        font = GetFontDefault();
+    }
+    for (const TextCache::Quad_t& quad : m_textCache.getQuads(font, text, fontSize, spacing))
+    {
+        Rectangle dest = Rectangle((position.x + quad.m_dest.x), (position.y + quad.m_dest.y), quad.m_dest.width, quad.m_dest.height);
+        DrawTexturePro(font.texture, quad.m_source, dest, Vector2(0, 0), 0, tint);
+    }
 }
 
 void RaylibWrapper::unloadFont(Font font)
 {
+    m_textCache.clear();
     UnloadFont(font);
 }
 
@@ -185,3 +197,122 @@ Vector2 RaylibWrapper::measureTextEx(Font font, std::string text, float fontSize
 {
     return (MeasureTextEx(font, text.c_str(), fontSize, spacing));
 }
+
+Image RaylibWrapper::loadImage(std::string fileName)
+{
+    return (LoadImage(fileName.c_str()));
+}
+
+void RaylibWrapper::unloadImage(Image image)
+{
+    UnloadImage(image);
+}
+
+Image RaylibWrapper::genImageColor(int width, int height, Color color)
+{
+    return (GenImageColor(width, height, color));
+}
+
+void RaylibWrapper::imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    ImageDraw(dst, src, srcRec, dstRec, tint);
+}
+
+Texture2D RaylibWrapper::loadTextureFromImage(Image image)
+{
+    return (LoadTextureFromImage(image));
+}
+
+Wave RaylibWrapper::loadWave(std::string fileName)
+{
+    return (LoadWave(fileName.c_str()));
+}
+
+void RaylibWrapper::unloadWave(Wave wave)
+{
+    UnloadWave(wave);
+}
+
+Sound RaylibWrapper::loadSoundFromWave(Wave wave)
+{
+    return (LoadSoundFromWave(wave));
+}
+
+Image RaylibWrapper::loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    return (LoadImageFromMemory(fileType.c_str(), fileData, dataSize));
+}
+
+Wave RaylibWrapper::loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    return (LoadWaveFromMemory(fileType.c_str(), fileData, dataSize));
+}
+
+Font RaylibWrapper::loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount)
+{
+    return (LoadFontFromMemory(fileType.c_str(), fileData, dataSize, fontSize, codepoints, codepointCount));
+}
+
+Music RaylibWrapper::loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize)
+{
+    return (LoadMusicStreamFromMemory(fileType.c_str(), data, dataSize));
+}
+
+RenderTexture2D RaylibWrapper::loadRenderTexture(int width, int height)
+{
+    return (LoadRenderTexture(width, height));
+}
+
+void RaylibWrapper::unloadRenderTexture(RenderTexture2D target)
+{
+    UnloadRenderTexture(target);
+}
+
+// The alpha of what is drawn over the transparent target accumulates instead
+// of being squared, the target then holds premultiplied colors.
+void RaylibWrapper::beginTextureMode(RenderTexture2D target)
+{
+    BeginTextureMode(target);
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+void RaylibWrapper::endTextureMode(void)
+{
+    EndBlendMode();
+    EndTextureMode();
+}
+
+void RaylibWrapper::beginScissorMode(int x, int y, int width, int height)
+{
+    BeginScissorMode(x, y, width, height);
+}
+
+void RaylibWrapper::endScissorMode(void)
+{
+    EndScissorMode();
+}
+
+// the texture of a target is upside down, and its colors are premultiplied
+void RaylibWrapper::drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint)
+{
+    Rectangle source = Rectangle(0, 0, target.texture.width, -target.texture.height);
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(target.texture, source, position, tint);
+    EndBlendMode();
+}
+
+Sound RaylibWrapper::loadSoundAlias(Sound source)
+{
+    return (LoadSoundAlias(source));
+}
+
+void RaylibWrapper::unloadSoundAlias(Sound alias)
+{
+    UnloadSoundAlias(alias);
+}
+
+void RaylibWrapper::setSoundVolume(Sound sound, float volume)
+{
+    SetSoundVolume(sound, volume);
+}
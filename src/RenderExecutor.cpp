@@ -0,0 +1,171 @@
+#include "RenderExecutor.h"
+#include <algorithm>
+#include <cassert>
+#include "Profiler.h"
+
+namespace
+{
+// the texture a command is drawn with, shapes use raylib's default texture
+uint32_t textureOf(const RenderExecutor::Frame_t& frame, const RenderExecutor::Command_t& command)
+{
+    switch (command.m_type)
+    {
+        case RenderExecutor::TEXTURE:
+            return command.m_texture.id;
+
+        case RenderExecutor::TEXT:
+            return frame.m_fonts[command.m_font].texture.id;
+
+        case RenderExecutor::TARGET:
+            return frame.m_targets[command.m_target].texture.id;
+
+        default:
+            return 0;
+    }
+}
+
+bool isState(RenderExecutor::COMMAND_t type)
+{
+    return ((type == RenderExecutor::BEGIN_TARGET) ||
+            (type == RenderExecutor::END_TARGET) ||
+            (type == RenderExecutor::BEGIN_SCISSOR) ||
+            (type == RenderExecutor::END_SCISSOR));
+}
+
+// layers in recording order, sprites of a layer grouped by texture, ties in
+// recording order
+uint64_t sortKeyOf(const RenderExecutor::Command_t& command)
+{
+    uint32_t texture = (command.m_type == RenderExecutor::TEXTURE) ? command.m_texture.id : 0;
+    return (((uint64_t)command.m_layer << 32) | texture);
+}
+
+bool drawnBefore(const RenderExecutor::SortKey_t& first, const RenderExecutor::SortKey_t& second)
+{
+    if (first.m_key != second.m_key)
+    {
+        return (first.m_key < second.m_key);
+    }
+    return (first.m_index < second.m_index);
+}
+} // namespace
+
+RenderExecutor::RenderExecutor(std::shared_ptr<RaylibInterface> raylibPtr)
+{
+    assert(raylibPtr != nullptr);
+    m_raylibPtr = raylibPtr;
+}
+
+// Sort the sprite layers of frame by texture, then draw the whole frame
+// between beginDrawing() and endDrawing(). The frame is left sorted.
+void RenderExecutor::execute(Frame_t& frame)
+{
+    PROFILE_ZONE("RenderExecutor::execute");
+    sort(frame);
+
+    m_stats.m_commands = frame.m_commands.size();
+    m_stats.m_batches  = 0;
+
+    uint32_t boundTexture = UINT32_MAX;
+    m_raylibPtr->beginDrawing();
+    for (const Command_t& command : frame.m_commands)
+    {
+        if (isState(command.m_type))
+        {
+            // switching the target or the scissor ends raylib's draw batch
+            boundTexture = UINT32_MAX;
+        }
+        else if (command.m_type != CLEAR)
+        {
+            uint32_t texture = textureOf(frame, command);
+            if (texture != boundTexture)
+            {
+                boundTexture = texture;
+                m_stats.m_batches++;
+            }
+        }
+        submit(frame, command);
+    }
+    m_raylibPtr->endDrawing();
+}
+
+RenderExecutor::Stats_t RenderExecutor::getStats(void) const
+{
+    return m_stats;
+}
+
+// Stable sort of the commands without std::stable_sort's temporary buffer: the
+// recording index breaks the ties, and the keys and the reordered commands live
+// in scratch vectors that keep their capacity from frame to frame.
+void RenderExecutor::sort(Frame_t& frame)
+{
+    m_sortKeys.resize(frame.m_commands.size());
+    for (uint32_t index = 0; index < frame.m_commands.size(); index++)
+    {
+        m_sortKeys[index].m_key   = sortKeyOf(frame.m_commands[index]);
+        m_sortKeys[index].m_index = index;
+    }
+    if (std::is_sorted(m_sortKeys.begin(), m_sortKeys.end(), drawnBefore))
+    {
+        return;
+    }
+    std::sort(m_sortKeys.begin(), m_sortKeys.end(), drawnBefore);
+
+    m_sorted.resize(frame.m_commands.size());
+    for (uint32_t index = 0; index < m_sortKeys.size(); index++)
+    {
+        m_sorted[index] = frame.m_commands[m_sortKeys[index].m_index];
+    }
+    std::copy(m_sorted.begin(), m_sorted.end(), frame.m_commands.begin());
+}
+
+void RenderExecutor::submit(const Frame_t& frame, const Command_t& command)
+{
+    switch (command.m_type)
+    {
+        case CLEAR:
+            m_raylibPtr->clearBackground(command.m_tint);
+            break;
+
+        case TEXTURE:
+            m_raylibPtr->drawTexturePro(command.m_texture, command.m_source, command.m_dest, command.m_origin, command.m_rotation, command.m_tint);
+            break;
+
+        case TEXT:
+            m_raylibPtr->drawTextEx(frame.m_fonts[command.m_font],
+                                    frame.m_text.substr(command.m_textOffset, command.m_textLength),
+                                    Vector2(command.m_dest.x, command.m_dest.y),
+                                    command.m_fontSize,
+                                    command.m_spacing,
+                                    command.m_tint);
+            break;
+
+        case RECTANGLE:
+            m_raylibPtr->drawRectangleRounded(command.m_dest, command.m_rotation, command.m_segments, command.m_tint);
+            break;
+
+        case BEGIN_TARGET:
+            m_raylibPtr->beginTextureMode(frame.m_targets[command.m_target]);
+            break;
+
+        case END_TARGET:
+            m_raylibPtr->endTextureMode();
+            break;
+
+        case BEGIN_SCISSOR:
+            m_raylibPtr->beginScissorMode((int)command.m_dest.x, (int)command.m_dest.y, (int)command.m_dest.width, (int)command.m_dest.height);
+            break;
+
+        case END_SCISSOR:
+            m_raylibPtr->endScissorMode();
+            break;
+
+        case TARGET:
+            m_raylibPtr->drawRenderTexture(frame.m_targets[command.m_target], Vector2(command.m_dest.x, command.m_dest.y), command.m_tint);
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+}
@@ -0,0 +1,713 @@
+#include "RenderQueue.h"
+#include <cassert>
+#include "Profiler.h"
+#include <utility>
+
+namespace
+{
+// sprites, texts and shapes, and the clear and render state
+uint32_t groupOf(RenderExecutor::COMMAND_t type)
+{
+    switch (type)
+    {
+        case RenderExecutor::TEXTURE:
+            return 1;
+
+        case RenderExecutor::TEXT:
+        case RenderExecutor::RECTANGLE:
+            return 2;
+
+        default:
+            return 0;
+    }
+}
+} // namespace
+
+RenderQueue::RenderQueue(std::shared_ptr<RaylibInterface> raylibPtr)
+{
+    assert(raylibPtr != nullptr);
+    m_raylibPtr = raylibPtr;
+    m_executor  = std::make_shared<RenderExecutor>(raylibPtr);
+}
+
+// The tasks already posted, the unloads of the game among them, run before
+// the render thread stops.
+RenderQueue::~RenderQueue(void)
+{
+    if (m_renderThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_taskPosted.notify_all();
+        m_renderThread.join();
+    }
+}
+
+// Set before initWindow(), the render thread runs until the queue is destroyed.
+void RenderQueue::setThreading(THREADING_t threading)
+{
+    assert(m_threading == CALLING_THREAD);
+    m_threading = threading;
+    if (m_threading == RENDER_THREAD)
+    {
+        m_renderThread = std::thread(&RenderQueue::renderLoop, this);
+    }
+}
+
+// wait for the render thread to run everything handed over so far
+void RenderQueue::flush(void)
+{
+    run([](void) {});
+}
+
+// The last frame known to be drawn, sorted the way it was drawn. With
+// RENDER_THREAD that is the frame before the last one handed over.
+const RenderExecutor::Frame_t& RenderQueue::getLastFrame(void) const
+{
+    return m_frames[m_lastFrame];
+}
+
+RenderExecutor::Stats_t RenderQueue::getStats(void) const
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_executor->getStats();
+    }
+    return m_window.m_stats;
+}
+
+double RenderQueue::getTime(void)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->getTime();
+    }
+    return m_window.m_time;
+}
+
+// the render thread opens and closes the window, which gives it the GL context
+void RenderQueue::initWindow(int width, int height, std::string title)
+{
+    run([&](void) { m_raylibPtr->initWindow(width, height, title); });
+    run([this](void) { pollWindow(m_window); });
+}
+
+void RenderQueue::closeWindow(void)
+{
+    run([&](void) { m_raylibPtr->closeWindow(); });
+    run([this](void) { pollWindow(m_window); });
+}
+
+Texture2D RenderQueue::loadTexture(std::string filename)
+{
+    Texture2D result = {};
+    run([&](void) { result = m_raylibPtr->loadTexture(filename); });
+    return result;
+}
+
+void RenderQueue::unloadTexture(Texture2D texture)
+{
+    post([this, texture](void) { m_raylibPtr->unloadTexture(texture); });
+}
+
+bool RenderQueue::windowShouldClose(void)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->windowShouldClose();
+    }
+    return m_window.m_shouldClose;
+}
+
+float RenderQueue::getFrameTime(void)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->getFrameTime();
+    }
+    return m_window.m_frameTime;
+}
+
+// the frame is drawn by the executor at endDrawing()
+void RenderQueue::beginDrawing(void)
+{
+}
+
+void RenderQueue::clearBackground(Color color)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::CLEAR;
+    command.m_tint                    = color;
+    record(command);
+}
+
+// Hand the recorded frame over and start recording the next one. On the
+// calling thread the frame is drawn before this returns, with RENDER_THREAD
+// once the render thread is done with the frame before and takes this one,
+// leaving the window state after the frame before to be read until the next.
+void RenderQueue::endDrawing(void)
+{
+    PROFILE_ZONE("RenderQueue::endDrawing");
+    uint32_t frame = m_writing;
+    if (m_threading == CALLING_THREAD)
+    {
+        m_executor->execute(m_frames[frame]);
+        m_lastFrame = frame;
+    }
+    else
+    {
+        Task_t draw  = {};
+        draw.m_type  = DRAW_FRAME;
+        draw.m_frame = frame;
+
+        uint64_t                     task = post(draw);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_taskProgress.wait(lock, [this, task](void) { return (m_started >= task); });
+        if (m_handedOver > 0)
+        {
+            m_window = m_frameWindows[m_previous];
+        }
+        m_lastFrame = m_previous;
+    }
+    m_handedOver++;
+
+    m_previous = frame;
+    m_writing  = (m_writing + 1) % FRAME_BUFFERS;
+    m_frames[m_writing].m_commands.clear();
+    m_frames[m_writing].m_fonts.clear();
+    m_frames[m_writing].m_targets.clear();
+    m_frames[m_writing].m_text.clear();
+}
+
+void RenderQueue::drawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    drawTextureEx(texture, position, 0, 1, tint);
+}
+
+bool RenderQueue::isKeyDown(int key)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->isKeyDown(key);
+    }
+    return ((key >= 0) && (key < (int)MAX_KEYS) && m_window.m_keysDown[key]);
+}
+
+bool RenderQueue::isWindowReady(void)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->isWindowReady();
+    }
+    return m_window.m_windowReady;
+}
+
+// the same source and destination as raylib's DrawTextureEx
+void RenderQueue::drawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = Rectangle(0, 0, (float)texture.width, (float)texture.height);
+    Rectangle dest   = Rectangle(position.x, position.y, texture.width * scale, texture.height * scale);
+    drawTexturePro(texture, source, dest, Vector2(0, 0), rotation, tint);
+}
+
+bool RenderQueue::isKeyPressed(int key)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->isKeyPressed(key);
+    }
+    return ((key >= 0) && (key < (int)MAX_KEYS) && m_window.m_keysPressed[key]);
+}
+
+bool RenderQueue::checkCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    return m_raylibPtr->checkCollisionCircles(center1, radius1, center2, radius2);
+}
+
+bool RenderQueue::checkCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
+{
+    return m_raylibPtr->checkCollisionCircleRec(center, radius, rec);
+}
+
+void RenderQueue::drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::TEXTURE;
+    command.m_texture                 = texture;
+    command.m_source                  = source;
+    command.m_dest                    = dest;
+    command.m_origin                  = origin;
+    command.m_rotation                = rotation;
+    command.m_tint                    = tint;
+    record(command);
+}
+
+Font RenderQueue::loadFontEx(std::string fileName, int fontSize, int* codepoints, int codepointCount)
+{
+    Font result = {};
+    run([&](void) { result = m_raylibPtr->loadFontEx(fileName, fontSize, codepoints, codepointCount); });
+    return result;
+}
+
+// the text is appended to the text of the frame, the font is kept once per frame
+void RenderQueue::drawTextEx(Font font, std::string text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    RenderExecutor::Frame_t& frame = m_frames[m_writing];
+    std::vector<Font>&       fonts = frame.m_fonts;
+    uint32_t                 index = 0;
+    while ((index < fonts.size()) && (fonts[index].texture.id != font.texture.id))
+    {
+        index++;
+    }
+    if (index == fonts.size())
+    {
+        fonts.push_back(font);
+    }
+
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::TEXT;
+    command.m_font                    = index;
+    command.m_dest                    = Rectangle(position.x, position.y, 0, 0);
+    command.m_fontSize                = fontSize;
+    command.m_spacing                 = spacing;
+    command.m_textOffset              = frame.m_text.size();
+    command.m_textLength              = text.size();
+    command.m_tint                    = tint;
+    frame.m_text.append(text);
+    record(command);
+}
+
+void RenderQueue::unloadFont(Font font)
+{
+    post([this, font](void) { m_raylibPtr->unloadFont(font); });
+}
+
+void RenderQueue::initAudioDevice(void)
+{
+    post([this](void) { m_raylibPtr->initAudioDevice(); });
+}
+
+void RenderQueue::closeAudioDevice(void)
+{
+    post([this](void) { m_raylibPtr->closeAudioDevice(); });
+}
+
+Sound RenderQueue::loadSound(std::string fileName)
+{
+    Sound result = {};
+    run([&](void) { result = m_raylibPtr->loadSound(fileName); });
+    return result;
+}
+
+void RenderQueue::unloadSound(Sound sound)
+{
+    post([this, sound](void) { m_raylibPtr->unloadSound(sound); });
+}
+
+Music RenderQueue::loadMusicStream(std::string fileName)
+{
+    Music result = {};
+    run([&](void) { result = m_raylibPtr->loadMusicStream(fileName); });
+    return result;
+}
+
+void RenderQueue::unloadMusicStream(Music music)
+{
+    post([this, music](void) { m_raylibPtr->unloadMusicStream(music); });
+}
+
+void RenderQueue::updateMusicStream(Music music)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        m_raylibPtr->updateMusicStream(music);
+        return;
+    }
+
+    Task_t task  = {};
+    task.m_type  = UPDATE_MUSIC_STREAM;
+    task.m_music = music;
+    post(task);
+}
+
+void RenderQueue::playSound(Sound sound)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        m_raylibPtr->playSound(sound);
+        return;
+    }
+
+    Task_t task  = {};
+    task.m_type  = PLAY_SOUND;
+    task.m_sound = sound;
+    post(task);
+}
+
+void RenderQueue::playMusicStream(Music music)
+{
+    post([this, music](void) { m_raylibPtr->playMusicStream(music); });
+}
+
+void RenderQueue::drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::RECTANGLE;
+    command.m_dest                    = rec;
+    command.m_rotation                = roundness;
+    command.m_segments                = segments;
+    command.m_tint                    = color;
+    record(command);
+}
+
+Vector2 RenderQueue::getMousePosition(void)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->getMousePosition();
+    }
+    return m_window.m_mousePosition;
+}
+
+bool RenderQueue::checkCollisionPointRec(Vector2 point, Rectangle rec)
+{
+    return m_raylibPtr->checkCollisionPointRec(point, rec);
+}
+
+bool RenderQueue::isMouseButtonPressed(int button)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return m_raylibPtr->isMouseButtonPressed(button);
+    }
+    return ((button >= 0) && (button < (int)MAX_MOUSE_BUTTONS) && m_window.m_mousePressed[button]);
+}
+
+Vector2 RenderQueue::measureTextEx(Font font, std::string text, float fontSize, float spacing)
+{
+    return m_raylibPtr->measureTextEx(font, text, fontSize, spacing);
+}
+
+Image RenderQueue::loadImage(std::string fileName)
+{
+    Image result = {};
+    run([&](void) { result = m_raylibPtr->loadImage(fileName); });
+    return result;
+}
+
+void RenderQueue::unloadImage(Image image)
+{
+    post([this, image](void) { m_raylibPtr->unloadImage(image); });
+}
+
+Image RenderQueue::genImageColor(int width, int height, Color color)
+{
+    Image result = {};
+    run([&](void) { result = m_raylibPtr->genImageColor(width, height, color); });
+    return result;
+}
+
+void RenderQueue::imageDraw(Image* dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    run([&](void) { m_raylibPtr->imageDraw(dst, src, srcRec, dstRec, tint); });
+}
+
+Texture2D RenderQueue::loadTextureFromImage(Image image)
+{
+    Texture2D result = {};
+    run([&](void) { result = m_raylibPtr->loadTextureFromImage(image); });
+    return result;
+}
+
+Wave RenderQueue::loadWave(std::string fileName)
+{
+    Wave result = {};
+    run([&](void) { result = m_raylibPtr->loadWave(fileName); });
+    return result;
+}
+
+void RenderQueue::unloadWave(Wave wave)
+{
+    post([this, wave](void) { m_raylibPtr->unloadWave(wave); });
+}
+
+Sound RenderQueue::loadSoundFromWave(Wave wave)
+{
+    Sound result = {};
+    run([&](void) { result = m_raylibPtr->loadSoundFromWave(wave); });
+    return result;
+}
+
+Image RenderQueue::loadImageFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    Image result = {};
+    run([&](void) { result = m_raylibPtr->loadImageFromMemory(fileType, fileData, dataSize); });
+    return result;
+}
+
+Wave RenderQueue::loadWaveFromMemory(std::string fileType, const unsigned char* fileData, int dataSize)
+{
+    Wave result = {};
+    run([&](void) { result = m_raylibPtr->loadWaveFromMemory(fileType, fileData, dataSize); });
+    return result;
+}
+
+Font RenderQueue::loadFontFromMemory(std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount)
+{
+    Font result = {};
+    run([&](void) { result = m_raylibPtr->loadFontFromMemory(fileType, fileData, dataSize, fontSize, codepoints, codepointCount); });
+    return result;
+}
+
+Music RenderQueue::loadMusicStreamFromMemory(std::string fileType, const unsigned char* data, int dataSize)
+{
+    Music result = {};
+    run([&](void) { result = m_raylibPtr->loadMusicStreamFromMemory(fileType, data, dataSize); });
+    return result;
+}
+
+RenderTexture2D RenderQueue::loadRenderTexture(int width, int height)
+{
+    RenderTexture2D result = {};
+    run([&](void) { result = m_raylibPtr->loadRenderTexture(width, height); });
+    return result;
+}
+
+void RenderQueue::unloadRenderTexture(RenderTexture2D target)
+{
+    post([this, target](void) { m_raylibPtr->unloadRenderTexture(target); });
+}
+
+void RenderQueue::beginTextureMode(RenderTexture2D target)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::BEGIN_TARGET;
+    command.m_target                  = targetIndex(target);
+    record(command);
+}
+
+void RenderQueue::endTextureMode(void)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::END_TARGET;
+    record(command);
+}
+
+void RenderQueue::beginScissorMode(int x, int y, int width, int height)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::BEGIN_SCISSOR;
+    command.m_dest                    = Rectangle((float)x, (float)y, (float)width, (float)height);
+    record(command);
+}
+
+void RenderQueue::endScissorMode(void)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::END_SCISSOR;
+    record(command);
+}
+
+void RenderQueue::drawRenderTexture(RenderTexture2D target, Vector2 position, Color tint)
+{
+    RenderExecutor::Command_t command = {};
+    command.m_type                    = RenderExecutor::TARGET;
+    command.m_target                  = targetIndex(target);
+    command.m_dest                    = Rectangle(position.x, position.y, 0, 0);
+    command.m_tint                    = tint;
+    record(command);
+}
+
+Sound RenderQueue::loadSoundAlias(Sound source)
+{
+    Sound result = {};
+    run([&](void) { result = m_raylibPtr->loadSoundAlias(source); });
+    return result;
+}
+
+void RenderQueue::unloadSoundAlias(Sound alias)
+{
+    post([this, alias](void) { m_raylibPtr->unloadSoundAlias(alias); });
+}
+
+void RenderQueue::setSoundVolume(Sound sound, float volume)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        m_raylibPtr->setSoundVolume(sound, volume);
+        return;
+    }
+
+    Task_t task   = {};
+    task.m_type   = SET_SOUND_VOLUME;
+    task.m_sound  = sound;
+    task.m_volume = volume;
+    post(task);
+}
+
+// like the fonts, a render texture is kept once per frame
+uint16_t RenderQueue::targetIndex(RenderTexture2D target)
+{
+    std::vector<RenderTexture2D>& targets = m_frames[m_writing].m_targets;
+    uint32_t                      index   = 0;
+    while ((index < targets.size()) && (targets[index].id != target.id))
+    {
+        index++;
+    }
+    if (index == targets.size())
+    {
+        targets.push_back(target);
+    }
+    return index;
+}
+
+// A command starts a new layer when it is not of the group of the one before,
+// a clear or a render state change is always a layer of its own.
+void RenderQueue::record(RenderExecutor::Command_t command)
+{
+    std::vector<RenderExecutor::Command_t>& commands = m_frames[m_writing].m_commands;
+    if (!commands.empty())
+    {
+        RenderExecutor::COMMAND_t previous = commands.back().m_type;
+        command.m_layer                    = commands.back().m_layer;
+        if ((groupOf(command.m_type) == 0) || (groupOf(command.m_type) != groupOf(previous)))
+        {
+            command.m_layer++;
+        }
+    }
+    commands.push_back(command);
+}
+
+// Queue call for the render thread, or make it right away on the calling thread.
+// Returns the number of the task, 0 when it already ran.
+uint64_t RenderQueue::post(std::function<void(void)> call)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        call();
+        return 0;
+    }
+
+    Task_t task = {};
+    task.m_type = CALL;
+    task.m_call = std::move(call);
+    return post(std::move(task));
+}
+
+// queue task for the render thread, returns its number
+uint64_t RenderQueue::post(Task_t task)
+{
+    uint64_t number = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+        number = ++m_posted;
+    }
+    m_taskPosted.notify_one();
+    return number;
+}
+
+// same as post(), returning once call was made
+void RenderQueue::run(std::function<void(void)> call)
+{
+    uint64_t number = post(std::move(call));
+    if (number != 0)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_taskProgress.wait(lock, [this, number](void) { return (m_finished >= number); });
+    }
+}
+
+// render thread
+void RenderQueue::renderLoop(void)
+{
+    PROFILE_THREAD("render");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_taskPosted.wait(lock, [this](void) { return (m_stopping || !m_tasks.empty()); });
+        if (m_tasks.empty())
+        {
+            return;
+        }
+
+        m_running.swap(m_tasks);
+        for (Task_t& task : m_running)
+        {
+            m_started++;
+            m_taskProgress.notify_all();
+            lock.unlock();
+            runTask(task);
+            lock.lock();
+            m_finished++;
+            m_taskProgress.notify_all();
+        }
+        m_running.clear();
+    }
+}
+
+// render thread
+void RenderQueue::runTask(Task_t& task)
+{
+    switch (task.m_type)
+    {
+        case CALL:
+            task.m_call();
+            break;
+
+        case DRAW_FRAME:
+            drawFrame(task.m_frame);
+            break;
+
+        case UPDATE_MUSIC_STREAM:
+            m_raylibPtr->updateMusicStream(task.m_music);
+            break;
+
+        case PLAY_SOUND:
+            m_raylibPtr->playSound(task.m_sound);
+            break;
+
+        case SET_SOUND_VOLUME:
+            m_raylibPtr->setSoundVolume(task.m_sound, task.m_volume);
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+}
+
+// render thread
+void RenderQueue::drawFrame(uint32_t frame)
+{
+    m_executor->execute(m_frames[frame]);
+    pollWindow(m_frameWindows[frame]);
+}
+
+// Render thread, once the window opened or closed and after every frame,
+// which is when raylib polls the input.
+void RenderQueue::pollWindow(WindowState_t& window)
+{
+    if (m_threading == CALLING_THREAD)
+    {
+        return;
+    }
+
+    window.m_time          = m_raylibPtr->getTime();
+    window.m_frameTime     = m_raylibPtr->getFrameTime();
+    window.m_shouldClose   = m_raylibPtr->windowShouldClose();
+    window.m_windowReady   = m_raylibPtr->isWindowReady();
+    window.m_mousePosition = m_raylibPtr->getMousePosition();
+    window.m_stats         = m_executor->getStats();
+    for (uint32_t key = 0; key < MAX_KEYS; key++)
+    {
+        window.m_keysDown[key]    = m_raylibPtr->isKeyDown(key);
+        window.m_keysPressed[key] = m_raylibPtr->isKeyPressed(key);
+    }
+    for (uint32_t button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    {
+        window.m_mousePressed[button] = m_raylibPtr->isMouseButtonPressed(button);
+    }
+}
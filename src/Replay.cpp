@@ -0,0 +1,338 @@
+#include "Replay.h"
+#include <algorithm>
+#include <bit>
+#include "Logger.h"
+
+namespace
+{
+const char MAGIC[4] = {'A', 'R', 'P', 'L'};
+
+enum
+{
+    FRAME_TIME     = (1 << 0),
+    MOUSE_POSITION = (1 << 1),
+    KEYS_DOWN      = (1 << 2), // the keys that went down or up
+    KEYS_PRESSED   = (1 << 3),
+    MOUSE_PRESSED  = (1 << 4),
+    ALL_CHANGES    = (FRAME_TIME | MOUSE_POSITION | KEYS_DOWN | KEYS_PRESSED | MOUSE_PRESSED)
+};
+
+void writeVarint(std::ofstream& file, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        file.put((char)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    file.put((char)value);
+}
+
+bool readVarint(std::ifstream& file, uint64_t& value)
+{
+    value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        int byte = file.get();
+        if (byte == std::char_traits<char>::eof())
+        {
+            return false;
+        }
+        value |= ((uint64_t)(byte & 0x7F) << shift);
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void writeFixed(std::ofstream& file, uint64_t value, uint32_t size)
+{
+    for (uint32_t index = 0; index < size; index++)
+    {
+        file.put((char)(value >> (8 * index)));
+    }
+}
+
+bool readFixed(std::ifstream& file, uint64_t& value, uint32_t size)
+{
+    value = 0;
+    for (uint32_t index = 0; index < size; index++)
+    {
+        int byte = file.get();
+        if (byte == std::char_traits<char>::eof())
+        {
+            return false;
+        }
+        value |= ((uint64_t)byte << (8 * index));
+    }
+    return true;
+}
+
+void writeFloat(std::ofstream& file, float value)
+{
+    writeFixed(file, std::bit_cast<uint32_t>(value), sizeof(value));
+}
+
+bool readFloat(std::ifstream& file, float& value)
+{
+    uint64_t bits = 0;
+    if (!readFixed(file, bits, sizeof(value)))
+    {
+        return false;
+    }
+    value = std::bit_cast<float>((uint32_t)bits);
+    return true;
+}
+
+// the number of keys, then every key as the difference with the previous one
+void writeKeys(std::ofstream& file, const std::bitset<Replay::MAX_KEYS>& keys)
+{
+    writeVarint(file, keys.count());
+    uint32_t previous = 0;
+    for (uint32_t key = 0; key < Replay::MAX_KEYS; key++)
+    {
+        if (keys[key])
+        {
+            writeVarint(file, key - previous);
+            previous = key;
+        }
+    }
+}
+
+bool readKeys(std::ifstream& file, std::bitset<Replay::MAX_KEYS>& keys)
+{
+    uint64_t count = 0;
+    if (!readVarint(file, count) || (count > Replay::MAX_KEYS))
+    {
+        return false;
+    }
+    uint64_t key = 0;
+    for (uint64_t index = 0; index < count; index++)
+    {
+        uint64_t delta = 0;
+        if (!readVarint(file, delta) || ((key + delta) >= Replay::MAX_KEYS))
+        {
+            return false;
+        }
+        key      += delta;
+        keys[key] = true;
+    }
+    return true;
+}
+
+bool sameBits(float first, float second)
+{
+    return (std::bit_cast<uint32_t>(first) == std::bit_cast<uint32_t>(second));
+}
+} // namespace
+
+Replay::Writer::Writer(const std::string& fileName, uint64_t seed)
+{
+    m_fileName = fileName;
+    m_file.open(fileName, std::ios::binary | std::ios::trunc);
+    if (!m_file)
+    {
+        Logger::getInstance().log(Logger::ERROR, "replay not written: " + fileName);
+        return;
+    }
+    m_file.write(MAGIC, sizeof(MAGIC));
+    writeVarint(m_file, VERSION);
+    writeFixed(m_file, seed, sizeof(seed));
+}
+
+Replay::Writer::~Writer(void)
+{
+    close();
+}
+
+bool Replay::Writer::isOpen(void) const
+{
+    return m_file.is_open();
+}
+
+void Replay::Writer::write(const Frame_t& frame)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    m_frames++;
+
+    uint8_t changes = 0;
+    if (!sameBits(frame.m_frameTime, m_previous.m_frameTime))
+    {
+        changes |= FRAME_TIME;
+    }
+    if (!sameBits(frame.m_mousePosition.x, m_previous.m_mousePosition.x) || !sameBits(frame.m_mousePosition.y, m_previous.m_mousePosition.y))
+    {
+        changes |= MOUSE_POSITION;
+    }
+    if (frame.m_keysDown != m_previous.m_keysDown)
+    {
+        changes |= KEYS_DOWN;
+    }
+    if (frame.m_keysPressed.any())
+    {
+        changes |= KEYS_PRESSED;
+    }
+    if (frame.m_mousePressed != 0)
+    {
+        changes |= MOUSE_PRESSED;
+    }
+    if (changes == 0)
+    {
+        m_idleRun++;
+        return;
+    }
+
+    endIdleRun();
+    m_file.put((char)changes);
+    if (changes & FRAME_TIME)
+    {
+        writeFloat(m_file, frame.m_frameTime);
+    }
+    if (changes & MOUSE_POSITION)
+    {
+        writeFloat(m_file, frame.m_mousePosition.x);
+        writeFloat(m_file, frame.m_mousePosition.y);
+    }
+    if (changes & KEYS_DOWN)
+    {
+        writeKeys(m_file, frame.m_keysDown ^ m_previous.m_keysDown);
+    }
+    if (changes & KEYS_PRESSED)
+    {
+        writeKeys(m_file, frame.m_keysPressed);
+    }
+    if (changes & MOUSE_PRESSED)
+    {
+        m_file.put((char)frame.m_mousePressed);
+    }
+    m_previous = frame;
+}
+
+void Replay::Writer::close(void)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    endIdleRun();
+    m_file.close();
+    if (!m_file)
+    {
+        Logger::getInstance().log(Logger::ERROR, "replay not written: " + m_fileName);
+        return;
+    }
+    Logger::getInstance().log(Logger::INFO, std::to_string(m_frames) + " frames recorded to " + m_fileName);
+}
+
+uint64_t Replay::Writer::getFrameCount(void) const
+{
+    return m_frames;
+}
+
+void Replay::Writer::endIdleRun(void)
+{
+    if (m_idleRun > 0)
+    {
+        m_file.put(0);
+        writeVarint(m_file, m_idleRun);
+        m_idleRun = 0;
+    }
+}
+
+Replay::Reader::Reader(const std::string& fileName)
+{
+    m_fileName = fileName;
+    m_file.open(fileName, std::ios::binary);
+
+    char     magic[sizeof(MAGIC)] = {};
+    uint64_t version              = 0;
+    if (!m_file.read(magic, sizeof(magic)) ||
+        !std::equal(magic, magic + sizeof(magic), MAGIC) ||
+        !readVarint(m_file, version) ||
+        (version != VERSION) ||
+        !readFixed(m_file, m_seed, sizeof(m_seed)))
+    {
+        Logger::getInstance().log(Logger::WARNING, "replay not opened: " + fileName);
+        m_file.close();
+    }
+}
+
+bool Replay::Reader::isOpen(void) const
+{
+    return m_file.is_open();
+}
+
+uint64_t Replay::Reader::getSeed(void) const
+{
+    return m_seed;
+}
+
+// The next frame, false at the end of the session. A corrupt frame ends the
+// session there.
+bool Replay::Reader::read(Frame_t& frame)
+{
+    if (!isOpen())
+    {
+        return false;
+    }
+
+    frame = m_previous;
+    frame.m_keysPressed.reset();
+    frame.m_mousePressed = 0;
+    if (m_idleRun > 0)
+    {
+        m_idleRun--;
+        return true;
+    }
+
+    int changes = m_file.get();
+    if (changes == std::char_traits<char>::eof())
+    {
+        m_file.close();
+        return false;
+    }
+
+    bool valid = ((changes & ~ALL_CHANGES) == 0);
+    if (valid && (changes == 0))
+    {
+        valid     = (readVarint(m_file, m_idleRun) && (m_idleRun > 0));
+        m_idleRun = valid ? (m_idleRun - 1) : 0;
+    }
+    if (valid && (changes & FRAME_TIME))
+    {
+        valid = readFloat(m_file, frame.m_frameTime);
+    }
+    if (valid && (changes & MOUSE_POSITION))
+    {
+        valid = (readFloat(m_file, frame.m_mousePosition.x) && readFloat(m_file, frame.m_mousePosition.y));
+    }
+    if (valid && (changes & KEYS_DOWN))
+    {
+        std::bitset<MAX_KEYS> toggled;
+        valid             = readKeys(m_file, toggled);
+        frame.m_keysDown ^= toggled;
+    }
+    if (valid && (changes & KEYS_PRESSED))
+    {
+        valid = readKeys(m_file, frame.m_keysPressed);
+    }
+    if (valid && (changes & MOUSE_PRESSED))
+    {
+        int buttons          = m_file.get();
+        valid                = ((buttons != std::char_traits<char>::eof()) && (buttons < (1 << MAX_MOUSE_BUTTONS)));
+        frame.m_mousePressed = (uint8_t)buttons;
+    }
+
+    if (!valid)
+    {
+        Logger::getInstance().log(Logger::ERROR, "corrupt replay frame in " + m_fileName);
+        m_file.close();
+        return false;
+    }
+    m_previous = frame;
+    return true;
+}
@@ -1,24 +1,207 @@
 #include "SpriteFactory.h"
+#include <algorithm>
 #include <cassert>
 #include "Explosion.h"
+#include "GameSettings.h"
 #include "Laser.h"
 #include "Meteor.h"
 #include "Opponent.h"
 #include "Powerup.h"
+#include "Profiler.h"
 #include "Star.h"
 
-SpriteFactory::SpriteFactory(void)
+SpriteFactory::SpriteFactory(std::shared_ptr<Random> randomPtr)
 {
+    assert(randomPtr != nullptr);
+    m_random = randomPtr;
+    for (Pool_t& pool : m_pools)
+    {
+        pool.m_idle.reserve(SPRITE_POOL_CAPACITY);
+        pool.m_stats.m_capacity = SPRITE_POOL_CAPACITY;
+    }
 }
 
 SpriteFactory::~SpriteFactory(void)
 {
 }
 
+// Hand out an idle sprite of the requested type when one has been recycled,
+// reinitialised through Sprite::reset(); only fall back to a new allocation
+// when the pool is empty.
 std::shared_ptr<Sprite> SpriteFactory::getSprite(SpriteType                                type,
                                                  std::shared_ptr<RaylibInterface>          raylibPtr,
                                                  Sprite::SpriteAttr_t                      attr,
                                                  std::function<void(Sprite::SpriteAttr_t)> shootLaser)
+{
+    PROFILE_ZONE("SpriteFactory::getSprite");
+    assert(type < UNDEFINED);
+    Pool_t&                 pool = m_pools[type];
+    std::shared_ptr<Sprite> ret  = nullptr;
+
+    if (type == RED_LASER)
+    {
+        attr.m_color = WHITE;
+    }
+    else if (type == YELLOW_LASER)
+    {
+        attr.m_color = YELLOW;
+    }
+    else if ((type == METEOR) || (type == OPPONENT) || (type == STAR) || (type == POWERUP))
+    {
+        attr = nextSpawnAttributes(type);
+    }
+
+    if (pool.m_idle.empty())
+    {
+        ret = makeSprite(type, raylibPtr, attr, shootLaser);
+        pool.m_stats.m_allocations++;
+    }
+    else
+    {
+        ret = std::move(pool.m_idle.back());
+        pool.m_idle.pop_back();
+        if (type == OPPONENT)
+        {
+            std::static_pointer_cast<Opponent>(ret)->setShootLaser(shootLaser);
+        }
+        ret->reset(attr);
+        pool.m_stats.m_reuses++;
+    }
+
+    pool.m_stats.m_idle          = pool.m_idle.size();
+    pool.m_stats.m_live++;
+    pool.m_stats.m_highWaterMark = std::max(pool.m_stats.m_highWaterMark, pool.m_stats.m_live);
+
+    // every sprite of the busiest moment can come back, so that the same burst
+    // is served from the pool the next time
+    if (!pool.m_capped)
+    {
+        pool.m_stats.m_capacity = std::max(pool.m_stats.m_capacity, pool.m_stats.m_highWaterMark);
+    }
+    return ret;
+}
+
+// Take back a sprite that left the game; it is kept for reuse while the pool
+// has room, otherwise it is released. An uncapped pool has room for as many
+// sprites as were ever live at once.
+void SpriteFactory::recycleSprite(SpriteType type, std::shared_ptr<Sprite> sprite)
+{
+    assert(type < UNDEFINED);
+    assert(sprite != nullptr);
+    Pool_t& pool = m_pools[type];
+
+    if (pool.m_stats.m_live > 0)
+    {
+        pool.m_stats.m_live--;
+    }
+    if (pool.m_idle.size() < pool.m_stats.m_capacity)
+    {
+        pool.m_idle.push_back(std::move(sprite));
+    }
+    pool.m_stats.m_idle = pool.m_idle.size();
+}
+
+void SpriteFactory::setPoolCapacity(SpriteType type, uint32_t capacity)
+{
+    assert(type < UNDEFINED);
+    Pool_t& pool = m_pools[type];
+
+    if (pool.m_idle.size() > capacity)
+    {
+        pool.m_idle.resize(capacity);
+    }
+    pool.m_idle.reserve(capacity);
+    pool.m_stats.m_capacity = capacity;
+    pool.m_capped           = true;
+    pool.m_stats.m_idle     = pool.m_idle.size();
+}
+
+SpriteFactory::PoolStats_t SpriteFactory::getPoolStats(SpriteType type) const
+{
+    assert(type < UNDEFINED);
+    return m_pools[type].m_stats;
+}
+
+// Draw the random spawn attributes of count sprites of a randomly placed type,
+// one range at a time for all of them.
+void SpriteFactory::fillSpawnAttributes(SpriteType type, Sprite::SpriteAttr_t* attrs, uint32_t count)
+{
+    m_intValues.resize(count);
+    m_floatValues.resize(count);
+
+    auto intRange = [this, attrs, count](int32_t min, int32_t max, auto set) {
+        m_random->fillInt(m_intValues.data(), count, min, max);
+        for (uint32_t index = 0; index < count; index++)
+        {
+            set(attrs[index], (float)m_intValues[index]);
+        }
+    };
+    auto floatRange = [this, attrs, count](float min, float max, auto set) {
+        m_random->fillFloat(m_floatValues.data(), count, min, max);
+        for (uint32_t index = 0; index < count; index++)
+        {
+            set(attrs[index], m_floatValues[index]);
+        }
+    };
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        attrs[index] = Sprite::SpriteAttr_t();
+    }
+
+    switch (type)
+    {
+        case METEOR:
+            intRange(0, WINDOW_WIDTH, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_position.x = value; });
+            intRange(-150, -50, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_position.y = value; });
+            intRange(300, 400, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_speed = value; });
+            floatRange(-0.5, 0.5, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_direction = {value, 1}; });
+            break;
+
+        case OPPONENT:
+            intRange(0, WINDOW_WIDTH, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_position.x = value; });
+            intRange(-150, -50, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_position.y = value; });
+            break;
+
+        case STAR:
+            intRange(0, WINDOW_WIDTH, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_position.x = value; });
+            intRange(0, WINDOW_HEIGHT, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_position.y = value; });
+            floatRange(0.5, 1.6, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_scale = value; });
+            break;
+
+        case POWERUP:
+            intRange(0, WINDOW_WIDTH, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_position.x = value; });
+            intRange(350, 450, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_speed = value; });
+            floatRange(-0.5, 0.5, [](Sprite::SpriteAttr_t& attr, float value) { attr.m_direction = {value, 1}; });
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+}
+
+// hand out the spawn attributes in the order they were drawn
+Sprite::SpriteAttr_t SpriteFactory::nextSpawnAttributes(SpriteType type)
+{
+    std::vector<Sprite::SpriteAttr_t>& spawns = m_pools[type].m_spawns;
+
+    if (spawns.empty())
+    {
+        spawns.resize(SPAWN_BATCH);
+        fillSpawnAttributes(type, spawns.data(), SPAWN_BATCH);
+        std::reverse(spawns.begin(), spawns.end());
+    }
+
+    Sprite::SpriteAttr_t ret = spawns.back();
+    spawns.pop_back();
+    return ret;
+}
+
+std::shared_ptr<Sprite> SpriteFactory::makeSprite(SpriteType                                type,
+                                                  std::shared_ptr<RaylibInterface>          raylibPtr,
+                                                  Sprite::SpriteAttr_t                      attr,
+                                                  std::function<void(Sprite::SpriteAttr_t)> shootLaser)
 {
     std::shared_ptr<Sprite> ret = nullptr;
 
@@ -29,35 +212,28 @@ std::shared_ptr<Sprite> SpriteFactory::getSprite(SpriteType
             break;
 
         case RED_LASER:
-            ret = std::make_shared<Laser>(raylibPtr,
-                                          attr.m_position,
-                                          attr.m_direction,
-                                          attr.m_rotation,
-                                          WHITE);
-            break;
-
         case YELLOW_LASER:
             ret = std::make_shared<Laser>(raylibPtr,
                                           attr.m_position,
                                           attr.m_direction,
                                           attr.m_rotation,
-                                          YELLOW);
+                                          attr.m_color);
             break;
 
         case METEOR:
-            ret = std::make_shared<Meteor>(raylibPtr);
+            ret = std::make_shared<Meteor>(raylibPtr, attr);
             break;
 
         case OPPONENT:
-            ret = std::make_shared<Opponent>(raylibPtr, shootLaser);
+            ret = std::make_shared<Opponent>(raylibPtr, shootLaser, attr);
             break;
 
         case STAR:
-            ret = std::make_shared<Star>(raylibPtr);
+            ret = std::make_shared<Star>(raylibPtr, attr);
             break;
 
         case POWERUP:
-            ret = std::make_shared<Powerup>(raylibPtr);
+            ret = std::make_shared<Powerup>(raylibPtr, attr);
             break;
 
         case UNDEFINED:
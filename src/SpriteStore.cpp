@@ -0,0 +1,463 @@
+#include "SpriteStore.h"
+#include <cassert>
+
+SpriteStore::SpriteStore(SHAPE_t shape)
+{
+    m_shape = shape;
+}
+
+// A store of packed arrays draws through raylibPtr. The sprites already in the
+// store are packed, the packed ones cannot be handed back to their objects.
+void SpriteStore::setLayout(LAYOUT_t layout, std::shared_ptr<RaylibInterface> raylibPtr)
+{
+    assert((layout == PACKED_ARRAYS) || (m_layout == SPRITE_OBJECTS) || m_sprites.empty());
+    assert((layout == SPRITE_OBJECTS) || (raylibPtr != nullptr));
+    if ((layout == PACKED_ARRAYS) && (m_layout == SPRITE_OBJECTS))
+    {
+        resizeBodies(0);
+        for (uint32_t index = 0; index < m_sprites.size(); index++)
+        {
+            pushBody(m_sprites[index]->getBody());
+        }
+        m_syncedCount = 0;
+    }
+    m_layout    = layout;
+    m_raylibPtr = raylibPtr;
+}
+
+SpriteStore::Handle_t SpriteStore::add(std::shared_ptr<Sprite> sprite)
+{
+    assert(sprite != nullptr);
+    sprite->settle();
+    if (m_layout == PACKED_ARRAYS)
+    {
+        pushBody(sprite->getBody());
+    }
+    return m_sprites.insert(sprite);
+}
+
+SpriteStore::Handle_t SpriteStore::nextHandle(void) const
+{
+    return m_sprites.nextHandle();
+}
+
+bool SpriteStore::contains(Handle_t handle) const
+{
+    return m_sprites.contains(handle);
+}
+
+void SpriteStore::remove(Handle_t handle)
+{
+    if (m_layout == PACKED_ARRAYS)
+    {
+        // the same swap with the last sprite as the slot map
+        moveBody(m_sprites.indexOf(handle), (m_sprites.size() - 1));
+        resizeBodies(m_sprites.size() - 1);
+    }
+    m_sprites.erase(handle);
+    m_syncedCount = 0;
+}
+
+void SpriteStore::update(void)
+{
+    step(0);
+}
+
+void SpriteStore::draw(void)
+{
+    drawBlended(1);
+}
+
+void SpriteStore::step(float tickTime)
+{
+    if (m_layout == PACKED_ARRAYS)
+    {
+        stepPacked(tickTime);
+        return;
+    }
+    for (uint32_t index = 0; index < m_sprites.size(); index++)
+    {
+        m_sprites[index]->step(tickTime);
+    }
+}
+
+void SpriteStore::drawBlended(float blend)
+{
+    if (m_layout == PACKED_ARRAYS)
+    {
+        drawPacked(blend);
+        return;
+    }
+    for (uint32_t index = 0; index < m_sprites.size(); index++)
+    {
+        m_sprites[index]->drawBlended(blend);
+    }
+}
+
+// Gather the collision shape of every sprite into the per-field arrays, so that
+// the pair tests in Game::checkCollisions run over contiguous memory instead of
+// making virtual getter calls for every pair.
+void SpriteStore::sync(void)
+{
+    if (m_layout == PACKED_ARRAYS)
+    {
+        syncPacked();
+        return;
+    }
+
+    m_syncedCount = m_sprites.size();
+
+    m_flags.resize(m_syncedCount);
+    for (uint32_t index = 0; index < m_syncedCount; index++)
+    {
+        m_flags[index] = m_sprites[index]->m_discard ? FLAG_DISCARD : 0;
+    }
+
+    switch (m_shape)
+    {
+        case CIRCLE:
+        {
+            m_centerX.resize(m_syncedCount);
+            m_centerY.resize(m_syncedCount);
+            m_radius.resize(m_syncedCount);
+            for (uint32_t index = 0; index < m_syncedCount; index++)
+            {
+                m_radius[index]  = m_sprites[index]->getRadius();
+                Vector2 center   = m_sprites[index]->getCenter();
+                m_centerX[index] = center.x;
+                m_centerY[index] = center.y;
+            }
+            break;
+        }
+
+        case RECTANGLE:
+        {
+            m_rectX.resize(m_syncedCount);
+            m_rectY.resize(m_syncedCount);
+            m_rectWidth.resize(m_syncedCount);
+            m_rectHeight.resize(m_syncedCount);
+            for (uint32_t index = 0; index < m_syncedCount; index++)
+            {
+                Rectangle rect      = m_sprites[index]->getRect();
+                m_rectX[index]      = rect.x;
+                m_rectY[index]      = rect.y;
+                m_rectWidth[index]  = rect.width;
+                m_rectHeight[index] = rect.height;
+            }
+            break;
+        }
+
+        case NO_SHAPE:
+        default:
+            break;
+    }
+}
+
+void SpriteStore::discard(uint32_t index)
+{
+    assert(index < m_syncedCount);
+    m_flags[index]              |= FLAG_DISCARD;
+    m_sprites[index]->m_discard  = true;
+}
+
+// Discards the synced sprites whose bounds lie wholly outside bounds, returns
+// how many were discarded.
+uint32_t SpriteStore::cull(Rectangle bounds)
+{
+    uint32_t culled = 0;
+    for (uint32_t index = 0; index < m_syncedCount; index++)
+    {
+        if (isDiscarded(index))
+        {
+            continue;
+        }
+        Rectangle sprite = getBounds(index);
+        if (((sprite.x + sprite.width) < bounds.x) || (sprite.x > (bounds.x + bounds.width)) ||
+            ((sprite.y + sprite.height) < bounds.y) || (sprite.y > (bounds.y + bounds.height)))
+        {
+            discard(index);
+            m_flags[index] |= FLAG_CULLED;
+            culled++;
+        }
+    }
+    return culled;
+}
+
+// Removed sprites are handed to the recycler, if any, before the store drops them.
+void SpriteStore::discardMarked(Recycler_t recycler)
+{
+    if (m_layout == PACKED_ARRAYS)
+    {
+        // the same compaction as the slot map, the flags match the sprites
+        uint32_t kept = 0;
+        for (uint32_t index = 0; index < m_sprites.size(); index++)
+        {
+            if ((m_flags[index] & FLAG_DISCARD) == 0)
+            {
+                moveBody(kept, index);
+                kept++;
+            }
+        }
+        resizeBodies(kept);
+    }
+    m_sprites.eraseIf([&recycler](const std::shared_ptr<Sprite>& sprite)
+                      {
+                          if (sprite->m_discard && recycler)
+                          {
+                              recycler(sprite);
+                          }
+                          return sprite->m_discard;
+                      });
+    m_syncedCount = 0;
+}
+
+void SpriteStore::clear(Recycler_t recycler)
+{
+    if (recycler)
+    {
+        for (uint32_t index = 0; index < m_sprites.size(); index++)
+        {
+            recycler(m_sprites[index]);
+        }
+    }
+    m_sprites.clear();
+    m_syncedCount = 0;
+    if (m_layout == PACKED_ARRAYS)
+    {
+        resizeBodies(0);
+    }
+}
+
+uint32_t SpriteStore::size(void) const
+{
+    return m_sprites.size();
+}
+
+bool SpriteStore::isDiscarded(uint32_t index) const
+{
+    assert(index < m_syncedCount);
+    return ((m_flags[index] & FLAG_DISCARD) != 0);
+}
+
+bool SpriteStore::isCulled(uint32_t index) const
+{
+    assert(index < m_syncedCount);
+    return ((m_flags[index] & FLAG_CULLED) != 0);
+}
+
+Vector2 SpriteStore::getCenter(uint32_t index) const
+{
+    assert(m_shape == CIRCLE);
+    assert(index < m_syncedCount);
+    return (Vector2(m_centerX[index], m_centerY[index]));
+}
+
+float SpriteStore::getRadius(uint32_t index) const
+{
+    assert(m_shape == CIRCLE);
+    assert(index < m_syncedCount);
+    return m_radius[index];
+}
+
+Rectangle SpriteStore::getRect(uint32_t index) const
+{
+    assert(m_shape == RECTANGLE);
+    assert(index < m_syncedCount);
+    return (Rectangle(m_rectX[index], m_rectY[index], m_rectWidth[index], m_rectHeight[index]));
+}
+
+// Axis-aligned box around the synced collision shape.
+Rectangle SpriteStore::getBounds(uint32_t index) const
+{
+    assert(m_shape != NO_SHAPE);
+    assert(index < m_syncedCount);
+    if (m_shape == CIRCLE)
+    {
+        return (Rectangle(m_centerX[index] - m_radius[index],
+                          m_centerY[index] - m_radius[index],
+                          2 * m_radius[index],
+                          2 * m_radius[index]));
+    }
+    return getRect(index);
+}
+
+// Views of the synced collision arrays for the batched narrow-phase kernels,
+// valid until the next sync() or removal.
+CollisionKernels::CircleBatch_t SpriteStore::circleBatch(void) const
+{
+    assert(m_shape == CIRCLE);
+    return (CollisionKernels::CircleBatch_t(m_centerX.data(), m_centerY.data(), m_radius.data(), m_syncedCount));
+}
+
+CollisionKernels::RectBatch_t SpriteStore::rectBatch(void) const
+{
+    assert(m_shape == RECTANGLE);
+    return (CollisionKernels::RectBatch_t(m_rectX.data(), m_rectY.data(), m_rectWidth.data(), m_rectHeight.data(), m_syncedCount));
+}
+
+std::shared_ptr<Sprite> SpriteStore::getSprite(uint32_t index) const
+{
+    return m_sprites[index];
+}
+
+SpriteStore::Handle_t SpriteStore::getHandle(uint32_t index) const
+{
+    return m_sprites.handleAt(index);
+}
+
+// Move every packed sprite, then the few that wrap, animate or act, tickTime
+// being in seconds, 0 meaning raylib's frame time. Same arithmetic as the
+// sprites' own update().
+void SpriteStore::stepPacked(float tickTime)
+{
+    float    dt    = (tickTime > 0) ? tickTime : m_raylibPtr->getFrameTime();
+    uint32_t count = m_sprites.size();
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        m_previousX[index]  = m_positionX[index];
+        m_previousY[index]  = m_positionY[index];
+        m_positionX[index] += m_directionX[index] * m_speed[index] * dt;
+        m_positionY[index] += m_directionY[index] * m_speed[index] * dt;
+        m_rotation[index]  += m_spin[index] * dt;
+    }
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        Look_t& look = m_looks[index];
+        if ((look.m_wrapHeight > 0) && (m_positionY[index] > look.m_wrapHeight))
+        {
+            m_positionY[index] -= look.m_wrapHeight;
+            m_previousY[index] -= look.m_wrapHeight;
+        }
+        if (look.m_frameRate > 0)
+        {
+            look.m_frame += (uint32_t)(look.m_frameRate * dt);
+            if (look.m_frame >= look.m_frames.size())
+            {
+                look.m_frame                = 0;
+                m_flags[index]             |= FLAG_DISCARD;
+                m_sprites[index]->m_discard  = true;
+            }
+        }
+        if (look.m_acts)
+        {
+            m_sprites[index]->act(Vector2(m_positionX[index], m_positionY[index]));
+        }
+    }
+}
+
+// blend places the sprites between their last two positions
+void SpriteStore::drawPacked(float blend)
+{
+    for (uint32_t index = 0; index < m_sprites.size(); index++)
+    {
+        const Look_t&                look  = m_looks[index];
+        const TextureAtlas::Frame_t& frame = look.m_frames[look.m_frame];
+        float                        x     = m_previousX[index] + ((m_positionX[index] - m_previousX[index]) * blend);
+        float                        y     = m_previousY[index] + ((m_positionY[index] - m_previousY[index]) * blend);
+        Rectangle                    dest  = Rectangle(x, y, frame.m_source.width * look.m_scale, frame.m_source.height * look.m_scale);
+        m_raylibPtr->drawTexturePro(frame.m_texture, frame.m_source, dest, look.m_origin, m_rotation[index], look.m_tint);
+    }
+}
+
+// the radius, the rectangle size and the flags are kept up to date already
+void SpriteStore::syncPacked(void)
+{
+    m_syncedCount = m_sprites.size();
+    switch (m_shape)
+    {
+        case CIRCLE:
+            m_centerX.resize(m_syncedCount);
+            m_centerY.resize(m_syncedCount);
+            for (uint32_t index = 0; index < m_syncedCount; index++)
+            {
+                m_centerX[index] = m_positionX[index] + m_offsetX[index];
+                m_centerY[index] = m_positionY[index] + m_offsetY[index];
+            }
+            break;
+
+        case RECTANGLE:
+            m_rectX.resize(m_syncedCount);
+            m_rectY.resize(m_syncedCount);
+            for (uint32_t index = 0; index < m_syncedCount; index++)
+            {
+                m_rectX[index] = m_positionX[index] + m_offsetX[index];
+                m_rectY[index] = m_positionY[index] + m_offsetY[index];
+            }
+            break;
+
+        case NO_SHAPE:
+        default:
+            break;
+    }
+}
+
+void SpriteStore::pushBody(const Sprite::Body_t& body)
+{
+    m_positionX.push_back(body.m_position.x);
+    m_positionY.push_back(body.m_position.y);
+    m_previousX.push_back(body.m_position.x);
+    m_previousY.push_back(body.m_position.y);
+    m_directionX.push_back(body.m_direction.x);
+    m_directionY.push_back(body.m_direction.y);
+    m_speed.push_back(body.m_speed);
+    m_rotation.push_back(body.m_rotation);
+    m_spin.push_back(body.m_spin);
+    m_offsetX.push_back(body.m_offset.x);
+    m_offsetY.push_back(body.m_offset.y);
+    m_radius.push_back(body.m_radius);
+    m_rectWidth.push_back(body.m_size.x);
+    m_rectHeight.push_back(body.m_size.y);
+    m_flags.push_back(0);
+
+    Look_t look;
+    look.m_frames     = body.m_frames;
+    look.m_frameRate  = body.m_frameRate;
+    look.m_scale      = body.m_scale;
+    look.m_origin     = body.m_origin;
+    look.m_tint       = body.m_tint;
+    look.m_wrapHeight = body.m_wrapHeight;
+    look.m_acts       = body.m_acts;
+    m_looks.push_back(look);
+}
+
+void SpriteStore::moveBody(uint32_t to, uint32_t from)
+{
+    m_positionX[to]  = m_positionX[from];
+    m_positionY[to]  = m_positionY[from];
+    m_previousX[to]  = m_previousX[from];
+    m_previousY[to]  = m_previousY[from];
+    m_directionX[to] = m_directionX[from];
+    m_directionY[to] = m_directionY[from];
+    m_speed[to]      = m_speed[from];
+    m_rotation[to]   = m_rotation[from];
+    m_spin[to]       = m_spin[from];
+    m_offsetX[to]    = m_offsetX[from];
+    m_offsetY[to]    = m_offsetY[from];
+    m_radius[to]     = m_radius[from];
+    m_rectWidth[to]  = m_rectWidth[from];
+    m_rectHeight[to] = m_rectHeight[from];
+    m_flags[to]      = m_flags[from];
+    m_looks[to]      = m_looks[from];
+}
+
+void SpriteStore::resizeBodies(uint32_t count)
+{
+    m_positionX.resize(count);
+    m_positionY.resize(count);
+    m_previousX.resize(count);
+    m_previousY.resize(count);
+    m_directionX.resize(count);
+    m_directionY.resize(count);
+    m_speed.resize(count);
+    m_rotation.resize(count);
+    m_spin.resize(count);
+    m_offsetX.resize(count);
+    m_offsetY.resize(count);
+    m_radius.resize(count);
+    m_rectWidth.resize(count);
+    m_rectHeight.resize(count);
+    m_flags.resize(count);
+    m_looks.resize(count);
+}
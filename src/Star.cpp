@@ -1,42 +1,39 @@
 #include "Star.h"
 #include <cassert>
-#include <random>
 #include "GameSettings.h"
 
-Star::Star(std::shared_ptr<RaylibInterface> raylibPtr)
+Star::Star(std::shared_ptr<RaylibInterface> raylibPtr, Sprite::SpriteAttr_t attr)
 {
     assert(raylibPtr->isWindowReady());
     m_raylibPtr = raylibPtr;
+    reset(attr);
+}
 
-    // Random number generator
-    std::random_device rd;
-    std::mt19937       gen(rd()); // Mersenne Twister engine
-
-    std::uniform_int_distribution<>       distX(0, WINDOW_WIDTH);
-    std::uniform_int_distribution<>       distY(0, WINDOW_HEIGHT);
-    std::uniform_real_distribution<float> distScale(0.5, 1.6);
-
-    m_position.x = distX(gen);
-    m_position.y = distY(gen);
-    m_scale      = distScale(gen);
+void Star::reset(Sprite::SpriteAttr_t attr)
+{
+    // the position and scale are drawn by SpriteFactory
+    m_position = attr.m_position;
+    m_scale    = attr.m_scale;
+    m_discard  = false;
 }
 
 void Star::update(void)
 {
     assert(m_textures.size() == 1);
 
-    float dt      = m_raylibPtr->getFrameTime();
+    float dt      = frameTime();
     m_position.y += STAR_SPEED * dt;
     if (m_position.y > WINDOW_HEIGHT)
     {
-        m_position.y -= WINDOW_HEIGHT;
+        m_position.y         -= WINDOW_HEIGHT;
+        m_previousPosition.y -= WINDOW_HEIGHT;
     }
 }
 
 void Star::draw(void)
 {
     assert(m_textures.size() == 1);
-    m_raylibPtr->drawTextureEx(m_textures[0], m_position, 0, m_scale, WHITE);
+    drawFrame(m_textures[0], drawPosition(), 0, m_scale, WHITE);
 }
 
 Vector2 Star::getCenter(void)
@@ -57,7 +54,20 @@ Rectangle Star::getRect(void)
     return (Rectangle(0, 0, 0, 0));
 }
 
-void Star::setTextures(std::vector<Texture2D> textures)
+Sprite::Body_t Star::getBody(void)
+{
+    assert(m_textures.size() == 1);
+    Body_t body;
+    body.m_frames     = m_textures;
+    body.m_position   = m_position;
+    body.m_direction  = Vector2(0, 1);
+    body.m_speed      = STAR_SPEED;
+    body.m_scale      = m_scale;
+    body.m_wrapHeight = WINDOW_HEIGHT;
+    return body;
+}
+
+void Star::setTextures(TextureAtlas::Frames_t textures)
 {
     assert(textures.size() == 1);
     m_textures = textures;
@@ -0,0 +1,155 @@
+#include "TextCache.h"
+#include <functional>
+
+size_t TextCache::Hash_s::operator()(const KeyView_t& key) const
+{
+    size_t hash = std::hash<std::string_view>()(key.m_text);
+    hash       ^= std::hash<uint32_t>()(key.m_texture) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash       ^= std::hash<float>()(key.m_fontSize) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash       ^= std::hash<float>()(key.m_spacing) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+bool TextCache::Equal_s::operator()(const KeyView_t& first, const KeyView_t& second) const
+{
+    return ((first.m_texture == second.m_texture) &&
+            (first.m_fontSize == second.m_fontSize) &&
+            (first.m_spacing == second.m_spacing) &&
+            (first.m_text == second.m_text));
+}
+
+// the quads of text, laid out the first time it is drawn since it was dropped
+const std::vector<TextCache::Quad_t>& TextCache::getQuads(const Font& font, std::string_view text, float fontSize, float spacing)
+{
+    auto entry = m_entries.find(KeyView_t(font.texture.id, fontSize, spacing, text));
+    if (entry == m_entries.end())
+    {
+        entry = m_entries.emplace(Key_t(font.texture.id, fontSize, spacing, std::string(text)), Entry_t()).first;
+        layout(font, text, fontSize, spacing, entry->second.m_quads);
+        m_layouts++;
+    }
+    entry->second.m_drawn = true;
+    return entry->second.m_quads;
+}
+
+// drop the texts not drawn during the frame
+void TextCache::endFrame(void)
+{
+    std::erase_if(m_entries, [](const auto& entry) { return !entry.second.m_drawn; });
+    for (auto& entry : m_entries)
+    {
+        entry.second.m_drawn = false;
+    }
+}
+
+// to be called when a font is unloaded, its texture id may be reused
+void TextCache::clear(void)
+{
+    m_entries.clear();
+}
+
+uint32_t TextCache::size(void) const
+{
+    return m_entries.size();
+}
+
+uint64_t TextCache::getLayoutCount(void) const
+{
+    return m_layouts;
+}
+
+// DrawTextEx() and DrawTextCodepoint() of raylib 5.5, with the quads kept
+// instead of drawn: spaces and tabs only advance, line feeds start a new line
+void TextCache::layout(const Font& font, std::string_view text, float fontSize, float spacing, std::vector<Quad_t>& quads)
+{
+    float scale   = fontSize / font.baseSize;
+    float padding = font.glyphPadding;
+    float offsetX = 0;
+    float offsetY = 0;
+
+    quads.clear();
+    while (!text.empty())
+    {
+        uint32_t size      = 1;
+        int32_t  codepoint = nextCodepoint(text, size);
+        text.remove_prefix(size);
+
+        if (codepoint == '\n')
+        {
+            offsetY += fontSize + LINE_SPACING;
+            offsetX  = 0;
+            continue;
+        }
+
+        int32_t          index = glyphIndex(font, codepoint);
+        const Rectangle& rec   = font.recs[index];
+        const GlyphInfo& glyph = font.glyphs[index];
+        if ((codepoint != ' ') && (codepoint != '\t'))
+        {
+            Quad_t quad;
+            quad.m_source = Rectangle((rec.x - padding), (rec.y - padding), (rec.width + (2 * padding)), (rec.height + (2 * padding)));
+            quad.m_dest   = Rectangle((offsetX + ((glyph.offsetX - padding) * scale)),
+                                    (offsetY + ((glyph.offsetY - padding) * scale)),
+                                    ((rec.width + (2 * padding)) * scale),
+                                    ((rec.height + (2 * padding)) * scale));
+            quads.push_back(quad);
+        }
+        offsetX += (((glyph.advanceX == 0) ? rec.width : glyph.advanceX) * scale) + spacing;
+    }
+}
+
+// GetGlyphIndex() of raylib, the glyph of '?' for a codepoint the font lacks
+int32_t TextCache::glyphIndex(const Font& font, int32_t codepoint)
+{
+    int32_t fallback = 0;
+    for (int32_t index = 0; index < font.glyphCount; index++)
+    {
+        if (font.glyphs[index].value == codepoint)
+        {
+            return index;
+        }
+        if (font.glyphs[index].value == '?')
+        {
+            fallback = index;
+        }
+    }
+    return fallback;
+}
+
+// GetCodepointNext() of raylib, '?' and a size of 1 for a malformed sequence
+int32_t TextCache::nextCodepoint(std::string_view text, uint32_t& size)
+{
+    auto byte = [text](uint32_t index) { return (index < text.size()) ? (uint8_t)text[index] : 0; };
+    auto tail = [&byte](uint32_t index) { return ((byte(index) & 0xC0) == 0x80); };
+
+    size = 1;
+    if ((byte(0) & 0xF8) == 0xF0)
+    {
+        if (tail(1) && tail(2) && tail(3))
+        {
+            size = 4;
+            return ((byte(0) & 0x07) << 18) | ((byte(1) & 0x3F) << 12) | ((byte(2) & 0x3F) << 6) | (byte(3) & 0x3F);
+        }
+    }
+    else if ((byte(0) & 0xF0) == 0xE0)
+    {
+        if (tail(1) && tail(2))
+        {
+            size = 3;
+            return ((byte(0) & 0x0F) << 12) | ((byte(1) & 0x3F) << 6) | (byte(2) & 0x3F);
+        }
+    }
+    else if ((byte(0) & 0xE0) == 0xC0)
+    {
+        if (tail(1))
+        {
+            size = 2;
+            return ((byte(0) & 0x1F) << 6) | (byte(1) & 0x3F);
+        }
+    }
+    else if ((byte(0) & 0x80) == 0)
+    {
+        return byte(0);
+    }
+    return '?';
+}
@@ -0,0 +1,144 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include "Profiler.h"
+
+TextureAtlas::TextureAtlas(std::shared_ptr<RaylibInterface> raylibPtr, int pageSize, int padding)
+{
+    assert(raylibPtr != nullptr);
+    assert(pageSize > 0);
+    assert(padding >= 0);
+    m_raylibPtr = raylibPtr;
+    m_pageSize  = pageSize;
+    m_padding   = padding;
+}
+
+// the images of name are its frames, in the order of fileNames
+void TextureAtlas::add(const std::string& name, const std::vector<std::string>& fileNames)
+{
+    for (uint32_t index = 0; index < fileNames.size(); index++)
+    {
+        m_entries.push_back(Entry_t(name, index, fileNames[index], Image(), 0, Rectangle(0, 0, 0, 0)));
+    }
+}
+
+// images already decoded elsewhere, the atlas unloads them once packed
+void TextureAtlas::add(const std::string& name, const std::vector<Image>& images)
+{
+    for (uint32_t index = 0; index < images.size(); index++)
+    {
+        m_entries.push_back(Entry_t(name, index, "", images[index], 0, Rectangle(0, 0, 0, 0)));
+    }
+}
+
+// Load the images added by file name, pack all the images added so far into
+// pages, upload the pages and release the images.
+void TextureAtlas::build(void)
+{
+    PROFILE_ZONE("TextureAtlas::build");
+    for (Entry_t& entry : m_entries)
+    {
+        if (!entry.m_fileName.empty())
+        {
+            entry.m_image = m_raylibPtr->loadImage(entry.m_fileName);
+        }
+    }
+
+    pack();
+
+    uint32_t firstPage = m_textures.size();
+    for (uint32_t page = 0; page < m_pages.size(); page++)
+    {
+        Image pageImage = m_raylibPtr->genImageColor(m_pages[page].m_width, m_pages[page].m_height, BLANK);
+        for (Entry_t& entry : m_entries)
+        {
+            if (entry.m_page == page)
+            {
+                m_raylibPtr->imageDraw(&pageImage, entry.m_image, Rectangle(0, 0, entry.m_place.width, entry.m_place.height), entry.m_place, WHITE);
+            }
+        }
+        m_textures.push_back(m_raylibPtr->loadTextureFromImage(pageImage));
+        m_raylibPtr->unloadImage(pageImage);
+    }
+
+    for (Entry_t& entry : m_entries)
+    {
+        m_raylibPtr->unloadImage(entry.m_image);
+
+        std::vector<Frame_t>& frames = m_frames[entry.m_name];
+        if (frames.size() <= entry.m_frame)
+        {
+            frames.resize(entry.m_frame + 1);
+        }
+        frames[entry.m_frame] = Frame_t(m_textures[firstPage + entry.m_page], entry.m_place);
+    }
+
+    m_entries.clear();
+    m_pages.clear();
+}
+
+void TextureAtlas::unload(void)
+{
+    for (Texture2D texture : m_textures)
+    {
+        m_raylibPtr->unloadTexture(texture);
+    }
+    m_textures.clear();
+    m_frames.clear();
+}
+
+TextureAtlas::Frames_t TextureAtlas::getFrames(const std::string& name) const
+{
+    auto frames = m_frames.find(name);
+    assert(frames != m_frames.end());
+    return frames->second;
+}
+
+uint32_t TextureAtlas::getPageCount(void) const
+{
+    return m_textures.size();
+}
+
+// Shelf packing: the images, tallest first, fill rows from left to right and a
+// new row starts under the tallest image of the previous one. An image larger
+// than a page gets a page of its own.
+void TextureAtlas::pack(void)
+{
+    std::vector<uint32_t> order(m_entries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t first, uint32_t second) { return (m_entries[first].m_image.height > m_entries[second].m_image.height); });
+
+    m_pages.clear();
+    for (uint32_t index : order)
+    {
+        Entry_t& entry  = m_entries[index];
+        int      width  = entry.m_image.width + m_padding;
+        int      height = entry.m_image.height + m_padding;
+
+        if (m_pages.empty())
+        {
+            m_pages.push_back(Page_t());
+        }
+
+        Page_t* page = &m_pages.back();
+        if ((page->m_shelfX + width) > m_pageSize)
+        {
+            page->m_shelfY      += page->m_shelfHeight;
+            page->m_shelfX       = 0;
+            page->m_shelfHeight  = 0;
+        }
+        if (((page->m_shelfY + height) > m_pageSize) && ((page->m_shelfX > 0) || (page->m_shelfY > 0)))
+        {
+            m_pages.push_back(Page_t());
+            page = &m_pages.back();
+        }
+
+        entry.m_page        = m_pages.size() - 1;
+        entry.m_place       = Rectangle(page->m_shelfX, page->m_shelfY, entry.m_image.width, entry.m_image.height);
+        page->m_shelfX     += width;
+        page->m_shelfHeight = std::max(page->m_shelfHeight, height);
+        page->m_width       = std::max(page->m_width, page->m_shelfX);
+        page->m_height      = std::max(page->m_height, page->m_shelfY + page->m_shelfHeight);
+    }
+}
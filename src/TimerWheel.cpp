@@ -0,0 +1,227 @@
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+TimerWheel::TimerWheel(void)
+{
+}
+
+TimerWheel::Handle_t TimerWheel::add(double duration, bool repeat, bool autostart, std::function<void(void)> callBack)
+{
+    assert(duration >= 0);
+    assert(callBack);
+
+    Timer_t timer;
+    timer.m_callBack = std::move(callBack);
+    timer.m_duration = std::max((uint64_t)1, (uint64_t)std::llround(duration * 1000));
+    timer.m_repeat   = repeat;
+
+    Handle_t handle = m_timers.insert(std::move(timer));
+    if (autostart)
+    {
+        activate(handle);
+    }
+    return handle;
+}
+
+void TimerWheel::remove(Handle_t handle)
+{
+    deactivate(handle);
+    m_timers.erase(handle);
+}
+
+bool TimerWheel::contains(Handle_t handle) const
+{
+    return m_timers.contains(handle);
+}
+
+// (re)start the timer from the current time
+void TimerWheel::activate(Handle_t handle)
+{
+    Timer_t& timer = m_timers.get(handle);
+    if (timer.m_level != UNLINKED)
+    {
+        unlink(handle);
+    }
+    timer.m_active   = true;
+    timer.m_sequence = ++m_sequence;
+    schedule(handle, m_now + timer.m_duration);
+}
+
+void TimerWheel::deactivate(Handle_t handle)
+{
+    Timer_t& timer = m_timers.get(handle);
+    if (timer.m_level != UNLINKED)
+    {
+        unlink(handle);
+    }
+    timer.m_active = false;
+}
+
+bool TimerWheel::isActive(Handle_t handle)
+{
+    return (m_timers.contains(handle) && m_timers.get(handle).m_active);
+}
+
+void TimerWheel::advance(double seconds)
+{
+    assert(seconds >= 0);
+    m_time += seconds;
+
+    // the epsilon keeps sums of frame times such as 60 * (1 / 60) on the tick
+    uint64_t target = (uint64_t)std::floor((m_time * 1000) + 1e-6);
+    while (m_now < target)
+    {
+        if (m_linked == 0)
+        {
+            m_now = target;
+            break;
+        }
+        tick();
+    }
+}
+
+double TimerWheel::getTime(void) const
+{
+    return m_time;
+}
+
+uint32_t TimerWheel::size(void) const
+{
+    return m_timers.size();
+}
+
+// Put the timer in the lowest level whose span covers its expiry. A timer beyond
+// the span of the wheel waits in the last slot of the top level to be cascaded,
+// and scheduled again from there.
+void TimerWheel::schedule(Handle_t handle, uint64_t expiry)
+{
+    Timer_t& timer = m_timers.get(handle);
+    uint64_t delta = expiry - m_now;
+
+    timer.m_expiry = expiry;
+    timer.m_level  = LEVELS - 1;
+    timer.m_slot   = ((m_now >> (SLOT_BITS * (LEVELS - 1))) + SLOTS - 1) & (SLOTS - 1);
+    for (uint32_t level = 0; level < LEVELS; level++)
+    {
+        if ((delta >> (SLOT_BITS * (level + 1))) == 0)
+        {
+            timer.m_level = level;
+            timer.m_slot  = (expiry >> (SLOT_BITS * level)) & (SLOTS - 1);
+            break;
+        }
+    }
+    link(handle);
+}
+
+void TimerWheel::link(Handle_t handle)
+{
+    Timer_t& timer = m_timers.get(handle);
+    List_t&  list  = m_wheel[timer.m_level][timer.m_slot];
+
+    timer.m_previous = list.m_tail;
+    timer.m_next     = Handle_t();
+    if (list.m_tail.m_index != UINT32_MAX)
+    {
+        m_timers.get(list.m_tail).m_next = handle;
+    }
+    else
+    {
+        list.m_head = handle;
+    }
+    list.m_tail = handle;
+    m_linked++;
+}
+
+void TimerWheel::unlink(Handle_t handle)
+{
+    Timer_t& timer = m_timers.get(handle);
+    List_t&  list  = m_wheel[timer.m_level][timer.m_slot];
+
+    if (timer.m_previous.m_index != UINT32_MAX)
+    {
+        m_timers.get(timer.m_previous).m_next = timer.m_next;
+    }
+    else
+    {
+        list.m_head = timer.m_next;
+    }
+
+    if (timer.m_next.m_index != UINT32_MAX)
+    {
+        m_timers.get(timer.m_next).m_previous = timer.m_previous;
+    }
+    else
+    {
+        list.m_tail = timer.m_previous;
+    }
+
+    timer.m_level = UNLINKED;
+    m_linked--;
+}
+
+// move the timers of the current slot of level down to the levels below
+void TimerWheel::cascade(uint32_t level)
+{
+    List_t&  list   = m_wheel[level][(m_now >> (SLOT_BITS * level)) & (SLOTS - 1)];
+    Handle_t handle = list.m_head;
+
+    while (handle.m_index != UINT32_MAX)
+    {
+        Handle_t next = m_timers.get(handle).m_next;
+        unlink(handle);
+        schedule(handle, m_timers.get(handle).m_expiry);
+        handle = next;
+    }
+}
+
+void TimerWheel::tick(void)
+{
+    m_now++;
+    for (uint32_t level = 1; level < LEVELS; level++)
+    {
+        if ((m_now & ((1ULL << (SLOT_BITS * level)) - 1)) != 0)
+        {
+            break;
+        }
+        cascade(level);
+    }
+
+    List_t& list = m_wheel[0][m_now & (SLOTS - 1)];
+    m_expired.clear();
+    while (list.m_head.m_index != UINT32_MAX)
+    {
+        m_expired.push_back(list.m_head);
+        unlink(list.m_head);
+    }
+    std::sort(m_expired.begin(), m_expired.end(), [this](Handle_t first, Handle_t second) { return (m_timers.get(first).m_sequence < m_timers.get(second).m_sequence); });
+
+    for (Handle_t handle : m_expired)
+    {
+        // an earlier callback may have removed, deactivated or restarted the timer
+        if (!m_timers.contains(handle) || !m_timers.get(handle).m_active || (m_timers.get(handle).m_level != UNLINKED))
+        {
+            continue;
+        }
+
+        Timer_t& timer = m_timers.get(handle);
+        if (timer.m_repeat)
+        {
+            timer.m_sequence = ++m_sequence;
+            schedule(handle, timer.m_expiry + timer.m_duration);
+        }
+        else
+        {
+            timer.m_active = false;
+        }
+
+        // the callback may add timers and move the storage, so it runs from here
+        std::function<void(void)> callBack = std::move(timer.m_callBack);
+        callBack();
+        if (m_timers.contains(handle))
+        {
+            m_timers.get(handle).m_callBack = std::move(callBack);
+        }
+    }
+}
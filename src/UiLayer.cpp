@@ -0,0 +1,116 @@
+#include "UiLayer.h"
+#include <cassert>
+#include <cmath>
+#include "Profiler.h"
+
+namespace
+{
+bool overlap(Rectangle first, Rectangle second)
+{
+    return ((first.x < (second.x + second.width)) &&
+            (second.x < (first.x + first.width)) &&
+            (first.y < (second.y + second.height)) &&
+            (second.y < (first.y + first.height)));
+}
+} // namespace
+
+UiLayer::UiLayer(std::shared_ptr<RaylibInterface> raylibPtr, int width, int height)
+{
+    assert(raylibPtr != nullptr);
+    m_raylibPtr = raylibPtr;
+    m_target    = m_raylibPtr->loadRenderTexture(width, height);
+}
+
+UiLayer::~UiLayer(void)
+{
+    m_raylibPtr->unloadRenderTexture(m_target);
+}
+
+// draw is called between beginTextureMode() and endTextureMode(), the widget
+// draws in page coordinates
+uint32_t UiLayer::add(Rectangle area, std::function<void(void)> draw)
+{
+    assert(draw != nullptr);
+    m_widgets.push_back(Widget_t(area, draw, true));
+    return (m_widgets.size() - 1);
+}
+
+void UiLayer::invalidate(uint32_t widget)
+{
+    assert(widget < m_widgets.size());
+    m_widgets[widget].m_dirty = true;
+}
+
+// Called between beginDrawing() and the draws of the frame, the texture is
+// cleared with the background of the frame otherwise.
+void UiLayer::update(void)
+{
+    PROFILE_ZONE("UiLayer::update");
+    if (!m_drawn)
+    {
+        m_raylibPtr->beginTextureMode(m_target);
+        m_raylibPtr->clearBackground(BLANK);
+        for (Widget_t& widget : m_widgets)
+        {
+            widget.m_draw();
+            widget.m_dirty = false;
+            m_redraws++;
+        }
+        m_raylibPtr->endTextureMode();
+        m_drawn = true;
+        return;
+    }
+
+    bool textureMode = false;
+    for (Widget_t& widget : m_widgets)
+    {
+        if (!widget.m_dirty)
+        {
+            continue;
+        }
+        if (!textureMode)
+        {
+            m_raylibPtr->beginTextureMode(m_target);
+            textureMode = true;
+        }
+        widget.m_dirty = false;
+        redraw(widget.m_area);
+    }
+    if (textureMode)
+    {
+        m_raylibPtr->endTextureMode();
+    }
+}
+
+// premultiplied, see RaylibWrapper::drawRenderTexture()
+void UiLayer::draw(void)
+{
+    m_raylibPtr->drawRenderTexture(m_target, Vector2(0, 0), WHITE);
+}
+
+uint64_t UiLayer::getRedrawCount(void) const
+{
+    return m_redraws;
+}
+
+// The scissor is area rounded out to whole pixels, the widgets overlapping it
+// are drawn whole and clipped, and stay dirty if they were.
+void UiLayer::redraw(Rectangle area)
+{
+    float left   = std::floor(area.x);
+    float top    = std::floor(area.y);
+    float right  = std::ceil(area.x + area.width);
+    float bottom = std::ceil(area.y + area.height);
+
+    m_raylibPtr->beginScissorMode((int)left, (int)top, (int)(right - left), (int)(bottom - top));
+    m_raylibPtr->clearBackground(BLANK);
+    for (Widget_t& widget : m_widgets)
+    {
+        if (overlap(widget.m_area, Rectangle(left, top, (right - left), (bottom - top))))
+        {
+            widget.m_draw();
+            m_redraws++;
+        }
+    }
+    m_raylibPtr->endScissorMode();
+}
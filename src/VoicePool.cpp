@@ -0,0 +1,122 @@
+#include "VoicePool.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "Logger.h"
+#include "Profiler.h"
+
+VoicePool::VoicePool(std::shared_ptr<RaylibInterface> raylibPtr)
+{
+    assert(raylibPtr != nullptr);
+    m_raylibPtr = raylibPtr;
+    m_voices.reserve(MAX_VOICES);
+}
+
+VoicePool::~VoicePool(void)
+{
+    clear();
+}
+
+// Gives sound polyphony voices of the pool, the sound itself stays with the
+// caller. Returns the id play() takes.
+uint32_t VoicePool::add(Sound sound, uint32_t polyphony)
+{
+    assert(polyphony > 0);
+    if ((m_voices.size() + polyphony) > MAX_VOICES)
+    {
+        Logger::getInstance().log(Logger::ERROR, "voice pool full, " + std::to_string(polyphony) + " voices not added");
+        assert(false);
+        polyphony = MAX_VOICES - m_voices.size();
+    }
+
+    Entry_t entry;
+    entry.m_length     = (sound.stream.sampleRate > 0) ? ((double)sound.frameCount / sound.stream.sampleRate) : 0;
+    entry.m_firstVoice = m_voices.size();
+    entry.m_voiceCount = polyphony;
+    entry.m_triggers   = 0;
+    for (uint32_t voice = 0; voice < polyphony; voice++)
+    {
+        m_voices.push_back(Voice_t(m_raylibPtr->loadSoundAlias(sound), 0, 0));
+    }
+    m_sounds.push_back(entry);
+    return (m_sounds.size() - 1);
+}
+
+// counted until update()
+void VoicePool::play(uint32_t sound)
+{
+    assert(sound < m_sounds.size());
+    Entry_t& entry = m_sounds[sound];
+    if (entry.m_triggers == 0)
+    {
+        m_triggered.push_back(sound);
+    }
+    entry.m_triggers++;
+    m_stats.m_triggers++;
+}
+
+// Once per frame. The amplitudes of n copies of a sound started together add
+// up to about sqrt(n) times the amplitude of one, which is the volume of the
+// voice they are coalesced into.
+void VoicePool::update(void)
+{
+    PROFILE_ZONE("VoicePool::update");
+    if (m_triggered.empty())
+    {
+        return;
+    }
+
+    double now = m_raylibPtr->getTime();
+    for (uint32_t sound : m_triggered)
+    {
+        Entry_t& entry = m_sounds[sound];
+        Voice_t& voice = m_voices[voiceFor(entry, now)];
+        if (voice.m_end > now)
+        {
+            m_stats.m_stolen++;
+        }
+        voice.m_start = now;
+        voice.m_end   = now + entry.m_length;
+
+        m_raylibPtr->setSoundVolume(voice.m_alias, std::min(MAX_VOLUME, (float)std::sqrt(entry.m_triggers)));
+        m_raylibPtr->playSound(voice.m_alias);
+        m_stats.m_voices++;
+        entry.m_triggers = 0;
+    }
+    m_triggered.clear();
+}
+
+// unloads the aliases, the ids play() took are no longer valid
+void VoicePool::clear(void)
+{
+    for (const Voice_t& voice : m_voices)
+    {
+        m_raylibPtr->unloadSoundAlias(voice.m_alias);
+    }
+    m_voices.clear();
+    m_sounds.clear();
+    m_triggered.clear();
+}
+
+VoicePool::Stats_t VoicePool::getStats(void) const
+{
+    return m_stats;
+}
+
+// a voice of entry done playing, or else the one that started first
+uint32_t VoicePool::voiceFor(const Entry_t& entry, double now)
+{
+    uint32_t oldest = entry.m_firstVoice;
+    for (uint32_t index = entry.m_firstVoice; index < (entry.m_firstVoice + entry.m_voiceCount); index++)
+    {
+        if (m_voices[index].m_end <= now)
+        {
+            return index;
+        }
+        if (m_voices[index].m_start < m_voices[oldest].m_start)
+        {
+            oldest = index;
+        }
+    }
+    return oldest;
+}
@@ -14,7 +14,7 @@ public:
     MOCK_METHOD(void, draw, (), (override));
     MOCK_METHOD(Vector2, getCenter, (), (override));
     MOCK_METHOD(float, getRadius, (), (override));
-    MOCK_METHOD(void, setTextures, (std::vector<Texture2D> textures), (override));
+    MOCK_METHOD(void, setTextures, (TextureAtlas::Frames_t textures), (override));
     MOCK_METHOD(void, setInvincible, (), (override));
     MOCK_METHOD(void, setDispersedlaser, (), (override));
 };
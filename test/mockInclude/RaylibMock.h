@@ -45,6 +45,28 @@ public:
     MOCK_METHOD(bool, checkCollisionPointRec, (Vector2 point, Rectangle rec), (override));
     MOCK_METHOD(bool, isMouseButtonPressed, (int button), (override));
     MOCK_METHOD(Vector2, measureTextEx, (Font font, std::string text, float fontSize, float spacing), (override));
+    MOCK_METHOD(Image, loadImage, (std::string fileName), (override));
+    MOCK_METHOD(void, unloadImage, (Image image), (override));
+    MOCK_METHOD(Image, genImageColor, (int width, int height, Color color), (override));
+    MOCK_METHOD(void, imageDraw, (Image * dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint), (override));
+    MOCK_METHOD(Texture2D, loadTextureFromImage, (Image image), (override));
+    MOCK_METHOD(Wave, loadWave, (std::string fileName), (override));
+    MOCK_METHOD(void, unloadWave, (Wave wave), (override));
+    MOCK_METHOD(Sound, loadSoundFromWave, (Wave wave), (override));
+    MOCK_METHOD(Image, loadImageFromMemory, (std::string fileType, const unsigned char* fileData, int dataSize), (override));
+    MOCK_METHOD(Wave, loadWaveFromMemory, (std::string fileType, const unsigned char* fileData, int dataSize), (override));
+    MOCK_METHOD(Font, loadFontFromMemory, (std::string fileType, const unsigned char* fileData, int dataSize, int fontSize, int* codepoints, int codepointCount), (override));
+    MOCK_METHOD(Music, loadMusicStreamFromMemory, (std::string fileType, const unsigned char* data, int dataSize), (override));
+    MOCK_METHOD(RenderTexture2D, loadRenderTexture, (int width, int height), (override));
+    MOCK_METHOD(void, unloadRenderTexture, (RenderTexture2D target), (override));
+    MOCK_METHOD(void, beginTextureMode, (RenderTexture2D target), (override));
+    MOCK_METHOD(void, endTextureMode, (), (override));
+    MOCK_METHOD(void, beginScissorMode, (int x, int y, int width, int height), (override));
+    MOCK_METHOD(void, endScissorMode, (), (override));
+    MOCK_METHOD(void, drawRenderTexture, (RenderTexture2D target, Vector2 position, Color tint), (override));
+    MOCK_METHOD(Sound, loadSoundAlias, (Sound source), (override));
+    MOCK_METHOD(void, unloadSoundAlias, (Sound alias), (override));
+    MOCK_METHOD(void, setSoundVolume, (Sound sound, float volume), (override));
 };
 
 #endif // RAYLIBMOCK_H
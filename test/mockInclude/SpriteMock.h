@@ -15,7 +15,10 @@ public:
     MOCK_METHOD(Vector2, getCenter, (), (override));
     MOCK_METHOD(float, getRadius, (), (override));
     MOCK_METHOD(Rectangle, getRect, (), (override));
-    MOCK_METHOD(void, setTextures, (std::vector<Texture2D> textures), (override));
+    MOCK_METHOD(void, setTextures, (TextureAtlas::Frames_t textures), (override));
+    MOCK_METHOD(Sprite::Body_t, getBody, (), (override));
+    MOCK_METHOD(void, act, (Vector2 position), (override));
+    MOCK_METHOD(void, reset, (Sprite::SpriteAttr_t attr), (override));
 };
 
 #endif // SPRITEMOCK_H
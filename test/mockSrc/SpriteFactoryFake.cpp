@@ -2,6 +2,7 @@
 #include "SpriteMock.h"
 
 SpriteFactoryFake::SpriteFactoryFake(void)
+    : SpriteFactory(std::make_shared<Random>(0))
 {
 }
 
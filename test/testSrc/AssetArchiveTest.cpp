@@ -0,0 +1,158 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "AssetArchive.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Random.h"
+
+namespace AssetArchiveTest
+{
+class AssetArchiveTest : public ::testing::Test
+{
+public:
+    std::string m_archiveFile;
+
+    void SetUp(void)
+    {
+        m_archiveFile = (std::filesystem::temp_directory_path() / "asteroidsTest.pak").string();
+        ASSERT_TRUE(AssetArchive::pack("resources", m_archiveFile));
+    }
+
+    void TearDown(void)
+    {
+        std::filesystem::remove(m_archiveFile);
+    }
+
+    static std::vector<uint8_t> readFile(const std::filesystem::path& fileName)
+    {
+        std::ifstream        file(fileName, std::ios::binary);
+        std::vector<uint8_t> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return contents;
+    }
+
+    static void expectRoundTrip(const std::vector<uint8_t>& original)
+    {
+        std::vector<uint8_t> compressed = AssetArchive::compress(original.data(), original.size());
+        std::vector<uint8_t> restored(original.size());
+        EXPECT_TRUE(AssetArchive::decompress(compressed.data(), compressed.size(), restored.data(), restored.size()));
+        EXPECT_EQ(restored, original);
+    }
+};
+
+TEST_F(AssetArchiveTest, compressionRoundTrip)
+{
+    Random               random(1);
+    std::vector<uint8_t> noise(10000);
+    for (uint8_t& byte : noise)
+    {
+        byte = random.uniformInt(0, 255);
+    }
+    std::vector<uint8_t> pattern;
+    for (uint32_t index = 0; index < 10000; index++)
+    {
+        pattern.push_back("asteroids"[index % 9]);
+    }
+
+    expectRoundTrip({});
+    expectRoundTrip({1, 2, 3});
+    expectRoundTrip(noise);
+    expectRoundTrip(pattern);
+    // long literal runs and long overlapping matches, both beyond one length byte
+    expectRoundTrip(std::vector<uint8_t>(5000, 7));
+    noise.insert(noise.end(), 3000, 0);
+    expectRoundTrip(noise);
+
+    EXPECT_LT(AssetArchive::compress(pattern.data(), pattern.size()).size(), pattern.size() / 50);
+}
+
+TEST_F(AssetArchiveTest, decompressRejectsCorruptInput)
+{
+    std::vector<uint8_t> pattern(1000, 'a');
+    std::vector<uint8_t> compressed = AssetArchive::compress(pattern.data(), pattern.size());
+    std::vector<uint8_t> restored(pattern.size());
+
+    EXPECT_FALSE(AssetArchive::decompress(compressed.data(), compressed.size() / 2, restored.data(), restored.size()));
+    EXPECT_FALSE(AssetArchive::decompress(compressed.data(), compressed.size(), restored.data(), restored.size() - 1));
+
+    // a match reaching before the start of the output
+    std::vector<uint8_t> badOffset = {0x10, 'a', 0x05, 0x00};
+    EXPECT_FALSE(AssetArchive::decompress(badOffset.data(), badOffset.size(), restored.data(), restored.size()));
+}
+
+TEST_F(AssetArchiveTest, everyFileOfTheTree)
+{
+    AssetArchive archive(m_archiveFile);
+    ASSERT_TRUE(archive.isOpen());
+    EXPECT_TRUE(archive.verify());
+
+    uint32_t             files = 0;
+    std::vector<uint8_t> buffer;
+    for (const std::filesystem::directory_entry& file : std::filesystem::recursive_directory_iterator("resources"))
+    {
+        if (!file.is_regular_file())
+        {
+            continue;
+        }
+        files++;
+
+        uint32_t       size = 0;
+        const uint8_t* data = archive.read(file.path().string(), buffer, size);
+        ASSERT_TRUE(data != nullptr) << file.path();
+        std::vector<uint8_t> original = readFile(file.path());
+        EXPECT_EQ(std::vector<uint8_t>(data, data + size), original) << file.path();
+
+        // stored contents are read in place, from an aligned offset of the mapping
+        if (data != buffer.data())
+        {
+            EXPECT_EQ((uintptr_t)data % AssetArchive::ALIGNMENT, 0);
+        }
+    }
+    EXPECT_EQ(archive.size(), files);
+    EXPECT_TRUE(archive.contains("resources/images/meteor.png"));
+    EXPECT_FALSE(archive.contains("resources/images/missing.png"));
+}
+
+TEST_F(AssetArchiveTest, badArchives)
+{
+    EXPECT_FALSE(AssetArchive(m_archiveFile + ".missing").isOpen());
+
+    std::string garbageFile = m_archiveFile + ".garbage";
+    std::ofstream(garbageFile) << "not an archive";
+    EXPECT_FALSE(AssetArchive(garbageFile).isOpen());
+    std::filesystem::remove(garbageFile);
+
+    // flip the last byte, which belongs to the last content
+    std::vector<uint8_t> contents = readFile(m_archiveFile);
+    contents.back() ^= 0xFF;
+    std::ofstream(m_archiveFile, std::ios::binary | std::ios::trunc).write((const char*)contents.data(), contents.size());
+
+    AssetArchive archive(m_archiveFile);
+    ASSERT_TRUE(archive.isOpen());
+    EXPECT_FALSE(archive.verify());
+}
+
+TEST_F(AssetArchiveTest, oversizedEntryIsRejected)
+{
+    // the entries follow the 16 byte header, 40 bytes each, the size at 16 and
+    // the compression at 38 into an entry
+    std::vector<uint8_t> contents = readFile(m_archiveFile);
+    uint32_t             entryCount;
+    std::memcpy(&entryCount, contents.data() + 8, sizeof(entryCount));
+    size_t entry = 16;
+    while ((entry < (16 + (entryCount * 40))) && (contents[entry + 38] != AssetArchive::LZ))
+    {
+        entry += 40;
+    }
+    ASSERT_LT(entry, (16 + (entryCount * 40)));
+
+    // a compressed entry larger than pack() ever writes would be decompressed into a buffer of that size
+    uint64_t size = (uint64_t)UINT32_MAX + 1;
+    std::memcpy(contents.data() + entry + 16, &size, sizeof(size));
+    std::ofstream(m_archiveFile, std::ios::binary | std::ios::trunc).write((const char*)contents.data(), contents.size());
+    EXPECT_FALSE(AssetArchive(m_archiveFile).isOpen());
+}
+
+} // namespace AssetArchiveTest
@@ -0,0 +1,119 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "AssetLoader.h"
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RaylibHeadless.h"
+#include "RaylibMock.h"
+
+using ::testing::_;
+using ::testing::Exactly;
+using ::testing::Return;
+
+namespace AssetLoaderTest
+{
+class AssetLoaderTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<RaylibMock> m_raylibMock = nullptr;
+
+    void SetUp(void)
+    {
+        m_raylibMock = std::make_shared<RaylibMock>();
+        ASSERT_TRUE(m_raylibMock != nullptr);
+    }
+};
+
+TEST_F(AssetLoaderTest, decodesOnWorkers)
+{
+    // the headless backend decodes the sizes from the files, from any thread
+    std::shared_ptr<RaylibHeadless>    raylibHeadless = std::make_shared<RaylibHeadless>(1.0f / 60);
+    AssetLoader                        loader(raylibHeadless, 4);
+    std::vector<AssetLoader::Handle_t> images;
+
+    for (uint32_t index = 1; index <= 28; index++)
+    {
+        images.push_back(loader.add(AssetLoader::IMAGE, "resources/images/explosion/" + std::to_string(index) + ".png"));
+    }
+    AssetLoader::Handle_t meteor = loader.add(AssetLoader::IMAGE, "resources/images/meteor.png");
+    AssetLoader::Handle_t wave   = loader.add(AssetLoader::WAVE, "resources/audio/explosion.wav");
+
+    loader.wait();
+    EXPECT_TRUE(loader.isDone());
+    EXPECT_EQ(loader.getProgress(), 1);
+
+    for (AssetLoader::Handle_t handle : images)
+    {
+        Image image = loader.takeImage(handle);
+        EXPECT_EQ(image.width, 48);
+        EXPECT_EQ(image.height, 46);
+    }
+    EXPECT_EQ(loader.takeImage(meteor).width, 101);
+    EXPECT_GT(loader.takeWave(wave).sampleRate, 0);
+}
+
+TEST_F(AssetLoaderTest, withoutWorkersDecodesWhenAdded)
+{
+    AssetLoader loader(m_raylibMock, 0);
+    EXPECT_TRUE(loader.isDone());
+    EXPECT_EQ(loader.getProgress(), 1);
+
+    EXPECT_CALL((*m_raylibMock), loadImage("image.png")).WillOnce(Return(Image(nullptr, 4, 3, 1, 0)));
+    AssetLoader::Handle_t handle = loader.add(AssetLoader::IMAGE, "image.png");
+    EXPECT_TRUE(loader.isDone());
+
+    Image image = loader.takeImage(handle);
+    EXPECT_EQ(image.width, 4);
+    EXPECT_EQ(image.height, 3);
+}
+
+TEST_F(AssetLoaderTest, untakenBuffersAreReleased)
+{
+    EXPECT_CALL((*m_raylibMock), loadImage(_)).Times(Exactly(2));
+    EXPECT_CALL((*m_raylibMock), loadWave(_)).Times(Exactly(1));
+    {
+        AssetLoader loader(m_raylibMock, 0);
+        AssetLoader::Handle_t taken = loader.add(AssetLoader::IMAGE, "taken.png");
+        loader.add(AssetLoader::IMAGE, "untaken.png");
+        loader.add(AssetLoader::WAVE, "untaken.wav");
+        loader.takeImage(taken);
+
+        EXPECT_CALL((*m_raylibMock), unloadImage(_)).Times(Exactly(1));
+        EXPECT_CALL((*m_raylibMock), unloadWave(_)).Times(Exactly(1));
+    }
+}
+
+TEST_F(AssetLoaderTest, decodesFromTheArchive)
+{
+    std::string archiveFile = (std::filesystem::temp_directory_path() / "asteroidsLoaderTest.pak").string();
+    ASSERT_TRUE(AssetArchive::pack("resources", archiveFile));
+    {
+        std::shared_ptr<AssetArchive> archive = std::make_shared<AssetArchive>(archiveFile);
+        ASSERT_TRUE(archive->isOpen());
+
+        AssetLoader loader(m_raylibMock, 0);
+        loader.setArchive(archive);
+
+        // the bytes come from the mapping, files missing from the archive from disk
+        EXPECT_CALL((*m_raylibMock), loadImageFromMemory(".png", _, std::filesystem::file_size("resources/images/meteor.png")));
+        EXPECT_CALL((*m_raylibMock), loadWaveFromMemory(".wav", _, std::filesystem::file_size("resources/audio/laser.wav")));
+        EXPECT_CALL((*m_raylibMock), loadImage("resources/images/missing.png"));
+        loader.takeImage(loader.add(AssetLoader::IMAGE, "resources/images/meteor.png"));
+        loader.takeWave(loader.add(AssetLoader::WAVE, "resources/audio/laser.wav"));
+        loader.takeImage(loader.add(AssetLoader::IMAGE, "resources/images/missing.png"));
+    }
+    std::filesystem::remove(archiveFile);
+}
+
+TEST_F(AssetLoaderTest, takeTwice_death)
+{
+    EXPECT_CALL((*m_raylibMock), loadImage(_));
+    AssetLoader           loader(m_raylibMock, 0);
+    AssetLoader::Handle_t handle = loader.add(AssetLoader::IMAGE, "image.png");
+    loader.takeImage(handle);
+    EXPECT_DEATH(loader.takeImage(handle), "Assertion failed");
+}
+
+} // namespace AssetLoaderTest
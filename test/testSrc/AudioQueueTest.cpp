@@ -0,0 +1,128 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "AudioQueue.h"
+#include <chrono>
+#include <memory>
+#include <thread>
+#include "RaylibMock.h"
+
+using ::testing::_;
+using ::testing::AtLeast;
+using ::testing::Field;
+using ::testing::FloatEq;
+using ::testing::InSequence;
+using ::testing::Mock;
+using ::testing::Return;
+
+namespace AudioQueueTest
+{
+class AudioQueueTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<RaylibMock> m_raylibMock = nullptr;
+    std::shared_ptr<RaylibMock> m_audioMock  = nullptr;
+    std::shared_ptr<AudioQueue> m_audioQueue = nullptr;
+
+    void SetUp(void)
+    {
+        m_raylibMock = std::make_shared<RaylibMock>();
+        ASSERT_TRUE(m_raylibMock != nullptr);
+
+        m_audioMock = std::make_shared<RaylibMock>();
+        ASSERT_TRUE(m_audioMock != nullptr);
+
+        m_audioQueue = std::make_shared<AudioQueue>(m_raylibMock, m_audioMock);
+        ASSERT_TRUE(m_audioQueue != nullptr);
+    }
+
+    void TearDown(void)
+    {
+        m_audioQueue = nullptr;
+        Mock::VerifyAndClearExpectations(m_raylibMock.get());
+        Mock::VerifyAndClearExpectations(m_audioMock.get());
+    }
+
+    // the sounds are told apart by their frame count
+    static Sound sound(uint32_t tag)
+    {
+        return Sound({nullptr, nullptr, 44100, 16, 1}, tag);
+    }
+};
+
+TEST_F(AudioQueueTest, callingThreadMakesTheCalls)
+{
+    EXPECT_CALL((*m_raylibMock), getTime()).WillOnce(Return(1.5));
+    EXPECT_CALL((*m_raylibMock), loadSound("laser.wav")).WillOnce(Return(sound(1)));
+    EXPECT_CALL((*m_raylibMock), playSound(_)).Times(0);
+    EXPECT_CALL((*m_audioMock), initAudioDevice()).Times(1);
+    EXPECT_CALL((*m_audioMock), playSound(Field(&Sound::frameCount, 1))).Times(1);
+    EXPECT_CALL((*m_audioMock), updateMusicStream(_)).Times(1);
+
+    EXPECT_EQ(m_audioQueue->getTime(), 1.5);
+    m_audioQueue->initAudioDevice();
+    m_audioQueue->playSound(m_audioQueue->loadSound("laser.wav"));
+    m_audioQueue->updateMusicStream(Music());
+}
+
+TEST_F(AudioQueueTest, audioThreadKeepsTheOrder)
+{
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_audioMock), initAudioDevice()).Times(1);
+        EXPECT_CALL((*m_audioMock), playSound(Field(&Sound::frameCount, 1))).Times(1);
+        EXPECT_CALL((*m_audioMock), setSoundVolume(Field(&Sound::frameCount, 2), FloatEq(0.5))).Times(1);
+        EXPECT_CALL((*m_audioMock), playSound(Field(&Sound::frameCount, 2))).Times(1);
+        EXPECT_CALL((*m_audioMock), unloadSoundAlias(Field(&Sound::frameCount, 2))).Times(1);
+        EXPECT_CALL((*m_audioMock), unloadSound(Field(&Sound::frameCount, 1))).Times(1);
+        EXPECT_CALL((*m_audioMock), closeAudioDevice()).Times(1);
+    }
+    m_audioQueue->setThreading(AudioQueue::AUDIO_THREAD);
+    m_audioQueue->initAudioDevice();
+    m_audioQueue->playSound(sound(1));
+    m_audioQueue->setSoundVolume(sound(2), 0.5);
+    m_audioQueue->playSound(sound(2));
+    m_audioQueue->unloadSoundAlias(sound(2));
+    m_audioQueue->unloadSound(sound(1));
+    m_audioQueue->closeAudioDevice();
+
+    // closing waited for everything before
+    Mock::VerifyAndClearExpectations(m_audioMock.get());
+    m_audioQueue->stop();
+}
+
+TEST_F(AudioQueueTest, audioThreadRefillsTheMusic)
+{
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_audioMock), playMusicStream(_)).Times(1);
+        EXPECT_CALL((*m_audioMock), updateMusicStream(_)).Times(AtLeast(2));
+        EXPECT_CALL((*m_audioMock), unloadMusicStream(_)).Times(1);
+    }
+    m_audioQueue->setThreading(AudioQueue::AUDIO_THREAD);
+    m_audioQueue->playMusicStream(Music());
+
+    // the frames no longer refill it
+    for (uint32_t frame = 0; frame < 10; frame++)
+    {
+        m_audioQueue->updateMusicStream(Music());
+        std::this_thread::sleep_for(std::chrono::milliseconds(4 * AudioQueue::REFILL_INTERVAL_MS));
+    }
+    m_audioQueue->unloadMusicStream(Music());
+    std::this_thread::sleep_for(std::chrono::milliseconds(4 * AudioQueue::REFILL_INTERVAL_MS));
+    m_audioQueue->stop();
+}
+
+TEST_F(AudioQueueTest, fullQueueWaitsForTheAudioThread)
+{
+    uint32_t count = 4 * AudioQueue::QUEUE_CAPACITY;
+    EXPECT_CALL((*m_audioMock), playSound(_)).Times(count);
+
+    m_audioQueue->setThreading(AudioQueue::AUDIO_THREAD);
+    for (uint32_t index = 0; index < count; index++)
+    {
+        m_audioQueue->playSound(sound(index));
+    }
+    m_audioQueue->stop();
+}
+
+} // namespace AudioQueueTest
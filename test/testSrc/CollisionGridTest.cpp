@@ -0,0 +1,125 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "CollisionGrid.h"
+#include <memory>
+#include <random>
+#include "SpriteMock.h"
+#include "SpriteStore.h"
+
+using ::testing::ElementsAre;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace CollisionGridTest
+{
+class CollisionGridTest : public ::testing::Test
+{
+public:
+    std::vector<std::shared_ptr<NiceMock<SpriteMock>>> m_spriteMocks;
+
+    void addCircle(SpriteStore& store, Vector2 center, float radius)
+    {
+        std::shared_ptr<NiceMock<SpriteMock>> sprite = std::make_shared<NiceMock<SpriteMock>>();
+        ON_CALL((*sprite), getCenter()).WillByDefault(Return(center));
+        ON_CALL((*sprite), getRadius()).WillByDefault(Return(radius));
+        m_spriteMocks.push_back(sprite);
+        store.add(sprite);
+    }
+
+    void TearDown(void)
+    {
+        m_spriteMocks.clear();
+    }
+};
+
+TEST_F(CollisionGridTest, queryReturnsNeighbourCellsOnly)
+{
+    CollisionGrid         grid(1600, 900, 100);
+    SpriteStore           store(SpriteStore::CIRCLE);
+    std::vector<uint32_t> candidates;
+
+    addCircle(store, Vector2(50, 50), 10);
+    addCircle(store, Vector2(1500, 800), 10);
+    addCircle(store, Vector2(150, 50), 10);
+    store.sync();
+    grid.build(store);
+
+    grid.query(Rectangle(40, 40, 20, 20), candidates);
+    EXPECT_THAT(candidates, ElementsAre(0));
+
+    grid.query(Rectangle(90, 40, 20, 20), candidates);
+    EXPECT_THAT(candidates, ElementsAre(0, 2));
+
+    grid.query(Rectangle(700, 400, 20, 20), candidates);
+    EXPECT_TRUE(candidates.empty());
+}
+
+TEST_F(CollisionGridTest, spriteSpanningCellsIsReportedOnce)
+{
+    CollisionGrid         grid(1600, 900, 100);
+    SpriteStore           store(SpriteStore::CIRCLE);
+    std::vector<uint32_t> candidates;
+
+    addCircle(store, Vector2(100, 100), 60);
+    store.sync();
+    grid.build(store);
+
+    grid.query(Rectangle(0, 0, 300, 300), candidates);
+    EXPECT_THAT(candidates, ElementsAre(0));
+}
+
+TEST_F(CollisionGridTest, outsidePlayfieldClampsToBorderCells)
+{
+    CollisionGrid         grid(1600, 900, 100);
+    SpriteStore           store(SpriteStore::CIRCLE);
+    std::vector<uint32_t> candidates;
+
+    addCircle(store, Vector2(-500, -100), 10);
+    addCircle(store, Vector2(2000, 1000), 10);
+    store.sync();
+    grid.build(store);
+
+    grid.query(Rectangle(-520, -120, 40, 40), candidates);
+    EXPECT_THAT(candidates, ElementsAre(0));
+
+    grid.query(Rectangle(1990, 990, 20, 20), candidates);
+    EXPECT_THAT(candidates, ElementsAre(1));
+}
+
+TEST_F(CollisionGridTest, candidatesCoverEveryOverlap)
+{
+    CollisionGrid                    grid(1600, 900, 100);
+    SpriteStore                      store(SpriteStore::CIRCLE);
+    std::vector<uint32_t>            candidates;
+    std::mt19937                     gen(1234);
+    std::uniform_real_distribution<> distX(-200, 1800);
+    std::uniform_real_distribution<> distY(-200, 1100);
+    std::uniform_real_distribution<> distSize(1, 150);
+
+    for (uint32_t index = 0; index < 200; index++)
+    {
+        addCircle(store, Vector2(distX(gen), distY(gen)), distSize(gen));
+    }
+    store.sync();
+    grid.build(store);
+
+    for (uint32_t iquery = 0; iquery < 200; iquery++)
+    {
+        Rectangle area = {(float)distX(gen), (float)distY(gen), (float)distSize(gen), (float)distSize(gen)};
+        grid.query(area, candidates);
+        EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+
+        for (uint32_t index = 0; index < store.size(); index++)
+        {
+            Rectangle bounds  = store.getBounds(index);
+            bool      overlap = (bounds.x <= (area.x + area.width)) && (area.x <= (bounds.x + bounds.width)) &&
+                           (bounds.y <= (area.y + area.height)) && (area.y <= (bounds.y + bounds.height));
+            if (overlap)
+            {
+                EXPECT_TRUE(std::binary_search(candidates.begin(), candidates.end(), index));
+            }
+        }
+    }
+}
+
+} // namespace CollisionGridTest
@@ -0,0 +1,217 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "CollisionKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using ::testing::ElementsAre;
+
+namespace CollisionKernelsTest
+{
+// raylib 5.5 CheckCollisionCircles
+bool referenceCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    float dx              = center2.x - center1.x;
+    float dy              = center2.y - center1.y;
+    float distanceSquared = dx * dx + dy * dy;
+    float radiusSum       = radius1 + radius2;
+    return (distanceSquared <= (radiusSum * radiusSum));
+}
+
+// raylib 5.5 CheckCollisionCircleRec
+bool referenceCircleRec(Vector2 center, float radius, Rectangle rec)
+{
+    float recCenterX = rec.x + rec.width / 2.0f;
+    float recCenterY = rec.y + rec.height / 2.0f;
+    float dx         = fabsf(center.x - recCenterX);
+    float dy         = fabsf(center.y - recCenterY);
+
+    if (dx > (rec.width / 2.0f + radius))
+    {
+        return false;
+    }
+    if (dy > (rec.height / 2.0f + radius))
+    {
+        return false;
+    }
+    if (dx <= (rec.width / 2.0f))
+    {
+        return true;
+    }
+    if (dy <= (rec.height / 2.0f))
+    {
+        return true;
+    }
+
+    float cornerDistanceSq = (dx - rec.width / 2.0f) * (dx - rec.width / 2.0f) + (dy - rec.height / 2.0f) * (dy - rec.height / 2.0f);
+    return (cornerDistanceSq <= (radius * radius));
+}
+
+class CollisionKernelsTest : public ::testing::Test
+{
+public:
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_radius;
+    std::vector<float> m_rectX;
+    std::vector<float> m_rectY;
+    std::vector<float> m_rectWidth;
+    std::vector<float> m_rectHeight;
+
+    void addCircle(Vector2 center, float radius)
+    {
+        m_centerX.push_back(center.x);
+        m_centerY.push_back(center.y);
+        m_radius.push_back(radius);
+    }
+
+    void addRect(Rectangle rect)
+    {
+        m_rectX.push_back(rect.x);
+        m_rectY.push_back(rect.y);
+        m_rectWidth.push_back(rect.width);
+        m_rectHeight.push_back(rect.height);
+    }
+
+    CollisionKernels::CircleBatch_t circles(void)
+    {
+        return (CollisionKernels::CircleBatch_t(m_centerX.data(), m_centerY.data(), m_radius.data(), m_centerX.size()));
+    }
+
+    CollisionKernels::RectBatch_t rects(void)
+    {
+        return (CollisionKernels::RectBatch_t(m_rectX.data(), m_rectY.data(), m_rectWidth.data(), m_rectHeight.data(), m_rectX.size()));
+    }
+
+    std::vector<uint32_t> allIndices(uint32_t count)
+    {
+        std::vector<uint32_t> indices(count);
+        for (uint32_t index = 0; index < count; index++)
+        {
+            indices[index] = index;
+        }
+        return indices;
+    }
+};
+
+TEST_F(CollisionKernelsTest, lanes)
+{
+    EXPECT_EQ(CollisionKernels(CollisionKernels::SCALAR).lanes(), 1);
+    EXPECT_GE(CollisionKernels(CollisionKernels::SIMD).lanes(), 1);
+}
+
+TEST_F(CollisionKernelsTest, touchingShapesCollide)
+{
+    std::vector<uint32_t> hits;
+
+    addCircle(Vector2(0, 0), 10);
+    addCircle(Vector2(30, 0), 10);
+    addCircle(Vector2(20, 0), 10);
+    addCircle(Vector2(100, 100), 1);
+
+    for (CollisionKernels::KERNEL_t kernel : {CollisionKernels::SCALAR, CollisionKernels::SIMD})
+    {
+        CollisionKernels kernels(kernel);
+
+        kernels.circlesVsCircle(circles(), allIndices(4), Vector2(10, 0), 0, hits);
+        EXPECT_THAT(hits, ElementsAre(0, 2));
+
+        kernels.circlesVsRect(circles(), allIndices(4), Rectangle(10, -5, 10, 10), hits);
+        EXPECT_THAT(hits, ElementsAre(0, 1, 2));
+    }
+}
+
+TEST_F(CollisionKernelsTest, hitsFollowCandidateOrder)
+{
+    std::vector<uint32_t> hits;
+
+    for (uint32_t index = 0; index < 40; index++)
+    {
+        addRect(Rectangle(index * 10.0f, 0, 5, 5));
+    }
+
+    for (CollisionKernels::KERNEL_t kernel : {CollisionKernels::SCALAR, CollisionKernels::SIMD})
+    {
+        CollisionKernels kernels(kernel);
+
+        kernels.rectsVsCircle(rects(), {39, 3, 2, 1, 0, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27}, Vector2(0, 0), 12, hits);
+        EXPECT_THAT(hits, ElementsAre(1, 0));
+
+        kernels.rectsVsCircle(rects(), {}, Vector2(0, 0), 12, hits);
+        EXPECT_TRUE(hits.empty());
+    }
+}
+
+TEST_F(CollisionKernelsTest, matchesRaylibOnRandomShapes)
+{
+    CollisionKernels                      scalar(CollisionKernels::SCALAR);
+    CollisionKernels                      simd(CollisionKernels::SIMD);
+    std::vector<uint32_t>                 scalarHits;
+    std::vector<uint32_t>                 simdHits;
+    std::vector<uint32_t>                 expectedHits;
+    std::mt19937                          gen(42);
+    std::uniform_real_distribution<float> distPosition(0, 400);
+    std::uniform_real_distribution<float> distSize(0, 60);
+
+    for (uint32_t index = 0; index < 203; index++)
+    {
+        addCircle(Vector2(distPosition(gen), distPosition(gen)), distSize(gen));
+        addRect(Rectangle(distPosition(gen), distPosition(gen), distSize(gen), distSize(gen)));
+    }
+
+    std::vector<uint32_t> candidates = allIndices(203);
+    for (uint32_t iquery = 0; iquery < 50; iquery++)
+    {
+        // drop a few candidates so that the lanes gather from scattered indices
+        std::shuffle(candidates.begin(), candidates.end(), gen);
+        candidates.resize(203 - iquery);
+        std::sort(candidates.begin(), candidates.end());
+
+        Vector2   center = Vector2(distPosition(gen), distPosition(gen));
+        float     radius = distSize(gen);
+        Rectangle rect   = Rectangle(distPosition(gen), distPosition(gen), distSize(gen), distSize(gen));
+
+        expectedHits.clear();
+        for (uint32_t index : candidates)
+        {
+            if (referenceCircleRec(Vector2(m_centerX[index], m_centerY[index]), m_radius[index], rect))
+            {
+                expectedHits.push_back(index);
+            }
+        }
+        scalar.circlesVsRect(circles(), candidates, rect, scalarHits);
+        simd.circlesVsRect(circles(), candidates, rect, simdHits);
+        EXPECT_EQ(scalarHits, expectedHits);
+        EXPECT_EQ(simdHits, expectedHits);
+
+        expectedHits.clear();
+        for (uint32_t index : candidates)
+        {
+            if (referenceCircles(center, radius, Vector2(m_centerX[index], m_centerY[index]), m_radius[index]))
+            {
+                expectedHits.push_back(index);
+            }
+        }
+        scalar.circlesVsCircle(circles(), candidates, center, radius, scalarHits);
+        simd.circlesVsCircle(circles(), candidates, center, radius, simdHits);
+        EXPECT_EQ(scalarHits, expectedHits);
+        EXPECT_EQ(simdHits, expectedHits);
+
+        expectedHits.clear();
+        for (uint32_t index : candidates)
+        {
+            if (referenceCircleRec(center, radius, Rectangle(m_rectX[index], m_rectY[index], m_rectWidth[index], m_rectHeight[index])))
+            {
+                expectedHits.push_back(index);
+            }
+        }
+        scalar.rectsVsCircle(rects(), candidates, center, radius, scalarHits);
+        simd.rectsVsCircle(rects(), candidates, center, radius, simdHits);
+        EXPECT_EQ(scalarHits, expectedHits);
+        EXPECT_EQ(simdHits, expectedHits);
+    }
+}
+
+} // namespace CollisionKernelsTest
@@ -44,8 +44,8 @@ TEST_F(ExplosionTest, updateWithoutTextures_death)
 
 TEST_F(ExplosionTest, update)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     m_Explosion->setTextures(fakeTextures);
 
     EXPECT_FALSE(m_Explosion->m_discard);
@@ -66,11 +66,11 @@ TEST_F(ExplosionTest, drawWithoutTextures_death)
 
 TEST_F(ExplosionTest, draw)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     m_Explosion->setTextures(fakeTextures);
 
-    EXPECT_CALL((*m_raylibMock), drawTextureEx(A<Texture2D>(), A<Vector2>(), 0, 1, FieldsAre(255, 255, 255, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(255, 255, 255, 255)))
         .Times(Exactly(1));
     m_Explosion->draw();
 }
@@ -92,8 +92,8 @@ TEST_F(ExplosionTest, getRect_death)
 
 TEST_F(ExplosionTest, setTextures_death)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    EXPECT_DEATH(m_Explosion->setTextures({fakeTexture}), "Assertion failed");
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    EXPECT_DEATH(m_Explosion->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1)), "Assertion failed");
 }
 
 } // namespace ExplosionTest
@@ -35,7 +35,7 @@ public:
     {
         gameCommonSetup();
         m_Game->setState(Game::GAME_OVER);
-        EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+        EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
         m_Game->setPlayer(m_playerMock);
     }
 
@@ -35,7 +35,9 @@ public:
     {
         gameCommonSetup();
         m_Game->setState(Game::PLAYING);
-        EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+        m_Game->setNarrowphase(Game::RAYLIB_CALLS);
+        m_Game->setTimestep(Game::VARIABLE_STEP);
+        EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
         m_Game->setPlayer(m_playerMock);
     }
 
@@ -52,9 +54,6 @@ TEST_F(GamePlayingStateTest, loopWithOnlyPlayerAndStars)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -101,9 +100,6 @@ TEST_F(GamePlayingStateTest, playerMeteorNoCollisionTest)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -163,9 +159,6 @@ TEST_F(GamePlayingStateTest, playerMeteorCollisionTest)
         .WillOnce(Return(true));
 
     ////////// 1st loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -205,13 +198,9 @@ TEST_F(GamePlayingStateTest, playerMeteorCollisionTest)
     EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>()))
         .InSequence(seq)
         .WillOnce(Return(true));
-    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
 
     ////////// 2nd loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -264,9 +253,6 @@ TEST_F(GamePlayingStateTest, meteorLaserNoCollisionTest)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -334,9 +320,6 @@ TEST_F(GamePlayingStateTest, meteorLaserCollisionTest)
         .WillOnce(Return(true));
 
     ////////// 1st loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -382,9 +365,6 @@ TEST_F(GamePlayingStateTest, meteorLaserCollisionTest)
         .WillOnce(Return(false));
 
     ////////// 2nd loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -422,6 +402,147 @@ TEST_F(GamePlayingStateTest, meteorLaserCollisionTest)
     EXPECT_TRUE(m_spriteFactoryFake->m_explosionMocksList.size() == 1);
 }
 
+TEST_F(GamePlayingStateTest, meteorLaserCollisionBatchedKernelsTest)
+{
+    m_Game->setNarrowphase(Game::BATCHED_KERNELS);
+    m_Game->createMeteor();
+
+    EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
+    Sprite::SpriteAttr_t attr;
+    m_Game->playerShootLaser(attr);
+
+    EXPECT_TRUE(m_spriteFactoryFake->m_meteorMocksList.size() == 1);
+    EXPECT_TRUE(m_spriteFactoryFake->m_playerLaserMocksList.size() == 1);
+
+    ON_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), getCenter()).WillByDefault(Return(Vector2(400, 300)));
+    ON_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), getRadius()).WillByDefault(Return(50));
+    ON_CALL((*(m_spriteFactoryFake->m_playerLaserMocksList[0])), getRect()).WillByDefault(Return(Rectangle(440, 320, 10, 40)));
+    ON_CALL((*m_playerMock), getCenter()).WillByDefault(Return(Vector2(800, 800)));
+    ON_CALL((*m_playerMock), getRadius()).WillByDefault(Return(40));
+
+    EXPECT_CALL((*m_raylibMock), windowShouldClose())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+
+    EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
+    for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
+    {
+        EXPECT_CALL((*(m_spriteFactoryFake->m_starMocksList[n])), update()).InSequence(seq);
+    }
+    EXPECT_CALL((*(m_spriteFactoryFake->m_playerLaserMocksList[0])), update()).InSequence(seq);
+    EXPECT_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), update()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), updateMusicStream(A<Music>())).InSequence(seq);
+
+    EXPECT_CALL((*m_raylibMock), beginDrawing()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), clearBackground(FieldsAre(0, 0, 0, 255))).InSequence(seq);
+    for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
+    {
+        EXPECT_CALL((*(m_spriteFactoryFake->m_starMocksList[n])), draw()).InSequence(seq);
+    }
+    EXPECT_CALL((*m_playerMock), draw()).InSequence(seq);
+    EXPECT_CALL((*(m_spriteFactoryFake->m_playerLaserMocksList[0])), draw()).InSequence(seq);
+    EXPECT_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), draw()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(),
+                                            "lives:     3",
+                                            FieldsAre((WINDOW_WIDTH - 150), 30),
+                                            STAT_FONTSIZE,
+                                            0,
+                                            FieldsAre(255, 255, 255, 255)))
+        .InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(),
+                                            "score:    0",
+                                            FieldsAre((WINDOW_WIDTH - 150), (30 + STAT_FONTSIZE)),
+                                            STAT_FONTSIZE,
+                                            0,
+                                            FieldsAre(255, 255, 255, 255)))
+        .InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), endDrawing()).InSequence(seq);
+
+    EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), getRadius()).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), checkCollisionCircleRec(A<Vector2>(), A<float>(), A<Rectangle>())).Times(Exactly(0));
+    EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>())).Times(Exactly(0));
+
+    m_Game->run();
+
+    EXPECT_TRUE((m_spriteFactoryFake->m_playerLaserMocksList[0])->m_discard);
+    EXPECT_TRUE((m_spriteFactoryFake->m_meteorMocksList[0])->m_discard);
+    EXPECT_FALSE(m_playerMock->m_discard);
+    EXPECT_TRUE(m_spriteFactoryFake->m_explosionMocksList.size() == 1);
+}
+
+TEST_F(GamePlayingStateTest, culledLaserDoesNotHitTheMeteorsInTheMargin)
+{
+    m_Game->setNarrowphase(Game::BATCHED_KERNELS);
+    m_Game->createMeteor();
+
+    EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
+    Sprite::SpriteAttr_t attr;
+    m_Game->playerShootLaser(attr);
+
+    EXPECT_TRUE(m_spriteFactoryFake->m_meteorMocksList.size() == 1);
+    EXPECT_TRUE(m_spriteFactoryFake->m_playerLaserMocksList.size() == 1);
+
+    ON_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), getCenter()).WillByDefault(Return(Vector2(400, -80)));
+    ON_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), getRadius()).WillByDefault(Return(50));
+    ON_CALL((*(m_spriteFactoryFake->m_playerLaserMocksList[0])), getRect()).WillByDefault(Return(Rectangle(440, -100, 10, 40)));
+    ON_CALL((*m_playerMock), getCenter()).WillByDefault(Return(Vector2(800, 800)));
+    ON_CALL((*m_playerMock), getRadius()).WillByDefault(Return(40));
+
+    EXPECT_CALL((*m_raylibMock), windowShouldClose())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+
+    EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
+    for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
+    {
+        EXPECT_CALL((*(m_spriteFactoryFake->m_starMocksList[n])), update()).InSequence(seq);
+    }
+    EXPECT_CALL((*(m_spriteFactoryFake->m_playerLaserMocksList[0])), update()).InSequence(seq);
+    EXPECT_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), update()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), updateMusicStream(A<Music>())).InSequence(seq);
+
+    EXPECT_CALL((*m_raylibMock), beginDrawing()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), clearBackground(FieldsAre(0, 0, 0, 255))).InSequence(seq);
+    for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
+    {
+        EXPECT_CALL((*(m_spriteFactoryFake->m_starMocksList[n])), draw()).InSequence(seq);
+    }
+    EXPECT_CALL((*m_playerMock), draw()).InSequence(seq);
+    EXPECT_CALL((*(m_spriteFactoryFake->m_playerLaserMocksList[0])), draw()).InSequence(seq);
+    EXPECT_CALL((*(m_spriteFactoryFake->m_meteorMocksList[0])), draw()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(),
+                                            "lives:     3",
+                                            FieldsAre((WINDOW_WIDTH - 150), 30),
+                                            STAT_FONTSIZE,
+                                            0,
+                                            FieldsAre(255, 255, 255, 255)))
+        .InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(),
+                                            "score:    0",
+                                            FieldsAre((WINDOW_WIDTH - 150), (30 + STAT_FONTSIZE)),
+                                            STAT_FONTSIZE,
+                                            0,
+                                            FieldsAre(255, 255, 255, 255)))
+        .InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), endDrawing()).InSequence(seq);
+
+    // the laser is past its margin and culled, the meteor overlapping it is still within its own
+    EXPECT_CALL((*m_playerMock), getRadius()).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), checkCollisionCircleRec(A<Vector2>(), A<float>(), A<Rectangle>())).Times(Exactly(0));
+    EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>())).Times(Exactly(0));
+
+    m_Game->run();
+
+    EXPECT_TRUE((m_spriteFactoryFake->m_playerLaserMocksList[0])->m_discard);
+    EXPECT_FALSE((m_spriteFactoryFake->m_meteorMocksList[0])->m_discard);
+    EXPECT_FALSE(m_playerMock->m_discard);
+    EXPECT_TRUE(m_spriteFactoryFake->m_explosionMocksList.empty());
+    EXPECT_EQ(m_Game->getStats().m_culled, 1);
+}
+
 TEST_F(GamePlayingStateTest, playerOpponentNoCollisionTest)
 {
     m_Game->createOpponent();
@@ -432,9 +553,6 @@ TEST_F(GamePlayingStateTest, playerOpponentNoCollisionTest)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -494,9 +612,6 @@ TEST_F(GamePlayingStateTest, playerOpponentCollisionTest)
         .WillOnce(Return(true));
 
     ////////// 1st loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -536,13 +651,9 @@ TEST_F(GamePlayingStateTest, playerOpponentCollisionTest)
     EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>()))
         .InSequence(seq)
         .WillOnce(Return(true));
-    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
 
     ////////// 2nd loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -595,9 +706,6 @@ TEST_F(GamePlayingStateTest, opponentLaserNoCollisionTest)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -665,9 +773,6 @@ TEST_F(GamePlayingStateTest, opponentLaserCollisionTest)
         .WillOnce(Return(true));
 
     ////////// 1st loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -713,9 +818,6 @@ TEST_F(GamePlayingStateTest, opponentLaserCollisionTest)
         .WillOnce(Return(false));
 
     ////////// 2nd loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -764,9 +866,6 @@ TEST_F(GamePlayingStateTest, playerOpponentLaserNoCollisionTest)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -826,9 +925,6 @@ TEST_F(GamePlayingStateTest, playerOpponentLaserCollisionTest)
         .WillOnce(Return(true));
 
     ////////// 1st loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -867,13 +963,9 @@ TEST_F(GamePlayingStateTest, playerOpponentLaserCollisionTest)
     EXPECT_CALL((*m_raylibMock), checkCollisionCircleRec(A<Vector2>(), A<float>(), A<Rectangle>()))
         .InSequence(seq)
         .WillOnce(Return(true));
-    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
 
     ////////// 2nd loop //////////
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -922,9 +1014,6 @@ TEST_F(GamePlayingStateTest, playerMeteor3xCollisionsTestAndTransitionToGameOver
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -964,7 +1053,6 @@ TEST_F(GamePlayingStateTest, playerMeteor3xCollisionsTestAndTransitionToGameOver
     EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>()))
         .InSequence(seq)
         .WillOnce(Return(true));
-    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
 
     m_Game->run();
@@ -983,9 +1071,6 @@ TEST_F(GamePlayingStateTest, playerMeteor3xCollisionsTestAndTransitionToGameOver
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -1025,7 +1110,6 @@ TEST_F(GamePlayingStateTest, playerMeteor3xCollisionsTestAndTransitionToGameOver
     EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>()))
         .InSequence(seq)
         .WillOnce(Return(true));
-    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
 
     m_Game->run();
@@ -1044,9 +1128,6 @@ TEST_F(GamePlayingStateTest, playerMeteor3xCollisionsTestAndTransitionToGameOver
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -1086,8 +1167,6 @@ TEST_F(GamePlayingStateTest, playerMeteor3xCollisionsTestAndTransitionToGameOver
     EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>()))
         .InSequence(seq)
         .WillOnce(Return(true));
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq).WillOnce(Return(1));
-    EXPECT_CALL((*m_playerMock), getCenter()).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).InSequence(seq);
 
     m_Game->run();
@@ -1101,10 +1180,7 @@ TEST_F(GamePlayingStateTest, playerMeteor3xCollisionsTestAndTransitionToGameOver
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq).WillOnce(Return(2));
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).InSequence(seq).WillOnce(Return(1)); //m_rampdownTimer timeout
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -1176,9 +1252,6 @@ TEST_F(GamePlayingStateTest, playerDispersionPowerupNoCollisionTest)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -1234,9 +1307,6 @@ TEST_F(GamePlayingStateTest, playerDispersionPowerupCollisionTest)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
 
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
     EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
     for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
     {
@@ -1284,4 +1354,120 @@ TEST_F(GamePlayingStateTest, playerDispersionPowerupCollisionTest)
     EXPECT_TRUE((m_spriteFactoryFake->m_dispersionMocksList[0])->m_discard);
 }
 
+TEST_F(GamePlayingStateTest, fixedTimestepRunsWholeTicks)
+{
+    m_Game->setTimestep(Game::FIXED_STEP);
+    m_Game->setTickRate(60);
+
+    EXPECT_CALL((*m_raylibMock), windowShouldClose())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+
+    // two and a half ticks of frame time run two ticks, the half is carried over
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).InSequence(seq).WillOnce(Return(2.5f / 60));
+    for (uint32_t tick = 0; tick < 2; tick++)
+    {
+        EXPECT_CALL((*m_playerMock), update()).InSequence(seq);
+        for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
+        {
+            EXPECT_CALL((*(m_spriteFactoryFake->m_starMocksList[n])), update()).InSequence(seq);
+        }
+    }
+    EXPECT_CALL((*m_raylibMock), updateMusicStream(A<Music>())).InSequence(seq);
+
+    EXPECT_CALL((*m_raylibMock), beginDrawing()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), clearBackground(FieldsAre(0, 0, 0, 255))).InSequence(seq);
+    for (uint32_t n = 0; n < NUMBER_OF_STARS; n++)
+    {
+        EXPECT_CALL((*(m_spriteFactoryFake->m_starMocksList[n])), draw()).InSequence(seq);
+    }
+    EXPECT_CALL((*m_playerMock), draw()).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(), "lives:     3", _, STAT_FONTSIZE, 0, _)).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(), "score:    0", _, STAT_FONTSIZE, 0, _)).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), endDrawing()).InSequence(seq);
+
+    m_Game->run();
+}
+
+TEST_F(GamePlayingStateTest, statsCountTicksFramesAndSprites)
+{
+    m_Game->setTimestep(Game::FIXED_STEP);
+    m_Game->setTickRate(60);
+
+    EXPECT_CALL((*m_raylibMock), windowShouldClose())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(2.5f / 60));
+
+    m_Game->run();
+
+    // the player and the stars, stepped twice and drawn once
+    Game::Stats_t stats = m_Game->getStats();
+    EXPECT_EQ(stats.m_ticks, 2);
+    EXPECT_EQ(stats.m_frames, 1);
+    EXPECT_EQ(stats.m_tickSprites, (2 * (1 + NUMBER_OF_STARS)));
+    EXPECT_EQ(stats.m_frameSprites, (1 + NUMBER_OF_STARS));
+    EXPECT_EQ(stats.m_peakSprites, (1 + NUMBER_OF_STARS));
+
+    m_Game->resetStats();
+    EXPECT_EQ(m_Game->getStats().m_ticks, 0);
+    EXPECT_EQ(m_Game->getStats().m_updateNs, 0);
+}
+
+TEST_F(GamePlayingStateTest, spawnMultiplierScalesTheSpawns)
+{
+    m_Game->setSpawnMultiplier(3);
+    EXPECT_EQ(m_spriteFactoryFake->m_starMocksList.size(), (3 * NUMBER_OF_STARS));
+
+    // one shot, three lasers, one sound
+    EXPECT_CALL((*m_raylibMock), playSound(A<Sound>())).Times(Exactly(1));
+    m_Game->playerShootLaser(Sprite::SpriteAttr_t());
+    EXPECT_EQ(m_spriteFactoryFake->m_playerLaserMocksList.size(), 3);
+}
+
+TEST_F(GamePlayingStateTest, unlimitedLivesKeepTheLives)
+{
+    m_Game->setLives(Game::UNLIMITED_LIVES);
+    m_Game->createMeteor();
+
+    EXPECT_CALL((*m_raylibMock), windowShouldClose())
+        .WillOnce(Return(false))
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>())).WillOnce(Return(true));
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(), "lives:     3", _, STAT_FONTSIZE, 0, _)).Times(Exactly(2));
+    EXPECT_CALL((*m_raylibMock), drawTextEx(A<Font>(), "score:    0", _, STAT_FONTSIZE, 0, _)).Times(Exactly(2));
+
+    m_Game->run();
+
+    EXPECT_TRUE((m_spriteFactoryFake->m_meteorMocksList[0])->m_discard);
+    EXPECT_TRUE(m_playerMock->m_discard);
+}
+
+TEST_F(GamePlayingStateTest, spawnTimerAfterTheRampdownSpawnsNothing)
+{
+    // three frames of no time, a meteor hits the player in each of them
+    for (uint32_t life = 0; life < MAX_LIVES; life++)
+    {
+        m_playerMock->m_discard = false;
+        m_Game->createMeteor();
+        EXPECT_CALL((*m_raylibMock), windowShouldClose())
+            .WillOnce(Return(false))
+            .WillOnce(Return(true));
+        EXPECT_CALL((*m_raylibMock), checkCollisionCircles(A<Vector2>(), A<float>(), A<Vector2>(), A<float>())).WillOnce(Return(true));
+        m_Game->run();
+    }
+
+    // the meteor timer expires at 0.4 s and 0.8 s, the ramp down at 1 s, then
+    // the meteor timer again at 1.2 s within the same frame
+    EXPECT_CALL((*m_raylibMock), windowShouldClose())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).WillRepeatedly(Return(1.5));
+    m_Game->run();
+
+    // the two meteors before the ramp down, none after it
+    EXPECT_EQ(m_spriteFactoryFake->m_meteorMocksList.size(), (MAX_LIVES + 2));
+}
+
 } // namespace GameTest
@@ -7,6 +7,7 @@
 #include "RaylibMock.h"
 #include "SpriteFactoryFake.h"
 #include "SpriteMock.h"
+#include "TimerWheel.h"
 
 using ::testing::_;
 using ::testing::A;
@@ -24,12 +25,14 @@ std::shared_ptr<Game>              m_Game              = nullptr;
 std::shared_ptr<RaylibMock>        m_raylibMock        = nullptr;
 std::shared_ptr<SpriteFactoryFake> m_spriteFactoryFake = nullptr;
 std::shared_ptr<PlayerMock>        m_playerMock        = nullptr;
+std::shared_ptr<TimerWheel>        m_timers            = nullptr;
 
 void gameCommonSetup(void)
 {
     m_raylibMock        = std::make_shared<RaylibMock>();
     m_spriteFactoryFake = std::make_shared<SpriteFactoryFake>();
     m_playerMock        = std::make_shared<PlayerMock>();
+    m_timers            = std::make_shared<TimerWheel>();
 
     ASSERT_TRUE(m_raylibMock != nullptr);
     ASSERT_TRUE(m_spriteFactoryFake != nullptr);
@@ -43,18 +46,47 @@ void gameCommonSetup(void)
         .Times(Exactly(1))
         .InSequence(seq);
 
-    EXPECT_CALL((*m_raylibMock), loadTexture(A<std::string>()))
+    EXPECT_CALL((*m_raylibMock), loadFontEx(_, _, _, _))
+        .Times(Exactly(1))
+        .InSequence(seq);
+
+    // a loader without workers decodes the files as they are queued
+    EXPECT_CALL((*m_raylibMock), loadImage(A<std::string>()))
         .Times(Exactly(34))
         .InSequence(seq);
 
-    EXPECT_CALL((*m_raylibMock), loadFontEx(_, _, _, _))
+    EXPECT_CALL((*m_raylibMock), loadWave(A<std::string>()))
+        .Times(Exactly(6))
+        .InSequence(seq);
+
+    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Back", (MENU_ITEM_FONTSIZE + 10), 0)).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Game Over", GAME_OVER_FONTSIZE, 0)).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Retry", (MENU_ITEM_FONTSIZE + 30), 0)).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Quit", (MENU_ITEM_FONTSIZE + 30), 0)).InSequence(seq);
+
+    // then the 34 images are packed into a single atlas page
+    EXPECT_CALL((*m_raylibMock), genImageColor(_, _, _))
         .Times(Exactly(1))
         .InSequence(seq);
 
-    EXPECT_CALL((*m_raylibMock), loadSound(A<std::string>()))
-        .Times(Exactly(6))
+    EXPECT_CALL((*m_raylibMock), imageDraw(_, _, _, _, _))
+        .Times(Exactly(34))
         .InSequence(seq);
 
+    EXPECT_CALL((*m_raylibMock), loadTextureFromImage(A<Image>()))
+        .Times(Exactly(1))
+        .InSequence(seq);
+
+    EXPECT_CALL((*m_raylibMock), unloadImage(A<Image>()))
+        .Times(Exactly(35))
+        .InSequence(seq);
+
+    for (uint32_t n = 0; n < 6; n++)
+    {
+        EXPECT_CALL((*m_raylibMock), loadSoundFromWave(A<Wave>())).InSequence(seq);
+        EXPECT_CALL((*m_raylibMock), unloadWave(A<Wave>())).InSequence(seq);
+    }
+
     EXPECT_CALL((*m_raylibMock), loadMusicStream(A<std::string>()))
         .Times(Exactly(1))
         .InSequence(seq);
@@ -63,16 +95,7 @@ void gameCommonSetup(void)
         .Times(Exactly(1))
         .InSequence(seq);
 
-    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Back", (MENU_ITEM_FONTSIZE + 10), 0)).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Game Over", GAME_OVER_FONTSIZE, 0)).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Retry", (MENU_ITEM_FONTSIZE + 30), 0)).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), measureTextEx(A<Font>(), "Quit", (MENU_ITEM_FONTSIZE + 30), 0)).InSequence(seq);
-
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), getTime()).InSequence(seq);
-
-    m_Game = std::make_shared<Game>(m_raylibMock, m_spriteFactoryFake);
+    m_Game = std::make_shared<Game>(m_raylibMock, m_spriteFactoryFake, m_timers, std::make_shared<AssetLoader>(m_raylibMock, 0));
 
     ASSERT_TRUE(m_Game != nullptr);
     ASSERT_TRUE(m_spriteFactoryFake->m_starMocksList.size() == NUMBER_OF_STARS);
@@ -83,7 +106,7 @@ void gameCommonTeardown(void)
     EXPECT_CALL((*m_raylibMock), unloadMusicStream(A<Music>())).Times(Exactly(1)).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), unloadSound(A<Sound>())).Times(Exactly(6)).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), unloadFont(A<Font>())).Times(Exactly(1)).InSequence(seq);
-    EXPECT_CALL((*m_raylibMock), unloadTexture(A<Texture2D>())).Times(Exactly(34)).InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), unloadTexture(A<Texture2D>())).Times(Exactly(1)).InSequence(seq);
     EXPECT_CALL((*m_raylibMock), closeAudioDevice()).Times(Exactly(1)).InSequence(seq);
 
     Mock::VerifyAndClearExpectations(&m_raylibMock);
@@ -114,7 +137,7 @@ TEST_F(GameWelcomeStateTest, gameRunWithoutPlayerSet_death)
 
 TEST_F(GameWelcomeStateTest, mousePointingToNothing)
 {
-    EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
     m_Game->setPlayer(m_playerMock);
 
     EXPECT_CALL((*m_raylibMock), windowShouldClose())
@@ -182,7 +205,7 @@ TEST_F(GameWelcomeStateTest, mousePointingToNothing)
 
 TEST_F(GameWelcomeStateTest, mousePointingToStartButtonButNotClick)
 {
-    EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
     m_Game->setPlayer(m_playerMock);
 
     EXPECT_CALL((*m_raylibMock), windowShouldClose())
@@ -252,7 +275,7 @@ TEST_F(GameWelcomeStateTest, mousePointingToStartButtonButNotClick)
 
 TEST_F(GameWelcomeStateTest, mousePointingToStartButtonAndClickAndTransitionToPlaying)
 {
-    EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
     m_Game->setPlayer(m_playerMock);
 
     EXPECT_CALL((*m_raylibMock), windowShouldClose())
@@ -322,7 +345,7 @@ TEST_F(GameWelcomeStateTest, mousePointingToStartButtonAndClickAndTransitionToPl
 
 TEST_F(GameWelcomeStateTest, mousePointingToSettingsButtonButNotClick)
 {
-    EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
     m_Game->setPlayer(m_playerMock);
 
     EXPECT_CALL((*m_raylibMock), windowShouldClose())
@@ -394,7 +417,7 @@ TEST_F(GameWelcomeStateTest, mousePointingToSettingsButtonButNotClick)
 
 TEST_F(GameWelcomeStateTest, mousePointingToSettingsButtonAndClickAndTransitionToSettings)
 {
-    EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
     m_Game->setPlayer(m_playerMock);
 
     EXPECT_CALL((*m_raylibMock), windowShouldClose())
@@ -466,7 +489,7 @@ TEST_F(GameWelcomeStateTest, mousePointingToSettingsButtonAndClickAndTransitionT
 
 TEST_F(GameWelcomeStateTest, mousePointingToQuitButtonButNotClick)
 {
-    EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
     m_Game->setPlayer(m_playerMock);
 
     EXPECT_CALL((*m_raylibMock), windowShouldClose())
@@ -538,7 +561,7 @@ TEST_F(GameWelcomeStateTest, mousePointingToQuitButtonButNotClick)
 
 TEST_F(GameWelcomeStateTest, mousePointingToQuitButtonAndClickAndTransitionToQuit)
 {
-    EXPECT_CALL((*m_playerMock), setTextures(A<std::vector<Texture2D>>())).InSequence(seq);
+    EXPECT_CALL((*m_playerMock), setTextures(A<TextureAtlas::Frames_t>())).InSequence(seq);
     m_Game->setPlayer(m_playerMock);
 
     EXPECT_CALL((*m_raylibMock), windowShouldClose())
@@ -47,20 +47,22 @@ TEST_F(LaserTest, updateWithoutTextures_death)
 
 TEST_F(LaserTest, update)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Laser->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Laser->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_FALSE(m_Laser->m_discard);
 
     //first call, the laser is still within frame
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1));
     m_Laser->update();
+    EXPECT_THAT(m_Laser->getRect(), FieldsAre(0, (WINDOW_HEIGHT - LASER_SPEED), 0, 0));
     EXPECT_FALSE(m_Laser->m_discard);
 
-    //second call, the laser is out of frame
+    //second call, the laser is out of frame, the game culls it
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1));
     m_Laser->update();
-    EXPECT_TRUE(m_Laser->m_discard);
+    EXPECT_THAT(m_Laser->getRect(), FieldsAre(0, (WINDOW_HEIGHT - (2 * LASER_SPEED)), 0, 0));
+    EXPECT_FALSE(m_Laser->m_discard);
 }
 
 TEST_F(LaserTest, drawWithoutTextures_death)
@@ -70,14 +72,32 @@ TEST_F(LaserTest, drawWithoutTextures_death)
 
 TEST_F(LaserTest, draw)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Laser->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Laser->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
-    EXPECT_CALL((*m_raylibMock), drawTextureEx(A<Texture2D>(), A<Vector2>(), 180, 1, FieldsAre(255, 255, 255, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 180, FieldsAre(255, 255, 255, 255)))
         .Times(Exactly(1));
     m_Laser->draw();
 }
 
+TEST_F(LaserTest, stepAndDrawBlended)
+{
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Laser->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
+
+    // a fixed tick does not ask raylib for the frame time
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).Times(Exactly(0));
+    m_Laser->step(0.5);
+
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), FieldsAre(0, (WINDOW_HEIGHT - (LASER_SPEED * 0.25)), 0, 0), FieldsAre(0, 0), 180, FieldsAre(255, 255, 255, 255)))
+        .Times(Exactly(1));
+    m_Laser->drawBlended(0.5);
+
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), FieldsAre(0, (WINDOW_HEIGHT - (LASER_SPEED * 0.5)), 0, 0), FieldsAre(0, 0), 180, FieldsAre(255, 255, 255, 255)))
+        .Times(Exactly(1));
+    m_Laser->drawBlended(1);
+}
+
 TEST_F(LaserTest, getCenter_death)
 {
     EXPECT_DEATH(m_Laser->getCenter(), "Assertion failed");
@@ -95,16 +115,16 @@ TEST_F(LaserTest, getRectWithoutTextures_death)
 
 TEST_F(LaserTest, getRect)
 {
-    Texture2D fakeTexture = {0, 5, 15, 0, 0};
-    m_Laser->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 5, 15}};
+    m_Laser->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_THAT(m_Laser->getRect(), FieldsAre(5, (WINDOW_HEIGHT + 15), 5, 15));
 }
 
 TEST_F(LaserTest, setTextures_death)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     EXPECT_DEATH(m_Laser->setTextures(fakeTextures), "Assertion failed");
 }
 
@@ -0,0 +1,149 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "Logger.h"
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LoggerTest
+{
+class LoggerTest : public ::testing::Test
+{
+public:
+    // the log file stays open for the lifetime of the singleton, each test only
+    // reads what was appended after its SetUp
+    std::streamoff m_start = 0;
+
+    static std::string logFilePath(void)
+    {
+        return ::testing::TempDir() + "asteroidsLoggerTest.log";
+    }
+
+    void SetUp(void)
+    {
+        Logger::getInstance().setVerbosityLevel(Logger::ALL);
+        Logger::getInstance().setLogFile(logFilePath());
+
+        std::ifstream file(logFilePath(), std::ios_base::ate);
+        m_start = file.tellg();
+    }
+
+    void TearDown(void)
+    {
+        Logger::getInstance().setMode(Logger::SYNCHRONOUS);
+    }
+
+    std::vector<std::string> readLines(const std::string& marker)
+    {
+        std::vector<std::string> lines;
+        std::ifstream            file(logFilePath());
+        std::string              line;
+
+        file.seekg(m_start);
+        while (std::getline(file, line))
+        {
+            if (line.find(marker) != std::string::npos)
+            {
+                lines.push_back(line);
+            }
+        }
+        return lines;
+    }
+};
+
+TEST_F(LoggerTest, blockKeepsEveryMessageInOrder)
+{
+    const uint32_t threads  = 4;
+    const uint32_t messages = 500;
+
+    Logger::getInstance().setMode(Logger::ASYNCHRONOUS, Logger::BLOCK);
+
+    std::vector<std::thread> producers;
+    for (uint32_t thread = 0; thread < threads; thread++)
+    {
+        producers.emplace_back([thread](void) {
+            for (uint32_t message = 0; message < messages; message++)
+            {
+                Logger::getInstance().log(Logger::INFO, "loggertest-block " + std::to_string(thread) + " " + std::to_string(message));
+            }
+        });
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    Logger::getInstance().flush();
+
+    std::vector<std::string> lines = readLines("loggertest-block ");
+    ASSERT_EQ(lines.size(), threads * messages);
+
+    std::vector<uint32_t> next(threads, 0);
+    for (const std::string& line : lines)
+    {
+        uint32_t thread  = 0;
+        uint32_t message = 0;
+        ASSERT_EQ(std::sscanf(line.substr(line.find("loggertest-block ")).c_str(), "loggertest-block %u %u", &thread, &message), 2);
+        ASSERT_LT(thread, threads);
+        EXPECT_EQ(message, next[thread]);
+        next[thread] = message + 1;
+    }
+}
+
+TEST_F(LoggerTest, blockDrainsAFullRingWithoutWaitingForTheInterval)
+{
+    // 32 rings of 1024 records, each overflow would sleep a 10 ms interval if the
+    // producer could not wake the background thread
+    const uint32_t messages = 32 * 1024;
+
+    Logger::getInstance().setMode(Logger::ASYNCHRONOUS, Logger::BLOCK);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t message = 0; message < messages; message++)
+    {
+        Logger::getInstance().log(Logger::INFO, "loggertest-full " + std::to_string(message));
+    }
+    Logger::getInstance().flush();
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(elapsed, std::chrono::milliseconds(160));
+    EXPECT_EQ(readLines("loggertest-full ").size(), messages);
+}
+
+TEST_F(LoggerTest, countDroppedWritesTheRestOnShutdown)
+{
+    const uint32_t messages = 5000;
+    uint64_t       dropped  = Logger::getInstance().getDroppedCount();
+
+    Logger::getInstance().setMode(Logger::ASYNCHRONOUS, Logger::COUNT_DROPPED);
+    for (uint32_t message = 0; message < messages; message++)
+    {
+        Logger::getInstance().log(Logger::DEBUG, "loggertest-dropped " + std::to_string(message));
+    }
+
+    // leaving ASYNCHRONOUS writes everything still in the ring
+    Logger::getInstance().setMode(Logger::SYNCHRONOUS);
+    dropped = Logger::getInstance().getDroppedCount() - dropped;
+
+    EXPECT_EQ(readLines("loggertest-dropped ").size(), messages - dropped);
+    if (dropped > 0)
+    {
+        EXPECT_FALSE(readLines(" log messages dropped").empty());
+    }
+}
+
+TEST_F(LoggerTest, longMessagesAreTruncated)
+{
+    Logger::getInstance().setMode(Logger::ASYNCHRONOUS, Logger::BLOCK);
+    Logger::getInstance().log(Logger::WARNING, "loggertest-long " + std::string(1000, 'x'));
+    Logger::getInstance().flush();
+
+    std::vector<std::string> lines = readLines("loggertest-long ");
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0].find("\033[33m[WARNING] ["), 0);
+    EXPECT_NE(lines[0].find("loggertest-long xxx"), std::string::npos);
+    EXPECT_LT(lines[0].size(), 300);
+}
+
+} // namespace LoggerTest
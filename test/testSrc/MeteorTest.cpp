@@ -42,8 +42,8 @@ TEST_F(MeteorTest, updateWithoutTextures_death)
 
 TEST_F(MeteorTest, update)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Meteor->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Meteor->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1));
     m_Meteor->update();
@@ -56,11 +56,12 @@ TEST_F(MeteorTest, drawWithoutTextures_death)
 
 TEST_F(MeteorTest, draw)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Meteor->setTextures({fakeTexture});
+    // the frame is somewhere in an atlas page
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {8, 12, 4, 4}};
+    m_Meteor->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(),
-                                                FieldsAre(0, 0, 4, 4),
+                                                FieldsAre(8, 12, 4, 4),
                                                 A<Rectangle>(),
                                                 FieldsAre(2, 2),
                                                 A<float>(),
@@ -76,8 +77,8 @@ TEST_F(MeteorTest, getCenterWithoutTextures_death)
 
 TEST_F(MeteorTest, getCenter)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Meteor->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Meteor->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_THAT(m_Meteor->getCenter(), A<Vector2>());
 }
@@ -89,8 +90,8 @@ TEST_F(MeteorTest, getRadiusWithoutTextures_death)
 
 TEST_F(MeteorTest, getRadius)
 {
-    Texture2D fakeTexture = {0, 4, 15, 0, 0};
-    m_Meteor->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 15}};
+    m_Meteor->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_EQ(m_Meteor->getRadius(), 2);
 }
@@ -102,8 +103,8 @@ TEST_F(MeteorTest, getRect_death)
 
 TEST_F(MeteorTest, setTextures_death)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     EXPECT_DEATH(m_Meteor->setTextures(fakeTextures), "Assertion failed");
 }
 
@@ -47,8 +47,8 @@ TEST_F(OpponentTest, updateWithoutTextures_death)
 
 TEST_F(OpponentTest, update)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Opponent->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Opponent->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1));
     m_Opponent->update();
@@ -61,14 +61,15 @@ TEST_F(OpponentTest, drawWithoutTextures_death)
 
 TEST_F(OpponentTest, draw)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Opponent->setTextures({fakeTexture});
-
-    EXPECT_CALL((*m_raylibMock), drawTextureEx(A<Texture2D>(),
-                                               A<Vector2>(),
-                                               180,
-                                               1,
-                                               FieldsAre(230, 41, 55, 255)))
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Opponent->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
+
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(),
+                                                A<Rectangle>(),
+                                                A<Rectangle>(),
+                                                FieldsAre(0, 0),
+                                                180,
+                                                FieldsAre(230, 41, 55, 255)))
         .Times(Exactly(1));
     m_Opponent->draw();
 }
@@ -80,8 +81,8 @@ TEST_F(OpponentTest, getCenterWithoutTextures_death)
 
 TEST_F(OpponentTest, getCenter)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Opponent->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Opponent->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_THAT(m_Opponent->getCenter(), A<Vector2>());
 }
@@ -93,8 +94,8 @@ TEST_F(OpponentTest, getRadiusWithoutTextures_death)
 
 TEST_F(OpponentTest, getRadius)
 {
-    Texture2D fakeTexture = {0, 4, 15, 0, 0};
-    m_Opponent->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 15}};
+    m_Opponent->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_EQ(m_Opponent->getRadius(), 2);
 }
@@ -106,8 +107,8 @@ TEST_F(OpponentTest, getRect_death)
 
 TEST_F(OpponentTest, setTextures_death)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     EXPECT_DEATH(m_Opponent->setTextures(fakeTextures), "Assertion failed");
 }
 
@@ -3,6 +3,7 @@
 #include "Player.h"
 #include <memory>
 #include "RaylibMock.h"
+#include "TimerWheel.h"
 
 using ::testing::A;
 using ::testing::Exactly;
@@ -17,20 +18,24 @@ class PlayerTest : public ::testing::Test
 public:
     std::shared_ptr<Player>     m_Player     = nullptr;
     std::shared_ptr<RaylibMock> m_raylibMock = nullptr;
+    std::shared_ptr<TimerWheel> m_timers     = nullptr;
+    uint32_t                    m_lasers     = 0;
 
     void shootLaser(Sprite::SpriteAttr_t attr)
     {
+        m_lasers++;
     }
 
     void SetUp(void)
     {
         m_raylibMock = std::make_shared<RaylibMock>();
         ASSERT_TRUE(m_raylibMock != nullptr);
+        m_timers = std::make_shared<TimerWheel>();
 
         EXPECT_CALL((*m_raylibMock), isWindowReady()).WillOnce(Return(true));
 
         std::function<void(Sprite::SpriteAttr_t)> f_shootLaser = std::bind(&PlayerTest::shootLaser, this, std::placeholders::_1);
-        m_Player                                               = std::make_shared<Player>(m_raylibMock, f_shootLaser);
+        m_Player                                               = std::make_shared<Player>(m_raylibMock, m_timers, f_shootLaser);
         ASSERT_TRUE(m_Player != nullptr);
     }
 
@@ -47,8 +52,8 @@ TEST_F(PlayerTest, updateWithoutTextures_death)
 
 TEST_F(PlayerTest, updatePlayableWithoutSpaceKeyPressed)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Player->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Player->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
     m_Player->m_discard = false;
 
     EXPECT_CALL((*m_raylibMock), isKeyDown(KEY_RIGHT)).Times(Exactly(1));
@@ -63,8 +68,8 @@ TEST_F(PlayerTest, updatePlayableWithoutSpaceKeyPressed)
 
 TEST_F(PlayerTest, updatePlayableWithSpaceKeyPressedNonDispersedLaser)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Player->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Player->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
     m_Player->m_discard = false;
 
     EXPECT_CALL((*m_raylibMock), isKeyDown(KEY_RIGHT)).Times(Exactly(1));
@@ -84,10 +89,10 @@ TEST_F(PlayerTest, drawWithoutTextures_death)
 
 TEST_F(PlayerTest, draw)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Player->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Player->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
-    EXPECT_CALL((*m_raylibMock), drawTextureV(A<Texture2D>(), A<Vector2>(), FieldsAre(255, 255, 255, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(255, 255, 255, 255)))
         .Times(Exactly(1));
 
     m_Player->draw();
@@ -105,8 +110,8 @@ TEST_F(PlayerTest, getRadiusWithoutTextures_death)
 
 TEST_F(PlayerTest, getCenter_getRadius)
 {
-    Texture2D fakeTexture = {0, 6, 10, 0, 0};
-    m_Player->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 6, 10}};
+    m_Player->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_EQ(m_Player->getRadius(), 3);
     EXPECT_THAT(m_Player->getCenter(), FieldsAre(800, 795));
@@ -114,40 +119,36 @@ TEST_F(PlayerTest, getCenter_getRadius)
 
 TEST_F(PlayerTest, setTextures_death)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     EXPECT_DEATH(m_Player->setTextures(fakeTextures), "Assertion failed");
 }
 
 TEST_F(PlayerTest, stateMachine)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Player->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Player->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_TRUE(m_Player->m_discard);
 
     // PLAYABLE --> INVISIBLE
-    EXPECT_CALL((*m_raylibMock), getTime()).WillOnce(Return(1)); //m_invisibleTimer activate
-    m_Player->update();
+    m_Player->update(); //m_invisibleTimer activate
     m_Player->draw();
     m_Player->setDispersedlaser(); //no effect
     EXPECT_TRUE(m_Player->m_discard);
+    EXPECT_TRUE(m_timers->size() == 3);
 
     // INVISIBLE --> MOVE_IN
-    EXPECT_CALL((*m_raylibMock), getTime())
-        .WillOnce(Return(2))  //m_invisibleTimer timeout
-        .WillOnce(Return(2))  //m_warmupTimer activate
-        .WillOnce(Return(2)); //m_dispersedLaserTimer activate
-    EXPECT_CALL((*m_raylibMock), drawTextureV(A<Texture2D>(), A<Vector2>(), FieldsAre(80, 80, 80, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(80, 80, 80, 255)))
         .Times(Exactly(1));
-    m_Player->update();
+    m_timers->advance(1); //m_invisibleTimer timeout, m_warmupTimer activate
     m_Player->draw();
-    m_Player->setDispersedlaser();
+    m_Player->setDispersedlaser(); //m_dispersedLaserTimer activate
     EXPECT_TRUE(m_Player->m_discard);
 
     // MOVE_IN
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(0.1)); //moveIntoWindow() call
-    EXPECT_CALL((*m_raylibMock), drawTextureV(A<Texture2D>(), A<Vector2>(), FieldsAre(80, 80, 80, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(80, 80, 80, 255)))
         .Times(Exactly(1));
     m_Player->update();
     m_Player->draw();
@@ -155,7 +156,7 @@ TEST_F(PlayerTest, stateMachine)
 
     // MOVE_IN --> WARMUP
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1)); //moveIntoWindow() reach the start position
-    EXPECT_CALL((*m_raylibMock), drawTextureV(A<Texture2D>(), A<Vector2>(), FieldsAre(80, 80, 80, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(80, 80, 80, 255)))
         .Times(Exactly(1));
     m_Player->update();
     m_Player->draw();
@@ -168,15 +169,17 @@ TEST_F(PlayerTest, stateMachine)
     EXPECT_CALL((*m_raylibMock), isKeyDown(KEY_UP)).Times(Exactly(1));
     EXPECT_CALL((*m_raylibMock), isKeyPressed(KEY_SPACE)).WillOnce(Return(true));
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1)); //move() call
-    EXPECT_CALL((*m_raylibMock), getTime())
-        .WillOnce(Return(17)) //m_dispersedLaserTimer timeout
-        .WillOnce(Return(6)); //m_warmupTimer timeout
-    EXPECT_CALL((*m_raylibMock), drawTextureV(A<Texture2D>(), A<Vector2>(), FieldsAre(255, 255, 255, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(255, 255, 255, 255)))
         .Times(Exactly(1));
     m_Player->update();
+    EXPECT_EQ(m_lasers, 3);
+    m_timers->advance(4); //m_warmupTimer timeout
     m_Player->draw();
     EXPECT_FALSE(m_Player->m_discard);
 
+    // dispersed laser expiry
+    m_timers->advance(11); //m_dispersedLaserTimer timeout
+
     // PLAYABLE (single laser)
     EXPECT_CALL((*m_raylibMock), isKeyDown(KEY_RIGHT)).Times(Exactly(1));
     EXPECT_CALL((*m_raylibMock), isKeyDown(KEY_LEFT)).Times(Exactly(1));
@@ -184,11 +187,12 @@ TEST_F(PlayerTest, stateMachine)
     EXPECT_CALL((*m_raylibMock), isKeyDown(KEY_UP)).Times(Exactly(1));
     EXPECT_CALL((*m_raylibMock), isKeyPressed(KEY_SPACE)).WillOnce(Return(true));
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1)); //move() call
-    EXPECT_CALL((*m_raylibMock), drawTextureV(A<Texture2D>(), A<Vector2>(), FieldsAre(255, 255, 255, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(255, 255, 255, 255)))
         .Times(Exactly(1));
     m_Player->update();
     m_Player->draw();
     EXPECT_FALSE(m_Player->m_discard);
+    EXPECT_EQ(m_lasers, 4);
 }
 
 } // namespace PlayerTest
@@ -42,8 +42,8 @@ TEST_F(PowerupTest, updateWithoutTextures_death)
 
 TEST_F(PowerupTest, update)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Powerup->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Powerup->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1));
     m_Powerup->update();
@@ -56,10 +56,10 @@ TEST_F(PowerupTest, drawWithoutTextures_death)
 
 TEST_F(PowerupTest, draw)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Powerup->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Powerup->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
-    EXPECT_CALL((*m_raylibMock), drawTextureV(A<Texture2D>(), A<Vector2>(), FieldsAre(255, 255, 255, 255)))
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), A<Rectangle>(), A<Rectangle>(), FieldsAre(0, 0), 0, FieldsAre(255, 255, 255, 255)))
         .Times(Exactly(1));
     m_Powerup->draw();
 }
@@ -71,8 +71,8 @@ TEST_F(PowerupTest, getCenterWithoutTextures_death)
 
 TEST_F(PowerupTest, getCenter)
 {
-    Texture2D fakeTexture = {0, 4, 4, 0, 0};
-    m_Powerup->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    m_Powerup->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_THAT(m_Powerup->getCenter(), A<Vector2>());
 }
@@ -84,8 +84,8 @@ TEST_F(PowerupTest, getRadiusWithoutTextures_death)
 
 TEST_F(PowerupTest, getRadius)
 {
-    Texture2D fakeTexture = {0, 4, 15, 0, 0};
-    m_Powerup->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 15}};
+    m_Powerup->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_EQ(m_Powerup->getRadius(), 2);
 }
@@ -97,8 +97,8 @@ TEST_F(PowerupTest, getRect_death)
 
 TEST_F(PowerupTest, setTextures_death)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     EXPECT_DEATH(m_Powerup->setTextures(fakeTextures), "Assertion failed");
 }
 
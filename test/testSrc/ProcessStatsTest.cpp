@@ -0,0 +1,23 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "ProcessStats.h"
+#include <vector>
+
+namespace ProcessStatsTest
+{
+class ProcessStatsTest : public ::testing::Test
+{
+};
+
+TEST_F(ProcessStatsTest, peakGrowsWithTouchedMemory)
+{
+    uint64_t before = ProcessStats::peakResidentBytes();
+    EXPECT_GT(before, 0);
+
+    // filling the buffer makes all of it resident at once
+    std::vector<uint8_t> buffer((before + (64 << 20)), 1);
+
+    EXPECT_GE(ProcessStats::peakResidentBytes(), buffer.size());
+}
+
+} // namespace ProcessStatsTest
@@ -0,0 +1,131 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "Profiler.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ProfilerTest
+{
+class ProfilerTest : public ::testing::Test
+{
+public:
+    // the profiler is shared by the whole test binary, each test looks at the zones it named
+    static std::vector<Profiler::Event_t> eventsNamed(const std::string& name)
+    {
+        std::vector<Profiler::Event_t> events;
+        for (const Profiler::Event_t& event : Profiler::getInstance().getEvents())
+        {
+            if (name == event.m_name)
+            {
+                events.push_back(event);
+            }
+        }
+        return events;
+    }
+};
+
+TEST_F(ProfilerTest, nestedZones)
+{
+    {
+        Profiler::Zone outer("ProfilerTest::outer");
+        {
+            Profiler::Zone inner("ProfilerTest::inner");
+        }
+    }
+
+    std::vector<Profiler::Event_t> outer = eventsNamed("ProfilerTest::outer");
+    std::vector<Profiler::Event_t> inner = eventsNamed("ProfilerTest::inner");
+    ASSERT_EQ(outer.size(), 1);
+    ASSERT_EQ(inner.size(), 1);
+    EXPECT_EQ(outer[0].m_thread, inner[0].m_thread);
+    EXPECT_LE(outer[0].m_begin, inner[0].m_begin);
+    EXPECT_LE(inner[0].m_begin, inner[0].m_end);
+    EXPECT_LE(inner[0].m_end, outer[0].m_end);
+}
+
+TEST_F(ProfilerTest, ringPerThread)
+{
+    std::thread first([](void) { Profiler::Zone zone("ProfilerTest::thread"); });
+    first.join();
+    std::thread second([](void) { Profiler::Zone zone("ProfilerTest::thread"); });
+    second.join();
+
+    std::vector<Profiler::Event_t> events = eventsNamed("ProfilerTest::thread");
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0].m_thread, events[1].m_thread);
+}
+
+TEST_F(ProfilerTest, fullRingKeepsTheLatestZones)
+{
+    std::thread recorder([](void) {
+        for (uint64_t index = 0; index < (Profiler::RING_CAPACITY + 10); index++)
+        {
+            Profiler::getInstance().record("ProfilerTest::wrap", index, index + 1);
+        }
+    });
+    recorder.join();
+
+    std::vector<Profiler::Event_t> events = eventsNamed("ProfilerTest::wrap");
+    ASSERT_EQ(events.size(), Profiler::RING_CAPACITY);
+    EXPECT_EQ(events.front().m_begin, 10);
+    EXPECT_EQ(events.back().m_begin, Profiler::RING_CAPACITY + 9);
+}
+
+TEST_F(ProfilerTest, readWhileRecording)
+{
+    std::thread recorder([](void) {
+        for (uint64_t index = 0; index < (4 * Profiler::RING_CAPACITY); index++)
+        {
+            Profiler::getInstance().record("ProfilerTest::concurrent", index, index + 1);
+        }
+    });
+
+    // whatever is read is a zone as it was recorded
+    for (uint32_t read = 0; read < 20; read++)
+    {
+        for (const Profiler::Event_t& event : eventsNamed("ProfilerTest::concurrent"))
+        {
+            EXPECT_EQ(event.m_end, event.m_begin + 1);
+        }
+    }
+    recorder.join();
+}
+
+TEST_F(ProfilerTest, writeTrace)
+{
+    std::thread named([](void) {
+        Profiler::getInstance().setThreadName("ProfilerTest \"named\"");
+        Profiler::getInstance().record("ProfilerTest::trace", 1500, 4250);
+    });
+    named.join();
+
+    std::string fileName = "profilerTest.trace.json";
+    ASSERT_TRUE(Profiler::getInstance().writeTrace(fileName));
+
+    std::ifstream     file(fileName);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove(fileName.c_str());
+
+    std::string trace = contents.str();
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0);
+    EXPECT_NE(trace.find("\"args\":{\"name\":\"ProfilerTest \\\"named\\\"\"}"), std::string::npos);
+    EXPECT_NE(trace.find("{\"name\":\"ProfilerTest::trace\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ts\":1.500,\"dur\":2.750}"), std::string::npos);
+    EXPECT_EQ(trace.substr(trace.size() - 3), "]}\n");
+}
+
+#ifndef PROFILER_
+TEST_F(ProfilerTest, zonesCompiledOut)
+{
+    PROFILE_ZONE("ProfilerTest::compiledOut");
+    EXPECT_TRUE(eventsNamed("ProfilerTest::compiledOut").empty());
+}
+#endif
+
+} // namespace ProfilerTest
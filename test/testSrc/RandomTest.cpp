@@ -0,0 +1,120 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "Random.h"
+#include <memory>
+#include <vector>
+
+namespace RandomTest
+{
+class RandomTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<Random> m_Random = nullptr;
+
+    void SetUp(void)
+    {
+        m_Random = std::make_shared<Random>(42);
+        ASSERT_TRUE(m_Random != nullptr);
+    }
+};
+
+TEST_F(RandomTest, sameSeedSameSequence)
+{
+    Random other(42);
+    Random different(43);
+    bool   differs = false;
+
+    for (uint32_t index = 0; index < 1000; index++)
+    {
+        uint64_t value = m_Random->next();
+        EXPECT_EQ(value, other.next());
+        differs |= (value != different.next());
+    }
+    EXPECT_TRUE(differs);
+    EXPECT_EQ(m_Random->getSeed(), 42);
+}
+
+TEST_F(RandomTest, reseed)
+{
+    uint64_t first = m_Random->next();
+    m_Random->next();
+
+    m_Random->seed(42);
+    EXPECT_EQ(m_Random->next(), first);
+}
+
+TEST_F(RandomTest, uniformIntCoversTheRange)
+{
+    std::vector<uint32_t> histogram(11, 0);
+
+    for (uint32_t index = 0; index < 11000; index++)
+    {
+        int32_t value = m_Random->uniformInt(-5, 5);
+        ASSERT_GE(value, -5);
+        ASSERT_LE(value, 5);
+        histogram[value + 5]++;
+    }
+    for (uint32_t count : histogram)
+    {
+        EXPECT_GT(count, 800);
+        EXPECT_LT(count, 1200);
+    }
+    EXPECT_EQ(m_Random->uniformInt(3, 3), 3);
+}
+
+TEST_F(RandomTest, uniformFloatIsHalfOpen)
+{
+    float sum = 0;
+
+    for (uint32_t index = 0; index < 10000; index++)
+    {
+        float value = m_Random->uniformFloat(0.5, 1.6);
+        ASSERT_GE(value, 0.5);
+        ASSERT_LT(value, 1.6);
+        sum += value;
+    }
+    EXPECT_NEAR(sum / 10000, 1.05, 0.02);
+}
+
+TEST_F(RandomTest, fillMatchesSingleCalls)
+{
+    Random               single(42);
+    std::vector<int32_t> ints(100);
+    std::vector<float>   floats(100);
+
+    m_Random->fillInt(ints.data(), ints.size(), 0, 1600);
+    m_Random->fillFloat(floats.data(), floats.size(), -0.5, 0.5);
+
+    for (int32_t value : ints)
+    {
+        EXPECT_EQ(value, single.uniformInt(0, 1600));
+    }
+    for (float value : floats)
+    {
+        EXPECT_EQ(value, single.uniformFloat(-0.5, 0.5));
+    }
+}
+
+TEST_F(RandomTest, splitStreamsDoNotOverlap)
+{
+    Random reference(42);
+    Random child = m_Random->split();
+
+    std::vector<uint64_t> parentValues;
+    for (uint32_t index = 0; index < 1000; index++)
+    {
+        // the child carries on with the sequence of the seed
+        EXPECT_EQ(child.next(), reference.next());
+        parentValues.push_back(m_Random->next());
+    }
+
+    Random again(42);
+    again.split();
+    for (uint64_t value : parentValues)
+    {
+        EXPECT_EQ(again.next(), value);
+    }
+    EXPECT_NE(parentValues[0], Random(42).next());
+}
+
+} // namespace RandomTest
@@ -0,0 +1,308 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "RaylibHeadless.h"
+#include <functional>
+#include <memory>
+#include "Game.h"
+#include "GameSettings.h"
+#include "Player.h"
+#include "SpriteFactory.h"
+#include "TimerWheel.h"
+
+namespace RaylibHeadlessTest
+{
+class RaylibHeadlessTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<RaylibHeadless> m_raylibHeadless = nullptr;
+
+    void SetUp(void)
+    {
+        m_raylibHeadless = std::make_shared<RaylibHeadless>(0.25f);
+        ASSERT_TRUE(m_raylibHeadless != nullptr);
+    }
+
+    void TearDown(void)
+    {
+        m_raylibHeadless = nullptr;
+    }
+
+    void frame(void)
+    {
+        m_raylibHeadless->beginDrawing();
+        m_raylibHeadless->endDrawing();
+    }
+};
+
+TEST_F(RaylibHeadlessTest, virtualClock)
+{
+    m_raylibHeadless->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "headless");
+    EXPECT_EQ(m_raylibHeadless->getTime(), 0);
+    EXPECT_EQ(m_raylibHeadless->getFrameTime(), 0.25f);
+
+    frame();
+    frame();
+    EXPECT_EQ(m_raylibHeadless->getTime(), 0.5);
+    EXPECT_EQ(m_raylibHeadless->getCounters().m_frames, 2);
+}
+
+TEST_F(RaylibHeadlessTest, frameLimitAndCloseWindow)
+{
+    EXPECT_TRUE(m_raylibHeadless->windowShouldClose());
+
+    m_raylibHeadless->setFrameLimit(2);
+    m_raylibHeadless->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "headless");
+    EXPECT_TRUE(m_raylibHeadless->isWindowReady());
+    EXPECT_FALSE(m_raylibHeadless->windowShouldClose());
+    frame();
+    EXPECT_FALSE(m_raylibHeadless->windowShouldClose());
+    frame();
+    EXPECT_TRUE(m_raylibHeadless->windowShouldClose());
+
+    m_raylibHeadless->setFrameLimit(0);
+    EXPECT_FALSE(m_raylibHeadless->windowShouldClose());
+    m_raylibHeadless->closeWindow();
+    EXPECT_TRUE(m_raylibHeadless->windowShouldClose());
+}
+
+TEST_F(RaylibHeadlessTest, scriptedInput)
+{
+    m_raylibHeadless->scriptKeyDown(1, 2, KEY_LEFT);
+    m_raylibHeadless->scriptKeyPressed(2, KEY_SPACE);
+    m_raylibHeadless->scriptMouse(2, Vector2(10, 20), true);
+    m_raylibHeadless->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "headless");
+
+    EXPECT_FALSE(m_raylibHeadless->isKeyDown(KEY_LEFT));
+    EXPECT_FALSE(m_raylibHeadless->isKeyPressed(KEY_SPACE));
+
+    frame();
+    EXPECT_TRUE(m_raylibHeadless->isKeyDown(KEY_LEFT));
+    EXPECT_FALSE(m_raylibHeadless->isKeyPressed(KEY_SPACE));
+
+    frame();
+    EXPECT_TRUE(m_raylibHeadless->isKeyDown(KEY_LEFT));
+    EXPECT_TRUE(m_raylibHeadless->isKeyPressed(KEY_SPACE));
+    EXPECT_TRUE(m_raylibHeadless->isMouseButtonPressed(MOUSE_BUTTON_LEFT));
+    EXPECT_FALSE(m_raylibHeadless->isMouseButtonPressed(MOUSE_BUTTON_RIGHT));
+    EXPECT_EQ(m_raylibHeadless->getMousePosition().x, 10);
+    EXPECT_EQ(m_raylibHeadless->getMousePosition().y, 20);
+
+    frame();
+    EXPECT_FALSE(m_raylibHeadless->isKeyDown(KEY_LEFT));
+    EXPECT_FALSE(m_raylibHeadless->isKeyPressed(KEY_SPACE));
+    EXPECT_FALSE(m_raylibHeadless->isMouseButtonPressed(MOUSE_BUTTON_LEFT));
+    EXPECT_EQ(m_raylibHeadless->getMousePosition().x, 10);
+}
+
+TEST_F(RaylibHeadlessTest, resourcesSizedFromFiles)
+{
+    Texture2D laser = m_raylibHeadless->loadTexture("resources/images/laser.png");
+    EXPECT_NE(laser.id, 0);
+    EXPECT_EQ(laser.width, 9);
+    EXPECT_EQ(laser.height, 54);
+
+    Texture2D missing = m_raylibHeadless->loadTexture("resources/images/missing.png");
+    EXPECT_EQ(missing.id, 0);
+
+    Sound sound = m_raylibHeadless->loadSound("resources/audio/laser.wav");
+    EXPECT_EQ(sound.stream.sampleRate, 44100);
+    EXPECT_EQ(sound.stream.sampleSize, 16);
+    EXPECT_EQ(sound.stream.channels, 1);
+    EXPECT_EQ(sound.frameCount, 14399);
+}
+
+TEST_F(RaylibHeadlessTest, drawsAreCounted)
+{
+    Texture2D texture = {0, 0, 0, 0, 0};
+    Font      font    = m_raylibHeadless->loadFontEx("resources/font/Stormfaze.otf", 10, NULL, 0);
+
+    m_raylibHeadless->drawTextureV(texture, Vector2(0, 0), WHITE);
+    m_raylibHeadless->drawTextureEx(texture, Vector2(0, 0), 0, 1, WHITE);
+    m_raylibHeadless->drawTexturePro(texture, Rectangle(0, 0, 1, 1), Rectangle(0, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    m_raylibHeadless->drawTextEx(font, "text", Vector2(0, 0), 10, 0, WHITE);
+    m_raylibHeadless->drawRectangleRounded(Rectangle(0, 0, 1, 1), 0.2, 0, WHITE);
+    m_raylibHeadless->playSound(Sound());
+
+    RaylibHeadless::Counters_t counters = m_raylibHeadless->getCounters();
+    EXPECT_EQ(counters.m_textures, 3);
+    EXPECT_EQ(counters.m_texts, 1);
+    EXPECT_EQ(counters.m_shapes, 1);
+    EXPECT_EQ(counters.m_sounds, 1);
+
+    // the texture, the font, then raylib's default texture for the shape
+    EXPECT_EQ(counters.m_batches, 3);
+
+    Vector2 textSize = m_raylibHeadless->measureTextEx(font, "text", 10, 1);
+    EXPECT_EQ(textSize.x, 23);
+    EXPECT_EQ(textSize.y, 10);
+}
+
+TEST_F(RaylibHeadlessTest, gameLoopRunsHeadless)
+{
+    std::shared_ptr<SpriteFactory> factory = std::make_shared<SpriteFactory>(std::make_shared<Random>(7));
+    std::shared_ptr<TimerWheel>    timers  = std::make_shared<TimerWheel>();
+    m_raylibHeadless                       = std::make_shared<RaylibHeadless>(1.0f / 60);
+
+    // press Start, then shoot once the player has flown in
+    m_raylibHeadless->setFrameLimit(300);
+    m_raylibHeadless->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+    m_raylibHeadless->scriptKeyPressed(250, KEY_SPACE);
+
+    std::shared_ptr<Game> game = std::make_shared<Game>(m_raylibHeadless, factory, timers, std::make_shared<AssetLoader>(m_raylibHeadless, 0));
+
+    std::shared_ptr<Player> player = std::make_shared<Player>(m_raylibHeadless, timers, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+    game->setPlayer(player);
+    game->run();
+
+    RaylibHeadless::Counters_t counters = m_raylibHeadless->getCounters();
+    EXPECT_EQ(counters.m_frames, 300);
+    EXPECT_NEAR(m_raylibHeadless->getTime(), 5, 1e-4);
+    EXPECT_GE(counters.m_textures, 300 * NUMBER_OF_STARS);
+    EXPECT_GE(counters.m_sounds, 2);
+}
+
+TEST_F(RaylibHeadlessTest, retainedMenusDrawTheWelcomePageOnce)
+{
+    std::function<RaylibHeadless::Counters_t(Game::MENUS_t)> welcome = [](Game::MENUS_t menus) {
+        std::shared_ptr<SpriteFactory>  factory = std::make_shared<SpriteFactory>(std::make_shared<Random>(7));
+        std::shared_ptr<TimerWheel>     timers  = std::make_shared<TimerWheel>();
+        std::shared_ptr<RaylibHeadless> raylib  = std::make_shared<RaylibHeadless>(1.0f / 60);
+
+        // hover Start without clicking it
+        raylib->setFrameLimit(120);
+        raylib->scriptMouse(60, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), false);
+
+        std::shared_ptr<Game> game = std::make_shared<Game>(raylib, factory, timers, std::make_shared<AssetLoader>(raylib, 0));
+
+        std::shared_ptr<Player> player = std::make_shared<Player>(raylib, timers, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+        game->setPlayer(player);
+        game->setMenuRendering(menus);
+        game->run();
+        return raylib->getCounters();
+    };
+
+    RaylibHeadless::Counters_t immediate = welcome(Game::IMMEDIATE_MENUS);
+    RaylibHeadless::Counters_t retained  = welcome(Game::RETAINED_MENUS);
+    EXPECT_EQ(immediate.m_frames, 120);
+    EXPECT_EQ(retained.m_frames, 120);
+    EXPECT_EQ(immediate.m_texts, 120 * 4);
+    EXPECT_EQ(immediate.m_shapes, 120 * 3);
+
+    // the page once, then the hovered button again
+    EXPECT_EQ(retained.m_texts, 4 + 1);
+    EXPECT_EQ(retained.m_shapes, 3 + 1);
+    EXPECT_EQ(retained.m_textures, immediate.m_textures + 120);
+    EXPECT_LT(retained.m_batches, immediate.m_batches);
+}
+
+TEST_F(RaylibHeadlessTest, pooledVoicesCoalesceTheSounds)
+{
+    std::function<RaylibHeadless::Counters_t(Game::SOUNDS_t)> session = [](Game::SOUNDS_t sounds) {
+        std::shared_ptr<SpriteFactory>  factory = std::make_shared<SpriteFactory>(std::make_shared<Random>(7));
+        std::shared_ptr<TimerWheel>     timers  = std::make_shared<TimerWheel>();
+        std::shared_ptr<RaylibHeadless> raylib  = std::make_shared<RaylibHeadless>(1.0f / 60);
+
+        // click Start, then shoot every few frames into a crowded field
+        raylib->setFrameLimit(900);
+        raylib->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+        for (uint64_t frame = 120; frame < 900; frame += 4)
+        {
+            raylib->scriptKeyPressed(frame, KEY_SPACE);
+        }
+
+        std::shared_ptr<Game> game = std::make_shared<Game>(raylib, factory, timers, std::make_shared<AssetLoader>(raylib, 0));
+
+        std::shared_ptr<Player> player = std::make_shared<Player>(raylib, timers, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+        game->setPlayer(player);
+        game->setSpawnMultiplier(10);
+        game->setLives(Game::UNLIMITED_LIVES);
+        game->setSoundPlayback(sounds);
+        game->run();
+        return raylib->getCounters();
+    };
+
+    RaylibHeadless::Counters_t direct = session(Game::DIRECT_SOUNDS);
+    RaylibHeadless::Counters_t pooled = session(Game::POOLED_VOICES);
+    EXPECT_EQ(pooled.m_frames, direct.m_frames);
+    EXPECT_GT(pooled.m_sounds, 0);
+    EXPECT_LT(pooled.m_sounds, direct.m_sounds);
+}
+
+// Both layouts move the sprites with the same arithmetic, a seeded session
+// then draws and plays the same in either.
+TEST_F(RaylibHeadlessTest, packedSpritesPlayTheSameGame)
+{
+    std::function<RaylibHeadless::Counters_t(SpriteStore::LAYOUT_t, Game::Stats_t&)> session = [](SpriteStore::LAYOUT_t layout, Game::Stats_t& stats) {
+        std::shared_ptr<SpriteFactory>  factory = std::make_shared<SpriteFactory>(std::make_shared<Random>(7));
+        std::shared_ptr<TimerWheel>     timers  = std::make_shared<TimerWheel>();
+        std::shared_ptr<RaylibHeadless> raylib  = std::make_shared<RaylibHeadless>(1.0f / 60);
+
+        // click Start, then sweep left and right while shooting
+        raylib->setFrameLimit(1800);
+        raylib->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+        for (uint64_t frame = 2; frame < 1800; frame += 120)
+        {
+            raylib->scriptKeyDown(frame, frame + 59, KEY_RIGHT);
+            raylib->scriptKeyDown(frame + 60, frame + 119, KEY_LEFT);
+            for (uint64_t shot = frame; shot < (frame + 120); shot += 10)
+            {
+                raylib->scriptKeyPressed(shot, KEY_SPACE);
+            }
+        }
+
+        std::shared_ptr<Game> game = std::make_shared<Game>(raylib, factory, timers, std::make_shared<AssetLoader>(raylib, 0));
+
+        std::shared_ptr<Player> player = std::make_shared<Player>(raylib, timers, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+        game->setPlayer(player);
+        game->setSpawnMultiplier(5);
+        game->setLives(Game::UNLIMITED_LIVES);
+        game->setSpriteLayout(layout);
+        game->run();
+        stats = game->getStats();
+        return raylib->getCounters();
+    };
+
+    Game::Stats_t              objectStats;
+    Game::Stats_t              packedStats;
+    RaylibHeadless::Counters_t objects = session(SpriteStore::SPRITE_OBJECTS, objectStats);
+    RaylibHeadless::Counters_t packed  = session(SpriteStore::PACKED_ARRAYS, packedStats);
+    EXPECT_EQ(packed.m_frames, 1800);
+    EXPECT_EQ(packed.m_textures, objects.m_textures);
+    EXPECT_EQ(packed.m_shapes, objects.m_shapes);
+    EXPECT_EQ(packed.m_sounds, objects.m_sounds);
+    EXPECT_EQ(packed.m_batches, objects.m_batches);
+    EXPECT_EQ(packedStats.m_tickSprites, objectStats.m_tickSprites);
+    EXPECT_EQ(packedStats.m_culled, objectStats.m_culled);
+    EXPECT_GT(packedStats.m_peakSprites, (5 * NUMBER_OF_STARS));
+}
+
+TEST_F(RaylibHeadlessTest, spritesLeavingThePlayfieldAreCulled)
+{
+    std::shared_ptr<SpriteFactory> factory = std::make_shared<SpriteFactory>(std::make_shared<Random>(7));
+    std::shared_ptr<TimerWheel>    timers  = std::make_shared<TimerWheel>();
+    m_raylibHeadless                       = std::make_shared<RaylibHeadless>(1.0f / 60);
+
+    // click Start, then shoot now and then for two minutes
+    m_raylibHeadless->setFrameLimit(7200);
+    m_raylibHeadless->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+    for (uint64_t frame = 120; frame < 7200; frame += 30)
+    {
+        m_raylibHeadless->scriptKeyPressed(frame, KEY_SPACE);
+    }
+
+    std::shared_ptr<Game> game = std::make_shared<Game>(m_raylibHeadless, factory, timers, std::make_shared<AssetLoader>(m_raylibHeadless, 0));
+
+    std::shared_ptr<Player> player = std::make_shared<Player>(m_raylibHeadless, timers, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+    game->setPlayer(player);
+    game->setLives(Game::UNLIMITED_LIVES);
+    game->run();
+
+    // the diagonal opponent lasers leave by the sides and no longer pile up
+    Game::Stats_t stats = game->getStats();
+    EXPECT_EQ(m_raylibHeadless->getCounters().m_frames, 7200);
+    EXPECT_GT(stats.m_culled, 0);
+    EXPECT_LT(stats.m_live.m_opponentLasers, 30);
+    EXPECT_LT(stats.m_peakSprites, (1 + NUMBER_OF_STARS + 50));
+}
+
+} // namespace RaylibHeadlessTest
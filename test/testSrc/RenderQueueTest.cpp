@@ -0,0 +1,303 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "RenderQueue.h"
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include "Game.h"
+#include "GameSettings.h"
+#include "Player.h"
+#include "RaylibHeadless.h"
+#include "RaylibMock.h"
+#include "SpriteFactory.h"
+#include "TimerWheel.h"
+
+using ::testing::_;
+using ::testing::Field;
+using ::testing::FieldsAre;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Mock;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace RenderQueueTest
+{
+class RenderQueueTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<RaylibMock>  m_raylibMock  = nullptr;
+    std::shared_ptr<RenderQueue> m_renderQueue = nullptr;
+
+    void SetUp(void)
+    {
+        m_raylibMock = std::make_shared<RaylibMock>();
+        ASSERT_TRUE(m_raylibMock != nullptr);
+
+        m_renderQueue = std::make_shared<RenderQueue>(m_raylibMock);
+        ASSERT_TRUE(m_renderQueue != nullptr);
+    }
+
+    void TearDown(void)
+    {
+        Mock::VerifyAndClearExpectations(&m_raylibMock);
+    }
+
+    static Texture2D texture(unsigned int id)
+    {
+        return Texture2D(id, 64, 32, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    // the Game with its Player, drawing into render
+    static void runGame(std::shared_ptr<RaylibHeadless> raylib, std::shared_ptr<RaylibInterface> render)
+    {
+        std::shared_ptr<SpriteFactory> factory = std::make_shared<SpriteFactory>(std::make_shared<Random>(7));
+        std::shared_ptr<TimerWheel>    timers  = std::make_shared<TimerWheel>();
+
+        raylib->setFrameLimit(300);
+        raylib->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+        raylib->scriptKeyPressed(250, KEY_SPACE);
+
+        // the loader goes through render too, the render thread owns raylib if there is one
+        std::shared_ptr<Game> game = std::make_shared<Game>(render, factory, timers, std::make_shared<AssetLoader>(render, 0));
+
+        std::shared_ptr<Player> player = std::make_shared<Player>(render, timers, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+        game->setPlayer(player);
+        game->run();
+    }
+};
+
+TEST_F(RenderQueueTest, otherCallsAreForwarded)
+{
+    EXPECT_CALL((*m_raylibMock), getTime()).WillOnce(Return(1.5));
+    EXPECT_CALL((*m_raylibMock), isKeyDown(KEY_LEFT)).WillOnce(Return(true));
+    EXPECT_CALL((*m_raylibMock), playSound(_)).Times(1);
+
+    EXPECT_EQ(m_renderQueue->getTime(), 1.5);
+    EXPECT_TRUE(m_renderQueue->isKeyDown(KEY_LEFT));
+    m_renderQueue->playSound(Sound());
+}
+
+TEST_F(RenderQueueTest, drawsAreSubmittedAtEndDrawing)
+{
+    Font font    = Font();
+    font.texture = texture(9);
+
+    // nothing reaches raylib while the frame is recorded
+    EXPECT_CALL((*m_raylibMock), beginDrawing()).Times(0);
+    EXPECT_CALL((*m_raylibMock), clearBackground(_)).Times(0);
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(_, _, _, _, _, _)).Times(0);
+    EXPECT_CALL((*m_raylibMock), drawRectangleRounded(_, _, _, _)).Times(0);
+    EXPECT_CALL((*m_raylibMock), drawTextEx(_, _, _, _, _, _)).Times(0);
+    m_renderQueue->beginDrawing();
+    m_renderQueue->clearBackground(BLACK);
+    m_renderQueue->drawTexturePro(texture(2), Rectangle(0, 0, 1, 1), Rectangle(0, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    m_renderQueue->drawTexturePro(texture(1), Rectangle(0, 0, 1, 1), Rectangle(1, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    m_renderQueue->drawTexturePro(texture(2), Rectangle(0, 0, 1, 1), Rectangle(2, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    m_renderQueue->drawRectangleRounded(Rectangle(0, 0, 10, 10), 0.2, 4, RED);
+    m_renderQueue->drawTextEx(font, "text", Vector2(3, 4), 10, 1, WHITE);
+    m_renderQueue->drawTextureV(texture(1), Vector2(5, 6), WHITE);
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    // the first sprites are grouped by texture, the texts, shapes and the sprite after them keep their order
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_raylibMock), beginDrawing()).Times(1);
+        EXPECT_CALL((*m_raylibMock), clearBackground(_)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTexturePro(FieldsAre(1, _, _, _, _), _, FieldsAre(1, 0, 1, 1), _, 0, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTexturePro(FieldsAre(2, _, _, _, _), _, FieldsAre(0, 0, 1, 1), _, 0, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTexturePro(FieldsAre(2, _, _, _, _), _, FieldsAre(2, 0, 1, 1), _, 0, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawRectangleRounded(FieldsAre(0, 0, 10, 10), 0.2f, 4, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTextEx(_, "text", FieldsAre(3, 4), 10, 1, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTexturePro(FieldsAre(1, _, _, _, _), FieldsAre(0, 0, 64, 32), FieldsAre(5, 6, 64, 32), _, 0, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), endDrawing()).Times(1);
+    }
+    m_renderQueue->endDrawing();
+
+    RenderExecutor::Stats_t stats = m_renderQueue->getStats();
+    EXPECT_EQ(stats.m_commands, 7);
+    EXPECT_EQ(stats.m_batches, 5);
+
+    const RenderExecutor::Frame_t& frame = m_renderQueue->getLastFrame();
+    ASSERT_EQ(frame.m_commands.size(), 7);
+    EXPECT_EQ(frame.m_commands[0].m_type, RenderExecutor::CLEAR);
+    EXPECT_EQ(frame.m_commands[1].m_layer, 1);
+    EXPECT_EQ(frame.m_commands[3].m_layer, 1);
+    EXPECT_EQ(frame.m_commands[4].m_layer, 2);
+    EXPECT_EQ(frame.m_commands[5].m_layer, 2);
+    EXPECT_EQ(frame.m_commands[6].m_layer, 3);
+    ASSERT_EQ(frame.m_fonts.size(), 1);
+    EXPECT_EQ(frame.m_text, "text");
+
+    // the next frame starts empty
+    EXPECT_CALL((*m_raylibMock), beginDrawing()).Times(1);
+    EXPECT_CALL((*m_raylibMock), endDrawing()).Times(1);
+    m_renderQueue->beginDrawing();
+    m_renderQueue->endDrawing();
+    EXPECT_TRUE(m_renderQueue->getLastFrame().m_commands.empty());
+}
+
+TEST_F(RenderQueueTest, renderTexturesAreLayersOfTheirOwn)
+{
+    RenderTexture2D target = {5, texture(6), texture(7)};
+
+    m_renderQueue->beginDrawing();
+    m_renderQueue->beginTextureMode(target);
+    m_renderQueue->beginScissorMode(1, 2, 3, 4);
+    m_renderQueue->clearBackground(BLANK);
+    m_renderQueue->drawTexturePro(texture(2), Rectangle(0, 0, 1, 1), Rectangle(0, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    m_renderQueue->endScissorMode();
+    m_renderQueue->endTextureMode();
+    m_renderQueue->clearBackground(BLACK);
+    m_renderQueue->drawTexturePro(texture(2), Rectangle(0, 0, 1, 1), Rectangle(1, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    m_renderQueue->drawRenderTexture(target, Vector2(0, 0), WHITE);
+    m_renderQueue->drawTexturePro(texture(1), Rectangle(0, 0, 1, 1), Rectangle(2, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+
+    // the sprites are not sorted across the target changes, nor around the target drawn
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_raylibMock), beginDrawing()).Times(1);
+        EXPECT_CALL((*m_raylibMock), beginTextureMode(Field(&RenderTexture2D::id, 5))).Times(1);
+        EXPECT_CALL((*m_raylibMock), beginScissorMode(1, 2, 3, 4)).Times(1);
+        EXPECT_CALL((*m_raylibMock), clearBackground(_)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTexturePro(FieldsAre(2, _, _, _, _), _, FieldsAre(0, 0, 1, 1), _, 0, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), endScissorMode()).Times(1);
+        EXPECT_CALL((*m_raylibMock), endTextureMode()).Times(1);
+        EXPECT_CALL((*m_raylibMock), clearBackground(_)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTexturePro(FieldsAre(2, _, _, _, _), _, FieldsAre(1, 0, 1, 1), _, 0, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawRenderTexture(Field(&RenderTexture2D::id, 5), FieldsAre(0, 0), _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), drawTexturePro(FieldsAre(1, _, _, _, _), _, FieldsAre(2, 0, 1, 1), _, 0, _)).Times(1);
+        EXPECT_CALL((*m_raylibMock), endDrawing()).Times(1);
+    }
+    m_renderQueue->endDrawing();
+
+    // the texture 2 is bound again after the target changed, the target is drawn with its texture
+    RenderExecutor::Stats_t stats = m_renderQueue->getStats();
+    EXPECT_EQ(stats.m_commands, 10);
+    EXPECT_EQ(stats.m_batches, 4);
+
+    const RenderExecutor::Frame_t& frame = m_renderQueue->getLastFrame();
+    ASSERT_EQ(frame.m_commands.size(), 10);
+    ASSERT_EQ(frame.m_targets.size(), 1);
+    EXPECT_EQ(frame.m_commands[0].m_target, 0);
+    EXPECT_EQ(frame.m_commands[8].m_target, 0);
+    EXPECT_EQ(frame.m_commands[9].m_layer, 9);
+}
+
+TEST_F(RenderQueueTest, gameDrawsTheSameThroughTheQueue)
+{
+    std::shared_ptr<RaylibHeadless> direct = std::make_shared<RaylibHeadless>(1.0f / 60);
+    runGame(direct, direct);
+
+    std::shared_ptr<RaylibHeadless> queued = std::make_shared<RaylibHeadless>(1.0f / 60);
+    std::shared_ptr<RenderQueue>    render = std::make_shared<RenderQueue>(queued);
+    runGame(queued, render);
+
+    RaylibHeadless::Counters_t directCounters = direct->getCounters();
+    RaylibHeadless::Counters_t queuedCounters = queued->getCounters();
+    EXPECT_EQ(queuedCounters.m_frames, directCounters.m_frames);
+    EXPECT_EQ(queuedCounters.m_textures, directCounters.m_textures);
+    EXPECT_EQ(queuedCounters.m_texts, directCounters.m_texts);
+    EXPECT_EQ(queuedCounters.m_shapes, directCounters.m_shapes);
+    EXPECT_LE(queuedCounters.m_batches, directCounters.m_batches);
+
+    // the last frame is a playing page: the clear, then the stars first
+    const RenderExecutor::Frame_t& frame = render->getLastFrame();
+    ASSERT_GT(frame.m_commands.size(), NUMBER_OF_STARS);
+    EXPECT_EQ(frame.m_commands[0].m_type, RenderExecutor::CLEAR);
+    for (uint32_t index = 1; index <= NUMBER_OF_STARS; index++)
+    {
+        EXPECT_EQ(frame.m_commands[index].m_type, RenderExecutor::TEXTURE);
+    }
+    EXPECT_EQ(frame.m_commands.back().m_type, RenderExecutor::TEXT);
+}
+
+TEST_F(RenderQueueTest, renderThreadDrawsWhileTheNextFrameIsRecorded)
+{
+    std::shared_ptr<NiceMock<RaylibMock>> raylibMock  = std::make_shared<NiceMock<RaylibMock>>();
+    std::shared_ptr<RenderQueue>          renderQueue = std::make_shared<RenderQueue>(raylibMock);
+    renderQueue->setThreading(RenderQueue::RENDER_THREAD);
+
+    std::thread::id    renderThread;
+    std::promise<void> swapDone;
+    std::future<void>  swap = swapDone.get_future();
+    EXPECT_CALL((*raylibMock), initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "render")).WillOnce(Invoke([&](int, int, std::string) { renderThread = std::this_thread::get_id(); }));
+    EXPECT_CALL((*raylibMock), windowShouldClose()).WillRepeatedly(Return(false));
+    EXPECT_CALL((*raylibMock), drawTexturePro(_, _, _, _, _, _)).Times(2).WillRepeatedly(Invoke([&](Texture2D, Rectangle, Rectangle, Vector2, float, Color) { EXPECT_EQ(std::this_thread::get_id(), renderThread); }));
+    EXPECT_CALL((*raylibMock), endDrawing()).WillOnce(Invoke([&](void) { swap.wait(); })).WillRepeatedly(Return());
+
+    renderQueue->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "render");
+    EXPECT_NE(renderThread, std::this_thread::get_id());
+    EXPECT_FALSE(renderQueue->windowShouldClose());
+
+    // the first frame is held in the buffer swap, the second is recorded meanwhile
+    renderQueue->beginDrawing();
+    renderQueue->drawTexturePro(texture(1), Rectangle(0, 0, 1, 1), Rectangle(0, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    renderQueue->endDrawing();
+
+    renderQueue->beginDrawing();
+    renderQueue->drawTexturePro(texture(1), Rectangle(0, 0, 1, 1), Rectangle(0, 0, 1, 1), Vector2(0, 0), 0, WHITE);
+    swapDone.set_value();
+    renderQueue->endDrawing();
+
+    // the first frame is drawn once the second is taken
+    EXPECT_EQ(renderQueue->getLastFrame().m_commands.size(), 1);
+
+    renderQueue->flush();
+    EXPECT_EQ(renderQueue->getStats().m_commands, 1);
+    renderQueue = nullptr;
+    Mock::VerifyAndClearExpectations(raylibMock.get());
+}
+
+TEST_F(RenderQueueTest, audioCallsAreQueuedInOrderWithTheFrames)
+{
+    std::shared_ptr<NiceMock<RaylibMock>> raylibMock  = std::make_shared<NiceMock<RaylibMock>>();
+    std::shared_ptr<RenderQueue>          renderQueue = std::make_shared<RenderQueue>(raylibMock);
+    renderQueue->setThreading(RenderQueue::RENDER_THREAD);
+
+    std::thread::id renderThread;
+    Sound           sound = Sound();
+    Music           music = Music();
+    sound.frameCount      = 3;
+    music.frameCount      = 5;
+    EXPECT_CALL((*raylibMock), initWindow(_, _, _)).WillOnce(Invoke([&](int, int, std::string) { renderThread = std::this_thread::get_id(); }));
+    {
+        InSequence seq;
+        EXPECT_CALL((*raylibMock), updateMusicStream(Field(&Music::frameCount, 5))).WillOnce(Invoke([&](Music) { EXPECT_EQ(std::this_thread::get_id(), renderThread); }));
+        EXPECT_CALL((*raylibMock), setSoundVolume(Field(&Sound::frameCount, 3), 0.5f)).Times(1);
+        EXPECT_CALL((*raylibMock), playSound(Field(&Sound::frameCount, 3))).Times(1);
+        EXPECT_CALL((*raylibMock), endDrawing()).Times(1);
+        EXPECT_CALL((*raylibMock), playSound(Field(&Sound::frameCount, 3))).Times(1);
+    }
+
+    renderQueue->initWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "render");
+    renderQueue->beginDrawing();
+    renderQueue->updateMusicStream(music);
+    renderQueue->setSoundVolume(sound, 0.5f);
+    renderQueue->playSound(sound);
+    renderQueue->endDrawing();
+    renderQueue->playSound(sound);
+    renderQueue->flush();
+
+    renderQueue = nullptr;
+    Mock::VerifyAndClearExpectations(raylibMock.get());
+}
+
+TEST_F(RenderQueueTest, gameRunsWithARenderThread)
+{
+    std::shared_ptr<RaylibHeadless> queued = std::make_shared<RaylibHeadless>(1.0f / 60);
+    std::shared_ptr<RenderQueue>    render = std::make_shared<RenderQueue>(queued);
+    render->setThreading(RenderQueue::RENDER_THREAD);
+    runGame(queued, render);
+    render->flush();
+
+    // the window is seen closing one frame late
+    RaylibHeadless::Counters_t counters = queued->getCounters();
+    EXPECT_EQ(counters.m_frames, 301);
+    EXPECT_GE(counters.m_textures, 300 * NUMBER_OF_STARS);
+    EXPECT_GE(counters.m_sounds, 2);
+    EXPECT_GT(render->getLastFrame().m_commands.size(), NUMBER_OF_STARS);
+}
+
+} // namespace RenderQueueTest
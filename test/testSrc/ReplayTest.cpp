@@ -0,0 +1,180 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "Replay.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include "Game.h"
+#include "GameSettings.h"
+#include "InputRecorder.h"
+#include "Player.h"
+#include "RaylibHeadless.h"
+#include "SpriteFactory.h"
+#include "TimerWheel.h"
+
+namespace ReplayTest
+{
+class ReplayTest : public ::testing::Test
+{
+public:
+    std::string m_fileName = "replayTest.replay";
+
+    void TearDown(void)
+    {
+        std::remove(m_fileName.c_str());
+    }
+
+    // the Game with its Player, reading the input from input
+    static void runGame(std::shared_ptr<RaylibInterface> input, uint64_t seed)
+    {
+        std::shared_ptr<SpriteFactory> factory = std::make_shared<SpriteFactory>(std::make_shared<Random>(seed));
+        std::shared_ptr<TimerWheel>    timers  = std::make_shared<TimerWheel>();
+
+        std::shared_ptr<Game> game = std::make_shared<Game>(input, factory, timers, std::make_shared<AssetLoader>(input, 0));
+
+        std::shared_ptr<Player> player = std::make_shared<Player>(input, timers, std::bind(&Game::playerShootLaser, game, std::placeholders::_1));
+        game->setPlayer(player);
+        game->run();
+    }
+};
+
+TEST_F(ReplayTest, framesRoundTrip)
+{
+    std::vector<Replay::Frame_t> frames(4);
+    frames[0].m_frameTime     = 1.0f / 60;
+    frames[0].m_mousePosition = {533.5f, 450};
+    frames[0].m_mousePressed  = (1 << MOUSE_BUTTON_LEFT);
+
+    frames[1]                          = frames[0];
+    frames[1].m_mousePressed           = 0;
+    frames[1].m_keysDown[KEY_RIGHT]    = true;
+    frames[1].m_keysDown[KEY_UP]       = true;
+    frames[1].m_keysPressed[KEY_SPACE] = true;
+
+    frames[2]                          = frames[1];
+    frames[2].m_frameTime              = 0.0171f;
+    frames[2].m_keysDown[KEY_RIGHT]    = false;
+    frames[2].m_keysPressed[KEY_SPACE] = false;
+
+    frames[3] = frames[2];
+
+    {
+        Replay::Writer writer(m_fileName, 0x0123456789ABCDEF);
+        ASSERT_TRUE(writer.isOpen());
+        for (const Replay::Frame_t& frame : frames)
+        {
+            writer.write(frame);
+        }
+        EXPECT_EQ(writer.getFrameCount(), frames.size());
+    }
+
+    Replay::Reader reader(m_fileName);
+    ASSERT_TRUE(reader.isOpen());
+    EXPECT_EQ(reader.getSeed(), 0x0123456789ABCDEF);
+
+    Replay::Frame_t frame;
+    for (const Replay::Frame_t& expected : frames)
+    {
+        ASSERT_TRUE(reader.read(frame));
+        EXPECT_EQ(frame.m_frameTime, expected.m_frameTime);
+        EXPECT_EQ(frame.m_mousePosition.x, expected.m_mousePosition.x);
+        EXPECT_EQ(frame.m_mousePosition.y, expected.m_mousePosition.y);
+        EXPECT_EQ(frame.m_keysDown, expected.m_keysDown);
+        EXPECT_EQ(frame.m_keysPressed, expected.m_keysPressed);
+        EXPECT_EQ(frame.m_mousePressed, expected.m_mousePressed);
+    }
+    EXPECT_FALSE(reader.read(frame));
+}
+
+TEST_F(ReplayTest, idleFramesAreRunLengthEncoded)
+{
+    Replay::Frame_t held;
+    held.m_frameTime          = 1.0f / 60;
+    held.m_keysDown[KEY_LEFT] = true;
+
+    {
+        Replay::Writer writer(m_fileName, 1);
+        for (uint32_t index = 0; index < 10000; index++)
+        {
+            writer.write(held);
+        }
+    }
+
+    // the header, the first frame and a single run for the 9999 others
+    EXPECT_LT(std::filesystem::file_size(m_fileName), 32);
+
+    Replay::Reader  reader(m_fileName);
+    Replay::Frame_t frame;
+    uint32_t        count = 0;
+    while (reader.read(frame))
+    {
+        EXPECT_TRUE(frame.m_keysDown[KEY_LEFT]);
+        count++;
+    }
+    EXPECT_EQ(count, 10000);
+}
+
+TEST_F(ReplayTest, corruptFrameEndsTheSession)
+{
+    {
+        Replay::Writer  writer(m_fileName, 1);
+        Replay::Frame_t frame;
+        frame.m_frameTime = 1.0f / 60;
+        writer.write(frame);
+    }
+    std::ofstream file(m_fileName, std::ios::binary | std::ios::app);
+    file.put((char)0xE0);
+    file.close();
+
+    Replay::Reader  reader(m_fileName);
+    Replay::Frame_t frame;
+    EXPECT_TRUE(reader.read(frame));
+    EXPECT_FALSE(reader.read(frame));
+
+    Replay::Reader missing("missing.replay");
+    EXPECT_FALSE(missing.isOpen());
+    EXPECT_FALSE(missing.read(frame));
+}
+
+TEST_F(ReplayTest, recordedSessionPlaysBackTheSame)
+{
+    // click Start, then sweep left and right while shooting
+    std::shared_ptr<RaylibHeadless> recorded = std::make_shared<RaylibHeadless>(1.0f / 60);
+    recorded->setFrameLimit(600);
+    recorded->scriptMouse(1, Vector2((WINDOW_WIDTH / 3), (WINDOW_HEIGHT / 2)), true);
+    for (uint64_t frame = 2; frame < 600; frame += 120)
+    {
+        recorded->scriptKeyDown(frame, frame + 59, KEY_RIGHT);
+        recorded->scriptKeyDown(frame + 60, frame + 119, KEY_LEFT);
+        for (uint64_t shot = frame; shot < (frame + 120); shot += 10)
+        {
+            recorded->scriptKeyPressed(shot, KEY_SPACE);
+        }
+    }
+    std::shared_ptr<InputRecorder> recorder = std::make_shared<InputRecorder>(recorded, m_fileName, 11);
+    ASSERT_TRUE(recorder->isRecording());
+    runGame(recorder, 11);
+    recorder->stop();
+
+    // another frame time, the replay has the recorded one
+    std::shared_ptr<Replay::Reader> replay   = std::make_shared<Replay::Reader>(m_fileName);
+    std::shared_ptr<RaylibHeadless> playback = std::make_shared<RaylibHeadless>(1.0f / 30);
+    ASSERT_TRUE(replay->isOpen());
+    playback->setReplay(replay);
+    runGame(playback, replay->getSeed());
+
+    RaylibHeadless::Counters_t recordedCounters = recorded->getCounters();
+    RaylibHeadless::Counters_t playbackCounters = playback->getCounters();
+    EXPECT_EQ(playbackCounters.m_frames, 600);
+    EXPECT_EQ(playbackCounters.m_frames, recordedCounters.m_frames);
+    EXPECT_EQ(playbackCounters.m_textures, recordedCounters.m_textures);
+    EXPECT_EQ(playbackCounters.m_texts, recordedCounters.m_texts);
+    EXPECT_EQ(playbackCounters.m_shapes, recordedCounters.m_shapes);
+    EXPECT_EQ(playbackCounters.m_sounds, recordedCounters.m_sounds);
+    EXPECT_EQ(playbackCounters.m_batches, recordedCounters.m_batches);
+    EXPECT_GT(recordedCounters.m_sounds, 0);
+}
+
+} // namespace ReplayTest
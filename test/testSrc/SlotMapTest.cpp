@@ -0,0 +1,118 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "SlotMap.h"
+#include <memory>
+
+using ::testing::ElementsAre;
+
+namespace SlotMapTest
+{
+class SlotMapTest : public ::testing::Test
+{
+public:
+    SlotMap<uint32_t> m_SlotMap;
+
+    std::vector<uint32_t> values(void)
+    {
+        std::vector<uint32_t> ret;
+        for (uint32_t index = 0; index < m_SlotMap.size(); index++)
+        {
+            ret.push_back(m_SlotMap[index]);
+        }
+        return ret;
+    }
+};
+
+TEST_F(SlotMapTest, insertAndGet)
+{
+    SlotMap<uint32_t>::Handle_t first  = m_SlotMap.insert(10);
+    SlotMap<uint32_t>::Handle_t second = m_SlotMap.insert(20);
+
+    EXPECT_EQ(m_SlotMap.size(), 2);
+    EXPECT_TRUE(m_SlotMap.contains(first));
+    EXPECT_TRUE(m_SlotMap.contains(second));
+    EXPECT_EQ(m_SlotMap.get(first), 10);
+    EXPECT_EQ(m_SlotMap.get(second), 20);
+    EXPECT_FALSE(m_SlotMap.contains(SlotMap<uint32_t>::Handle_t()));
+}
+
+TEST_F(SlotMapTest, nextHandleMatchesInsert)
+{
+    SlotMap<uint32_t>::Handle_t expected = m_SlotMap.nextHandle();
+    EXPECT_EQ(m_SlotMap.insert(1), expected);
+
+    m_SlotMap.erase(expected);
+    expected = m_SlotMap.nextHandle();
+    EXPECT_EQ(m_SlotMap.insert(2), expected);
+}
+
+TEST_F(SlotMapTest, eraseIsSwapRemove)
+{
+    SlotMap<uint32_t>::Handle_t first = m_SlotMap.insert(1);
+    m_SlotMap.insert(2);
+    SlotMap<uint32_t>::Handle_t third = m_SlotMap.insert(3);
+
+    m_SlotMap.erase(first);
+
+    EXPECT_FALSE(m_SlotMap.contains(first));
+    EXPECT_THAT(values(), ElementsAre(3, 2));
+    EXPECT_EQ(m_SlotMap.get(third), 3);
+    EXPECT_EQ(m_SlotMap.handleAt(0), third);
+    EXPECT_EQ(m_SlotMap.indexOf(third), 0);
+}
+
+TEST_F(SlotMapTest, staleHandleAfterSlotReuse)
+{
+    SlotMap<uint32_t>::Handle_t stale = m_SlotMap.insert(1);
+    m_SlotMap.erase(stale);
+
+    SlotMap<uint32_t>::Handle_t reused = m_SlotMap.insert(2);
+
+    EXPECT_EQ(reused.m_index, stale.m_index);
+    EXPECT_NE(reused.m_generation, stale.m_generation);
+    EXPECT_FALSE(m_SlotMap.contains(stale));
+    EXPECT_TRUE(m_SlotMap.contains(reused));
+}
+
+TEST_F(SlotMapTest, eraseIfKeepsOrder)
+{
+    std::vector<SlotMap<uint32_t>::Handle_t> handles;
+    for (uint32_t value = 0; value < 8; value++)
+    {
+        handles.push_back(m_SlotMap.insert(value));
+    }
+
+    EXPECT_EQ(m_SlotMap.eraseIf([](uint32_t value) { return ((value % 3) == 0); }), 3);
+    EXPECT_THAT(values(), ElementsAre(1, 2, 4, 5, 7));
+
+    for (uint32_t value = 0; value < 8; value++)
+    {
+        EXPECT_EQ(m_SlotMap.contains(handles[value]), ((value % 3) != 0));
+        if ((value % 3) != 0)
+        {
+            EXPECT_EQ(m_SlotMap.get(handles[value]), value);
+        }
+    }
+}
+
+TEST_F(SlotMapTest, clearInvalidatesAllHandles)
+{
+    SlotMap<uint32_t>::Handle_t first  = m_SlotMap.insert(1);
+    SlotMap<uint32_t>::Handle_t second = m_SlotMap.insert(2);
+
+    m_SlotMap.clear();
+
+    EXPECT_TRUE(m_SlotMap.empty());
+    EXPECT_FALSE(m_SlotMap.contains(first));
+    EXPECT_FALSE(m_SlotMap.contains(second));
+}
+
+TEST_F(SlotMapTest, getStaleHandle_death)
+{
+    SlotMap<uint32_t>::Handle_t stale = m_SlotMap.insert(1);
+    m_SlotMap.erase(stale);
+
+    EXPECT_DEATH(m_SlotMap.get(stale), "Assertion failed");
+}
+
+} // namespace SlotMapTest
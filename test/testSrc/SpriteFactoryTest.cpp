@@ -0,0 +1,218 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "SpriteFactory.h"
+#include <memory>
+#include "GameSettings.h"
+#include "RaylibMock.h"
+
+using ::testing::Mock;
+using ::testing::Return;
+
+namespace SpriteFactoryTest
+{
+class SpriteFactoryTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<SpriteFactory> m_SpriteFactory = nullptr;
+    std::shared_ptr<RaylibMock>    m_raylibMock    = nullptr;
+    uint32_t                       m_shotsFired    = 0;
+
+    void shootLaser(Sprite::SpriteAttr_t attr)
+    {
+        m_shotsFired++;
+    }
+
+    void SetUp(void)
+    {
+        m_raylibMock = std::make_shared<RaylibMock>();
+        ASSERT_TRUE(m_raylibMock != nullptr);
+
+        EXPECT_CALL((*m_raylibMock), isWindowReady()).WillRepeatedly(Return(true));
+
+        m_SpriteFactory = std::make_shared<SpriteFactory>(std::make_shared<Random>(1));
+        ASSERT_TRUE(m_SpriteFactory != nullptr);
+    }
+
+    void TearDown(void)
+    {
+        Mock::VerifyAndClearExpectations(&m_raylibMock);
+    }
+};
+
+TEST_F(SpriteFactoryTest, recycledSpriteIsReused)
+{
+    Sprite::SpriteAttr_t    attr;
+    std::shared_ptr<Sprite> first = m_SpriteFactory->getSprite(SpriteFactory::RED_LASER, m_raylibMock, attr);
+    first->m_discard              = true;
+    m_SpriteFactory->recycleSprite(SpriteFactory::RED_LASER, first);
+
+    std::shared_ptr<Sprite> second = m_SpriteFactory->getSprite(SpriteFactory::RED_LASER, m_raylibMock, attr);
+    EXPECT_EQ(first, second);
+    EXPECT_FALSE(second->m_discard);
+
+    SpriteFactory::PoolStats_t stats = m_SpriteFactory->getPoolStats(SpriteFactory::RED_LASER);
+    EXPECT_EQ(stats.m_allocations, 1);
+    EXPECT_EQ(stats.m_reuses, 1);
+    EXPECT_EQ(stats.m_live, 1);
+    EXPECT_EQ(stats.m_idle, 0);
+}
+
+TEST_F(SpriteFactoryTest, poolsArePerType)
+{
+    Sprite::SpriteAttr_t    attr;
+    std::shared_ptr<Sprite> laser = m_SpriteFactory->getSprite(SpriteFactory::RED_LASER, m_raylibMock, attr);
+    m_SpriteFactory->recycleSprite(SpriteFactory::RED_LASER, laser);
+
+    std::shared_ptr<Sprite> other = m_SpriteFactory->getSprite(SpriteFactory::YELLOW_LASER, m_raylibMock, attr);
+    EXPECT_NE(laser, other);
+    EXPECT_EQ(m_SpriteFactory->getPoolStats(SpriteFactory::RED_LASER).m_idle, 1);
+    EXPECT_EQ(m_SpriteFactory->getPoolStats(SpriteFactory::YELLOW_LASER).m_allocations, 1);
+}
+
+TEST_F(SpriteFactoryTest, highWaterMark)
+{
+    Sprite::SpriteAttr_t                 attr;
+    std::vector<std::shared_ptr<Sprite>> meteors;
+    for (uint32_t index = 0; index < 5; index++)
+    {
+        meteors.push_back(m_SpriteFactory->getSprite(SpriteFactory::METEOR, m_raylibMock, attr));
+    }
+    for (uint32_t index = 0; index < 3; index++)
+    {
+        m_SpriteFactory->recycleSprite(SpriteFactory::METEOR, meteors[index]);
+    }
+    for (uint32_t index = 0; index < 2; index++)
+    {
+        m_SpriteFactory->getSprite(SpriteFactory::METEOR, m_raylibMock, attr);
+    }
+
+    SpriteFactory::PoolStats_t stats = m_SpriteFactory->getPoolStats(SpriteFactory::METEOR);
+    EXPECT_EQ(stats.m_highWaterMark, 5);
+    EXPECT_EQ(stats.m_live, 4);
+    EXPECT_EQ(stats.m_idle, 1);
+    EXPECT_EQ(stats.m_allocations, 5);
+    EXPECT_EQ(stats.m_reuses, 2);
+}
+
+TEST_F(SpriteFactoryTest, capacityLimitsIdleSprites)
+{
+    Sprite::SpriteAttr_t attr;
+    m_SpriteFactory->setPoolCapacity(SpriteFactory::STAR, 1);
+
+    std::shared_ptr<Sprite> first  = m_SpriteFactory->getSprite(SpriteFactory::STAR, m_raylibMock, attr);
+    std::shared_ptr<Sprite> second = m_SpriteFactory->getSprite(SpriteFactory::STAR, m_raylibMock, attr);
+    m_SpriteFactory->recycleSprite(SpriteFactory::STAR, first);
+    m_SpriteFactory->recycleSprite(SpriteFactory::STAR, second);
+
+    SpriteFactory::PoolStats_t stats = m_SpriteFactory->getPoolStats(SpriteFactory::STAR);
+    EXPECT_EQ(stats.m_capacity, 1);
+    EXPECT_EQ(stats.m_idle, 1);
+    EXPECT_EQ(stats.m_live, 0);
+
+    m_SpriteFactory->setPoolCapacity(SpriteFactory::STAR, 0);
+    EXPECT_EQ(m_SpriteFactory->getPoolStats(SpriteFactory::STAR).m_idle, 0);
+}
+
+TEST_F(SpriteFactoryTest, churnAboveTheInitialCapacityDoesNotAllocate)
+{
+    Sprite::SpriteAttr_t                 attr;
+    std::vector<std::shared_ptr<Sprite>> explosions;
+    uint32_t                             burst = SPRITE_POOL_CAPACITY + 100;
+
+    for (uint32_t round = 0; round < 3; round++)
+    {
+        for (uint32_t index = 0; index < burst; index++)
+        {
+            explosions.push_back(m_SpriteFactory->getSprite(SpriteFactory::EXPLOSION, m_raylibMock, attr));
+        }
+        for (std::shared_ptr<Sprite>& explosion : explosions)
+        {
+            m_SpriteFactory->recycleSprite(SpriteFactory::EXPLOSION, explosion);
+        }
+        explosions.clear();
+    }
+
+    // the first burst allocates, the pool keeps all of it for the next ones
+    SpriteFactory::PoolStats_t stats = m_SpriteFactory->getPoolStats(SpriteFactory::EXPLOSION);
+    EXPECT_EQ(stats.m_allocations, burst);
+    EXPECT_EQ(stats.m_reuses, 2 * burst);
+    EXPECT_EQ(stats.m_capacity, burst);
+    EXPECT_EQ(stats.m_idle, burst);
+}
+
+TEST_F(SpriteFactoryTest, recycledOpponentShootsThroughNewCallback)
+{
+    Sprite::SpriteAttr_t                      attr;
+    std::function<void(Sprite::SpriteAttr_t)> f_shootLaser = std::bind(&SpriteFactoryTest::shootLaser, this, std::placeholders::_1);
+    std::shared_ptr<Sprite>                   opponent     = m_SpriteFactory->getSprite(SpriteFactory::OPPONENT,
+                                                                                        m_raylibMock,
+                                                                                        attr,
+                                                                                        [](Sprite::SpriteAttr_t) { FAIL(); });
+    m_SpriteFactory->recycleSprite(SpriteFactory::OPPONENT, opponent);
+
+    opponent              = m_SpriteFactory->getSprite(SpriteFactory::OPPONENT, m_raylibMock, attr, f_shootLaser);
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+    opponent->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
+
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).WillRepeatedly(Return(0));
+    for (uint32_t index = 0; index < 3000; index++)
+    {
+        opponent->update();
+    }
+    EXPECT_EQ(m_shotsFired, 3);
+}
+
+TEST_F(SpriteFactoryTest, sameSeedSameSpawns)
+{
+    SpriteFactory         other(std::make_shared<Random>(1));
+    Sprite::SpriteAttr_t  attr;
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 4, 4}};
+
+    // more meteors than a spawn batch, with reuses in between
+    for (uint32_t index = 0; index < 100; index++)
+    {
+        std::shared_ptr<Sprite> first  = m_SpriteFactory->getSprite(SpriteFactory::METEOR, m_raylibMock, attr);
+        std::shared_ptr<Sprite> second = other.getSprite(SpriteFactory::METEOR, m_raylibMock, attr);
+        first->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
+        second->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
+
+        Vector2 center = first->getCenter();
+        EXPECT_EQ(center.x, second->getCenter().x);
+        EXPECT_EQ(center.y, second->getCenter().y);
+        EXPECT_GE(center.x, 0);
+        EXPECT_LE(center.x, WINDOW_WIDTH);
+        EXPECT_GE(center.y, -150);
+        EXPECT_LE(center.y, -50);
+
+        if ((index % 3) == 0)
+        {
+            m_SpriteFactory->recycleSprite(SpriteFactory::METEOR, first);
+            other.recycleSprite(SpriteFactory::METEOR, second);
+        }
+    }
+}
+
+TEST_F(SpriteFactoryTest, fillSpawnAttributes)
+{
+    std::vector<Sprite::SpriteAttr_t> stars(200);
+    m_SpriteFactory->fillSpawnAttributes(SpriteFactory::STAR, stars.data(), stars.size());
+
+    for (const Sprite::SpriteAttr_t& star : stars)
+    {
+        EXPECT_GE(star.m_position.x, 0);
+        EXPECT_LE(star.m_position.x, WINDOW_WIDTH);
+        EXPECT_GE(star.m_position.y, 0);
+        EXPECT_LE(star.m_position.y, WINDOW_HEIGHT);
+        EXPECT_GE(star.m_scale, 0.5);
+        EXPECT_LT(star.m_scale, 1.6);
+    }
+    EXPECT_NE(stars[0].m_position.x, stars[1].m_position.x);
+}
+
+TEST_F(SpriteFactoryTest, getUndefined_death)
+{
+    Sprite::SpriteAttr_t attr;
+    EXPECT_DEATH(m_SpriteFactory->getSprite(SpriteFactory::UNDEFINED, m_raylibMock, attr), "Assertion failed");
+}
+
+} // namespace SpriteFactoryTest
@@ -0,0 +1,431 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "SpriteStore.h"
+#include <memory>
+#include "GameSettings.h"
+#include "Laser.h"
+#include "Meteor.h"
+#include "Opponent.h"
+#include "Powerup.h"
+#include "RaylibMock.h"
+#include "SpriteMock.h"
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::FieldsAre;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::Sequence;
+
+namespace SpriteStoreTest
+{
+class SpriteStoreTest : public ::testing::Test
+{
+public:
+    std::vector<std::shared_ptr<NiceMock<SpriteMock>>> m_spriteMocks;
+    std::shared_ptr<NiceMock<RaylibMock>>              m_raylibMock = std::make_shared<NiceMock<RaylibMock>>();
+    TextureAtlas::Frame_t                              m_frames[3]  = {{{1, 0, 0, 0, 0}, {0, 0, 10, 20}},
+                                                                       {{1, 0, 0, 0, 0}, {10, 0, 10, 20}},
+                                                                       {{1, 0, 0, 0, 0}, {20, 0, 10, 20}}};
+
+    void SetUp(void)
+    {
+        for (uint32_t index = 0; index < 3; index++)
+        {
+            m_spriteMocks.push_back(std::make_shared<NiceMock<SpriteMock>>());
+            ASSERT_TRUE(m_spriteMocks[index] != nullptr);
+        }
+    }
+
+    void TearDown(void)
+    {
+        m_spriteMocks.clear();
+    }
+
+    // a body moving along direction at speed, drawn with the first frame
+    Sprite::Body_t body(Vector2 position, Vector2 direction, float speed)
+    {
+        Sprite::Body_t body;
+        body.m_frames    = TextureAtlas::Frames_t(m_frames, 1);
+        body.m_position  = position;
+        body.m_direction = direction;
+        body.m_speed     = speed;
+        body.m_size      = Vector2(10, 20);
+        return body;
+    }
+};
+
+TEST_F(SpriteStoreTest, updateAndDrawInInsertionOrder)
+{
+    SpriteStore store(SpriteStore::NO_SHAPE);
+    Sequence    seq;
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        store.add(m_spriteMocks[index]);
+    }
+    EXPECT_EQ(store.size(), 3);
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        EXPECT_CALL((*m_spriteMocks[index]), update()).InSequence(seq);
+    }
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        EXPECT_CALL((*m_spriteMocks[index]), draw()).InSequence(seq);
+    }
+
+    store.update();
+    store.draw();
+}
+
+TEST_F(SpriteStoreTest, syncCircles)
+{
+    SpriteStore store(SpriteStore::CIRCLE);
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        EXPECT_CALL((*m_spriteMocks[index]), getCenter()).WillOnce(Return(Vector2(index, (index * 2))));
+        EXPECT_CALL((*m_spriteMocks[index]), getRadius()).WillOnce(Return(index + 10));
+        EXPECT_CALL((*m_spriteMocks[index]), getRect()).Times(0);
+        store.add(m_spriteMocks[index]);
+    }
+
+    store.sync();
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        EXPECT_THAT(store.getCenter(index), FieldsAre(index, (index * 2)));
+        EXPECT_EQ(store.getRadius(index), (index + 10));
+        EXPECT_FALSE(store.isDiscarded(index));
+    }
+}
+
+TEST_F(SpriteStoreTest, syncRectangles)
+{
+    SpriteStore store(SpriteStore::RECTANGLE);
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        EXPECT_CALL((*m_spriteMocks[index]), getRect()).WillOnce(Return(Rectangle(index, 1, 2, 3)));
+        EXPECT_CALL((*m_spriteMocks[index]), getCenter()).Times(0);
+        EXPECT_CALL((*m_spriteMocks[index]), getRadius()).Times(0);
+        store.add(m_spriteMocks[index]);
+    }
+
+    store.sync();
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        EXPECT_THAT(store.getRect(index), FieldsAre(index, 1, 2, 3));
+    }
+}
+
+TEST_F(SpriteStoreTest, getCenterOfRectangles_death)
+{
+    SpriteStore store(SpriteStore::RECTANGLE);
+    store.add(m_spriteMocks[0]);
+    store.sync();
+
+    EXPECT_DEATH(store.getCenter(0), "Assertion failed");
+}
+
+TEST_F(SpriteStoreTest, getRectBeforeSync_death)
+{
+    SpriteStore store(SpriteStore::RECTANGLE);
+    store.add(m_spriteMocks[0]);
+
+    EXPECT_DEATH(store.getRect(0), "Assertion failed");
+}
+
+TEST_F(SpriteStoreTest, discardAndDiscardMarked)
+{
+    SpriteStore store(SpriteStore::CIRCLE);
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        store.add(m_spriteMocks[index]);
+    }
+
+    m_spriteMocks[2]->m_discard = true;
+    store.sync();
+    EXPECT_FALSE(store.isDiscarded(0));
+    EXPECT_FALSE(store.isDiscarded(1));
+    EXPECT_TRUE(store.isDiscarded(2));
+
+    store.discard(0);
+    EXPECT_TRUE(store.isDiscarded(0));
+    EXPECT_FALSE(store.isCulled(0));
+    EXPECT_TRUE(m_spriteMocks[0]->m_discard);
+
+    store.discardMarked();
+    EXPECT_EQ(store.size(), 1);
+    EXPECT_EQ(store.getSprite(0), m_spriteMocks[1]);
+}
+
+TEST_F(SpriteStoreTest, cullSpritesOutsideTheBounds)
+{
+    SpriteStore store(SpriteStore::RECTANGLE);
+
+    EXPECT_CALL((*m_spriteMocks[0]), getRect()).WillOnce(Return(Rectangle(10, 10, 20, 20)));
+    EXPECT_CALL((*m_spriteMocks[1]), getRect()).WillOnce(Return(Rectangle(-15, 50, 20, 20)));
+    EXPECT_CALL((*m_spriteMocks[2]), getRect()).WillOnce(Return(Rectangle(50, 130, 20, 20)));
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        store.add(m_spriteMocks[index]);
+    }
+
+    // the second one straddles the edge, the third one is wholly below
+    store.sync();
+    EXPECT_EQ(store.cull(Rectangle(0, 0, 100, 100)), 1);
+    EXPECT_FALSE(store.isDiscarded(0));
+    EXPECT_FALSE(store.isDiscarded(1));
+    EXPECT_TRUE(store.isDiscarded(2));
+    EXPECT_TRUE(store.isCulled(2));
+    EXPECT_TRUE(m_spriteMocks[2]->m_discard);
+
+    // already discarded sprites are not counted again
+    EXPECT_EQ(store.cull(Rectangle(0, 0, 100, 100)), 0);
+    EXPECT_EQ(store.cull(Rectangle(40, 0, 60, 100)), 2);
+    EXPECT_TRUE(store.isDiscarded(0));
+    EXPECT_TRUE(store.isDiscarded(1));
+    EXPECT_TRUE(store.isCulled(1));
+}
+
+TEST_F(SpriteStoreTest, discardedSpritesAreRecycled)
+{
+    SpriteStore                          store(SpriteStore::NO_SHAPE);
+    std::vector<std::shared_ptr<Sprite>> recycled;
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        store.add(m_spriteMocks[index]);
+    }
+
+    m_spriteMocks[1]->m_discard = true;
+    store.discardMarked([&recycled](std::shared_ptr<Sprite> sprite) { recycled.push_back(sprite); });
+    ASSERT_EQ(recycled.size(), 1);
+    EXPECT_EQ(recycled[0], m_spriteMocks[1]);
+
+    store.clear([&recycled](std::shared_ptr<Sprite> sprite) { recycled.push_back(sprite); });
+    ASSERT_EQ(recycled.size(), 3);
+    EXPECT_EQ(recycled[1], m_spriteMocks[0]);
+    EXPECT_EQ(recycled[2], m_spriteMocks[2]);
+}
+
+TEST_F(SpriteStoreTest, handlesGoStaleWhenSpriteIsDiscarded)
+{
+    SpriteStore           store(SpriteStore::NO_SHAPE);
+    SpriteStore::Handle_t expected = store.nextHandle();
+    SpriteStore::Handle_t first    = store.add(m_spriteMocks[0]);
+    SpriteStore::Handle_t second   = store.add(m_spriteMocks[1]);
+
+    EXPECT_EQ(first, expected);
+    EXPECT_TRUE(store.contains(first));
+    EXPECT_TRUE(store.contains(second));
+
+    m_spriteMocks[0]->m_discard = true;
+    store.discardMarked();
+
+    EXPECT_FALSE(store.contains(first));
+    EXPECT_TRUE(store.contains(second));
+    EXPECT_EQ(store.getHandle(0), second);
+
+    store.remove(second);
+    EXPECT_FALSE(store.contains(second));
+    EXPECT_EQ(store.size(), 0);
+}
+
+TEST_F(SpriteStoreTest, clear)
+{
+    SpriteStore store(SpriteStore::NO_SHAPE);
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        store.add(m_spriteMocks[index]);
+    }
+
+    store.clear();
+    EXPECT_EQ(store.size(), 0);
+
+    EXPECT_CALL((*m_spriteMocks[0]), update()).Times(0);
+    store.update();
+}
+
+TEST_F(SpriteStoreTest, packedArraysStepAndDrawWithoutSpriteCalls)
+{
+    SpriteStore store(SpriteStore::RECTANGLE);
+    store.setLayout(SpriteStore::PACKED_ARRAYS, m_raylibMock);
+
+    Sprite::Body_t spinning = body(Vector2(0, 0), Vector2(1, 0), 100);
+    spinning.m_spin         = 90;
+    spinning.m_tint         = RED;
+    EXPECT_CALL((*m_spriteMocks[0]), getBody()).WillOnce(Return(spinning));
+    EXPECT_CALL((*m_spriteMocks[1]), getBody()).WillOnce(Return(body(Vector2(50, 50), Vector2(0, -1), 10)));
+    for (uint32_t index = 0; index < 2; index++)
+    {
+        EXPECT_CALL((*m_spriteMocks[index]), update()).Times(0);
+        EXPECT_CALL((*m_spriteMocks[index]), draw()).Times(0);
+        EXPECT_CALL((*m_spriteMocks[index]), getRect()).Times(0);
+        store.add(m_spriteMocks[index]);
+    }
+
+    // a fixed tick does not ask raylib for the frame time
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).Times(0);
+    store.step(0.5);
+
+    Sequence seq;
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), FieldsAre(0, 0, 10, 20), FieldsAre(25, 0, 10, 20), FieldsAre(0, 0), 45, FieldsAre(230, 41, 55, 255)))
+        .InSequence(seq);
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), _, FieldsAre(50, 47.5, 10, 20), FieldsAre(0, 0), 0, FieldsAre(255, 255, 255, 255))).InSequence(seq);
+    store.drawBlended(0.5);
+
+    store.sync();
+    EXPECT_THAT(store.getRect(0), FieldsAre(50, 0, 10, 20));
+    EXPECT_THAT(store.getRect(1), FieldsAre(50, 45, 10, 20));
+}
+
+TEST_F(SpriteStoreTest, packedArraysFollowTheRemovals)
+{
+    SpriteStore           store(SpriteStore::RECTANGLE);
+    SpriteStore::Handle_t handles[3];
+    store.setLayout(SpriteStore::PACKED_ARRAYS, m_raylibMock);
+
+    for (uint32_t index = 0; index < m_spriteMocks.size(); index++)
+    {
+        EXPECT_CALL((*m_spriteMocks[index]), getBody()).WillOnce(Return(body(Vector2(index, 0), Vector2(0, 0), 0)));
+        handles[index] = store.add(m_spriteMocks[index]);
+    }
+
+    // the last sprite takes the place of the removed one
+    store.remove(handles[0]);
+    store.sync();
+    EXPECT_EQ(store.getSprite(0), m_spriteMocks[2]);
+    EXPECT_THAT(store.getRect(0), FieldsAre(2, 0, 10, 20));
+    EXPECT_THAT(store.getRect(1), FieldsAre(1, 0, 10, 20));
+
+    store.discard(0);
+    EXPECT_TRUE(m_spriteMocks[2]->m_discard);
+    store.discardMarked();
+    store.sync();
+    ASSERT_EQ(store.size(), 1);
+    EXPECT_EQ(store.getSprite(0), m_spriteMocks[1]);
+    EXPECT_THAT(store.getRect(0), FieldsAre(1, 0, 10, 20));
+    EXPECT_FALSE(store.isDiscarded(0));
+}
+
+TEST_F(SpriteStoreTest, packedArraysWrapAnimateAndAct)
+{
+    SpriteStore store(SpriteStore::NO_SHAPE);
+    store.setLayout(SpriteStore::PACKED_ARRAYS, m_raylibMock);
+
+    Sprite::Body_t star = body(Vector2(0, 95), Vector2(0, 1), 10);
+    star.m_wrapHeight   = 100;
+    star.m_acts         = true;
+    EXPECT_CALL((*m_spriteMocks[0]), getBody()).WillOnce(Return(star));
+
+    Sprite::Body_t explosion = body(Vector2(0, 0), Vector2(0, 0), 0);
+    explosion.m_frames       = TextureAtlas::Frames_t(m_frames, 3);
+    explosion.m_frameRate    = 2;
+    EXPECT_CALL((*m_spriteMocks[1]), getBody()).WillOnce(Return(explosion));
+
+    store.add(m_spriteMocks[0]);
+    store.add(m_spriteMocks[1]);
+
+    // raylib's frame time when no tick is given
+    EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(1));
+    EXPECT_CALL((*m_spriteMocks[0]), act(FieldsAre(0, 5)));
+    EXPECT_CALL((*m_spriteMocks[1]), act(_)).Times(0);
+    store.update();
+    EXPECT_FALSE(m_spriteMocks[1]->m_discard);
+
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), _, FieldsAre(0, 5, 10, 20), _, 0, _));
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(), FieldsAre(20, 0, 10, 20), _, _, 0, _));
+    store.draw();
+
+    // past the last frame
+    EXPECT_CALL((*m_spriteMocks[0]), act(FieldsAre(0, 15)));
+    store.step(1);
+    EXPECT_TRUE(m_spriteMocks[1]->m_discard);
+    store.discardMarked();
+    EXPECT_EQ(store.size(), 1);
+}
+
+// The packed arrays repeat the movement of the sprites' own update(), the two
+// stores must collide and cull the same sprites at the same places, frame
+// after frame.
+TEST_F(SpriteStoreTest, packedArraysMoveLikeTheSprites)
+{
+    TextureAtlas::Frame_t texture = {{1, 0, 0, 0, 0}, {0, 0, 40, 30}};
+    ON_CALL((*m_raylibMock), isWindowReady()).WillByDefault(Return(true));
+    ON_CALL((*m_raylibMock), getFrameTime()).WillByDefault(Return(0.05));
+
+    Sprite::SpriteAttr_t spawn;
+    spawn.m_position  = Vector2(400, -100);
+    spawn.m_direction = Vector2(0.3, 1);
+    spawn.m_speed     = 350;
+
+    std::shared_ptr<Sprite> circles[] = {std::make_shared<Meteor>(m_raylibMock, spawn),
+                                         std::make_shared<Powerup>(m_raylibMock, spawn),
+                                         std::make_shared<Opponent>(m_raylibMock, [](Sprite::SpriteAttr_t) {}, spawn)};
+    std::shared_ptr<Sprite> lasers[]  = {std::make_shared<Laser>(m_raylibMock, Vector2(100, 400), Vector2(0, -1), 0, WHITE),
+                                         std::make_shared<Laser>(m_raylibMock, Vector2(100, 400), Vector2(-0.5, 1), 22.5, YELLOW)};
+
+    SpriteStore objectCircles(SpriteStore::CIRCLE);
+    SpriteStore packedCircles(SpriteStore::CIRCLE);
+    SpriteStore objectLasers(SpriteStore::RECTANGLE);
+    SpriteStore packedLasers(SpriteStore::RECTANGLE);
+    packedCircles.setLayout(SpriteStore::PACKED_ARRAYS, m_raylibMock);
+    packedLasers.setLayout(SpriteStore::PACKED_ARRAYS, m_raylibMock);
+    for (std::shared_ptr<Sprite> sprite : circles)
+    {
+        sprite->setTextures(TextureAtlas::Frames_t(&texture, 1));
+        objectCircles.add(sprite);
+        packedCircles.add(sprite);
+    }
+    for (std::shared_ptr<Sprite> sprite : lasers)
+    {
+        sprite->setTextures(TextureAtlas::Frames_t(&texture, 1));
+        objectLasers.add(sprite);
+        packedLasers.add(sprite);
+    }
+
+    // the objects first, the opponent then acts from where the arrays moved it
+    Rectangle bounds = Rectangle(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
+    for (uint32_t frame = 0; frame < 200; frame++)
+    {
+        objectCircles.update();
+        objectLasers.update();
+        objectCircles.sync();
+        objectLasers.sync();
+        packedCircles.update();
+        packedLasers.update();
+        packedCircles.sync();
+        packedLasers.sync();
+        EXPECT_EQ(packedCircles.cull(bounds), objectCircles.cull(bounds));
+        EXPECT_EQ(packedLasers.cull(bounds), objectLasers.cull(bounds));
+
+        for (uint32_t index = 0; index < packedCircles.size(); index++)
+        {
+            EXPECT_FLOAT_EQ(packedCircles.getCenter(index).x, objectCircles.getCenter(index).x);
+            EXPECT_FLOAT_EQ(packedCircles.getCenter(index).y, objectCircles.getCenter(index).y);
+            EXPECT_EQ(packedCircles.getRadius(index), objectCircles.getRadius(index));
+            EXPECT_EQ(packedCircles.isDiscarded(index), objectCircles.isDiscarded(index));
+        }
+        for (uint32_t index = 0; index < packedLasers.size(); index++)
+        {
+            Rectangle rect = objectLasers.getRect(index);
+            EXPECT_THAT(packedLasers.getRect(index), FieldsAre(rect.x, rect.y, rect.width, rect.height));
+            EXPECT_EQ(packedLasers.isDiscarded(index), objectLasers.isDiscarded(index));
+        }
+    }
+
+    // all of them have left the window
+    EXPECT_TRUE(packedCircles.isDiscarded(0));
+    EXPECT_TRUE(packedCircles.isDiscarded(1));
+    EXPECT_TRUE(packedCircles.isDiscarded(2));
+    EXPECT_TRUE(packedLasers.isDiscarded(0));
+    EXPECT_TRUE(packedLasers.isDiscarded(1));
+}
+
+} // namespace SpriteStoreTest
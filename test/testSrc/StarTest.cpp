@@ -42,8 +42,8 @@ TEST_F(StarTest, updateWithoutTextures_death)
 
 TEST_F(StarTest, update)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Star->setTextures({fakeTexture});
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Star->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
 
     EXPECT_CALL((*m_raylibMock), getFrameTime()).WillOnce(Return(0.001));
     m_Star->update();
@@ -54,14 +54,15 @@ TEST_F(StarTest, update)
 
 TEST_F(StarTest, draw)
 {
-    Texture2D fakeTexture = {0, 0, 0, 0, 0};
-    m_Star->setTextures({fakeTexture});
-
-    EXPECT_CALL((*m_raylibMock), drawTextureEx(A<Texture2D>(),
-                                               A<Vector2>(),
-                                               0,
-                                               A<float>(),
-                                               FieldsAre(255, 255, 255, 255)))
+    TextureAtlas::Frame_t fakeTexture = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    m_Star->setTextures(TextureAtlas::Frames_t(&fakeTexture, 1));
+
+    EXPECT_CALL((*m_raylibMock), drawTexturePro(A<Texture2D>(),
+                                                A<Rectangle>(),
+                                                A<Rectangle>(),
+                                                FieldsAre(0, 0),
+                                                0,
+                                                FieldsAre(255, 255, 255, 255)))
         .Times(Exactly(1));
     m_Star->draw();
 }
@@ -83,8 +84,8 @@ TEST_F(StarTest, getRect_death)
 
 TEST_F(StarTest, setTextures_death)
 {
-    Texture2D              fakeTexture  = {0, 0, 0, 0, 0};
-    std::vector<Texture2D> fakeTextures = {fakeTexture, fakeTexture};
+    TextureAtlas::Frame_t              fakeTexture  = {{0, 0, 0, 0, 0}, {0, 0, 0, 0}};
+    std::vector<TextureAtlas::Frame_t> fakeTextures = {fakeTexture, fakeTexture};
     EXPECT_DEATH(m_Star->setTextures(fakeTextures), "Assertion failed");
 }
 
@@ -0,0 +1,103 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "TextCache.h"
+#include <array>
+#include <vector>
+
+namespace TextCacheTest
+{
+class TextCacheTest : public ::testing::Test
+{
+public:
+    // '?', 'A', ' ' without advance and 'é', in a font of base size 10 with a padding of 1
+    std::array<Rectangle, 4> m_recs   = {Rectangle(0, 0, 4, 8), Rectangle(10, 0, 6, 8), Rectangle(20, 0, 3, 8), Rectangle(30, 0, 6, 10)};
+    std::array<GlyphInfo, 4> m_glyphs = {GlyphInfo('?', 0, 1, 5, {}), GlyphInfo('A', 1, 0, 8, {}), GlyphInfo(' ', 0, 0, 0, {}), GlyphInfo(0xE9, 1, -2, 7, {})};
+    Font                     m_font;
+    TextCache                m_textCache;
+
+    void SetUp(void)
+    {
+        m_font              = Font();
+        m_font.baseSize     = 10;
+        m_font.glyphCount   = m_glyphs.size();
+        m_font.glyphPadding = 1;
+        m_font.texture.id   = 3;
+        m_font.recs         = m_recs.data();
+        m_font.glyphs       = m_glyphs.data();
+    }
+
+    static void expectRectangle(const Rectangle& rectangle, float x, float y, float width, float height)
+    {
+        EXPECT_FLOAT_EQ(rectangle.x, x);
+        EXPECT_FLOAT_EQ(rectangle.y, y);
+        EXPECT_FLOAT_EQ(rectangle.width, width);
+        EXPECT_FLOAT_EQ(rectangle.height, height);
+    }
+};
+
+TEST_F(TextCacheTest, layoutMatchesDrawTextEx)
+{
+    // twice the base size, the space advances by its width
+    const std::vector<TextCache::Quad_t>& quads = m_textCache.getQuads(m_font, "A ?", 20, 1);
+    ASSERT_EQ(quads.size(), 2);
+    expectRectangle(quads[0].m_source, 9, -1, 8, 10);
+    expectRectangle(quads[0].m_dest, 0, -2, 16, 20);
+    expectRectangle(quads[1].m_source, -1, -1, 6, 10);
+    expectRectangle(quads[1].m_dest, 22, 0, 12, 20);
+}
+
+TEST_F(TextCacheTest, unknownAndMultibyteCodepoints)
+{
+    // 'é' in UTF-8, a codepoint the font lacks and a truncated sequence
+    const std::vector<TextCache::Quad_t>& quads = m_textCache.getQuads(m_font, "\xC3\xA9Z\xC3", 10, 0);
+    ASSERT_EQ(quads.size(), 3);
+    expectRectangle(quads[0].m_source, 29, -1, 8, 12);
+    expectRectangle(quads[0].m_dest, 0, -3, 8, 12);
+    expectRectangle(quads[1].m_source, -1, -1, 6, 10);
+    expectRectangle(quads[1].m_dest, 6, 0, 6, 10);
+    expectRectangle(quads[2].m_source, -1, -1, 6, 10);
+    expectRectangle(quads[2].m_dest, 11, 0, 6, 10);
+}
+
+TEST_F(TextCacheTest, lineFeedStartsANewLine)
+{
+    const std::vector<TextCache::Quad_t>& quads = m_textCache.getQuads(m_font, "A\nA", 10, 0);
+    ASSERT_EQ(quads.size(), 2);
+    expectRectangle(quads[0].m_dest, 0, -1, 8, 10);
+    expectRectangle(quads[1].m_dest, 0, (10 + TextCache::LINE_SPACING - 1), 8, 10);
+}
+
+TEST_F(TextCacheTest, steadyTextIsLaidOutOnce)
+{
+    for (uint32_t frame = 0; frame < 10; frame++)
+    {
+        m_textCache.getQuads(m_font, "lives:     3", 20, 0);
+        m_textCache.getQuads(m_font, "lives:     3", 30, 0);
+        m_textCache.endFrame();
+    }
+    EXPECT_EQ(m_textCache.getLayoutCount(), 2);
+    EXPECT_EQ(m_textCache.size(), 2);
+
+    // another font with the same text
+    Font other       = m_font;
+    other.texture.id = 4;
+    m_textCache.getQuads(other, "lives:     3", 20, 0);
+    EXPECT_EQ(m_textCache.getLayoutCount(), 3);
+}
+
+TEST_F(TextCacheTest, textNotDrawnIsDropped)
+{
+    m_textCache.getQuads(m_font, "score:    1", 20, 0);
+    m_textCache.endFrame();
+    m_textCache.getQuads(m_font, "score:    2", 20, 0);
+    m_textCache.endFrame();
+    EXPECT_EQ(m_textCache.size(), 1);
+
+    m_textCache.getQuads(m_font, "score:    1", 20, 0);
+    EXPECT_EQ(m_textCache.getLayoutCount(), 3);
+
+    m_textCache.clear();
+    EXPECT_EQ(m_textCache.size(), 0);
+}
+
+} // namespace TextCacheTest
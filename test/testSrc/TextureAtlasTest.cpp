@@ -0,0 +1,117 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "TextureAtlas.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include "RaylibHeadless.h"
+
+namespace TextureAtlasTest
+{
+class TextureAtlasTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<RaylibHeadless> m_raylibHeadless = nullptr;
+
+    void SetUp(void)
+    {
+        // the headless backend sizes the images from their files
+        m_raylibHeadless = std::make_shared<RaylibHeadless>(1.0f / 60);
+        ASSERT_TRUE(m_raylibHeadless != nullptr);
+    }
+
+    std::vector<std::string> explosionFiles(void)
+    {
+        std::vector<std::string> files;
+        for (uint32_t index = 1; index <= 28; index++)
+        {
+            files.push_back("resources/images/explosion/" + std::to_string(index) + ".png");
+        }
+        return files;
+    }
+
+    static bool overlap(Rectangle first, Rectangle second)
+    {
+        return ((first.x < (second.x + second.width)) && (second.x < (first.x + first.width)) &&
+                (first.y < (second.y + second.height)) && (second.y < (first.y + first.height)));
+    }
+};
+
+TEST_F(TextureAtlasTest, everythingOnOnePage)
+{
+    TextureAtlas atlas(m_raylibHeadless, 2048, 2);
+    atlas.add("meteor", {"resources/images/meteor.png"});
+    atlas.add("laser", {"resources/images/laser.png"});
+    atlas.add("explosion", explosionFiles());
+    atlas.build();
+
+    EXPECT_EQ(atlas.getPageCount(), 1);
+
+    TextureAtlas::Frames_t meteor    = atlas.getFrames("meteor");
+    TextureAtlas::Frames_t laser     = atlas.getFrames("laser");
+    TextureAtlas::Frames_t explosion = atlas.getFrames("explosion");
+    ASSERT_EQ(meteor.size(), 1);
+    ASSERT_EQ(laser.size(), 1);
+    ASSERT_EQ(explosion.size(), 28);
+
+    EXPECT_EQ(meteor[0].m_source.width, 101);
+    EXPECT_EQ(meteor[0].m_source.height, 84);
+    EXPECT_EQ(laser[0].m_source.width, 9);
+    EXPECT_EQ(laser[0].m_source.height, 54);
+    EXPECT_EQ(meteor[0].m_texture.id, laser[0].m_texture.id);
+
+    // every user of a name views the same frames, nothing is copied
+    EXPECT_EQ(atlas.getFrames("explosion").data(), explosion.data());
+
+    std::vector<TextureAtlas::Frame_t> frames(explosion.begin(), explosion.end());
+    frames.push_back(meteor[0]);
+    frames.push_back(laser[0]);
+    for (uint32_t first = 0; first < frames.size(); first++)
+    {
+        EXPECT_EQ(frames[first].m_texture.id, meteor[0].m_texture.id);
+        EXPECT_LE(frames[first].m_source.x + frames[first].m_source.width, frames[first].m_texture.width);
+        EXPECT_LE(frames[first].m_source.y + frames[first].m_source.height, frames[first].m_texture.height);
+        for (uint32_t second = first + 1; second < frames.size(); second++)
+        {
+            EXPECT_FALSE(overlap(frames[first].m_source, frames[second].m_source));
+        }
+    }
+
+    atlas.unload();
+    EXPECT_EQ(atlas.getPageCount(), 0);
+}
+
+TEST_F(TextureAtlasTest, smallPagesAndOversizedImages)
+{
+    // with their padding, two 48x46 explosion frames fit in a row and two rows
+    // in a page, the 112x75 spaceship does not fit at all
+    TextureAtlas atlas(m_raylibHeadless, 100, 2);
+    atlas.add("explosion", explosionFiles());
+    atlas.add("player", {"resources/images/spaceship.png"});
+    atlas.build();
+
+    TextureAtlas::Frames_t explosion = atlas.getFrames("explosion");
+    TextureAtlas::Frames_t player    = atlas.getFrames("player");
+
+    // the spaceship gets a page of its own, then 4 explosion frames per page
+    EXPECT_EQ(atlas.getPageCount(), 1 + 7);
+    EXPECT_EQ(player[0].m_texture.width, 114);
+    EXPECT_EQ(player[0].m_source.x, 0);
+    EXPECT_EQ(player[0].m_source.y, 0);
+
+    for (const TextureAtlas::Frame_t& frame : explosion)
+    {
+        EXPECT_NE(frame.m_texture.id, player[0].m_texture.id);
+        EXPECT_LE(frame.m_texture.width, 100);
+        EXPECT_LE(frame.m_texture.height, 100);
+    }
+}
+
+TEST_F(TextureAtlasTest, getUnknown_death)
+{
+    TextureAtlas atlas(m_raylibHeadless, 2048, 2);
+    atlas.build();
+    EXPECT_DEATH(atlas.getFrames("unknown"), "Assertion failed");
+}
+
+} // namespace TextureAtlasTest
@@ -0,0 +1,162 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "TimerWheel.h"
+#include <memory>
+#include <vector>
+
+using ::testing::ElementsAre;
+
+namespace TimerWheelTest
+{
+class TimerWheelTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<TimerWheel> m_TimerWheel = nullptr;
+    std::vector<uint32_t>       m_fired;
+
+    void SetUp(void)
+    {
+        m_TimerWheel = std::make_shared<TimerWheel>();
+        ASSERT_TRUE(m_TimerWheel != nullptr);
+    }
+
+    std::function<void(void)> record(uint32_t id)
+    {
+        return [this, id](void) { m_fired.push_back(id); };
+    }
+};
+
+TEST_F(TimerWheelTest, autostart)
+{
+    TimerWheel::Handle_t started = m_TimerWheel->add(1, false, true, record(0));
+    TimerWheel::Handle_t stopped = m_TimerWheel->add(1, false, false, record(1));
+
+    EXPECT_TRUE(m_TimerWheel->isActive(started));
+    EXPECT_FALSE(m_TimerWheel->isActive(stopped));
+    EXPECT_EQ(m_TimerWheel->size(), 2);
+
+    m_TimerWheel->advance(2);
+    EXPECT_THAT(m_fired, ElementsAre(0));
+    EXPECT_FALSE(m_TimerWheel->isActive(started));
+}
+
+TEST_F(TimerWheelTest, firesOnceAfterDuration)
+{
+    m_TimerWheel->add(0.4, false, true, record(0));
+
+    m_TimerWheel->advance(0.399);
+    EXPECT_TRUE(m_fired.empty());
+
+    m_TimerWheel->advance(0.001);
+    EXPECT_THAT(m_fired, ElementsAre(0));
+
+    m_TimerWheel->advance(10);
+    EXPECT_THAT(m_fired, ElementsAre(0));
+    EXPECT_EQ(m_TimerWheel->getTime(), 10.4);
+}
+
+TEST_F(TimerWheelTest, repeatDoesNotDrift)
+{
+    m_TimerWheel->add(0.4, true, true, record(0));
+
+    // 60 Hz frame times do not add up to whole milliseconds
+    for (uint32_t frame = 0; frame < 60; frame++)
+    {
+        m_TimerWheel->advance(1.0 / 60);
+    }
+    EXPECT_EQ(m_fired.size(), 2);
+
+    m_TimerWheel->advance(3);
+    EXPECT_EQ(m_fired.size(), 10);
+}
+
+TEST_F(TimerWheelTest, sameExpiryFiresInActivationOrder)
+{
+    // 0 is cascaded down from a higher level, 1 to 3 are scheduled directly
+    // in the lowest level, 2 is activated last
+    m_TimerWheel->add(5, false, true, record(0));
+    m_TimerWheel->advance(4.99);
+
+    TimerWheel::Handle_t second = m_TimerWheel->add(0.01, false, false, record(2));
+    m_TimerWheel->add(0.01, false, true, record(1));
+    m_TimerWheel->add(0.01, false, true, record(3));
+    m_TimerWheel->activate(second);
+
+    m_TimerWheel->advance(0.01);
+    EXPECT_THAT(m_fired, ElementsAre(0, 1, 3, 2));
+}
+
+TEST_F(TimerWheelTest, deactivateAndRestart)
+{
+    TimerWheel::Handle_t handle = m_TimerWheel->add(1, false, true, record(0));
+
+    m_TimerWheel->advance(0.5);
+    m_TimerWheel->deactivate(handle);
+    m_TimerWheel->advance(1);
+    EXPECT_TRUE(m_fired.empty());
+
+    // restarting counts the whole duration again
+    m_TimerWheel->activate(handle);
+    m_TimerWheel->advance(0.9);
+    m_TimerWheel->activate(handle);
+    m_TimerWheel->advance(0.9);
+    EXPECT_TRUE(m_fired.empty());
+
+    m_TimerWheel->advance(0.1);
+    EXPECT_THAT(m_fired, ElementsAre(0));
+}
+
+TEST_F(TimerWheelTest, remove)
+{
+    TimerWheel::Handle_t handle = m_TimerWheel->add(1, true, true, record(0));
+    m_TimerWheel->remove(handle);
+
+    EXPECT_FALSE(m_TimerWheel->contains(handle));
+    EXPECT_EQ(m_TimerWheel->size(), 0);
+
+    m_TimerWheel->advance(5);
+    EXPECT_TRUE(m_fired.empty());
+}
+
+TEST_F(TimerWheelTest, callbacksChangeTheWheel)
+{
+    TimerWheel::Handle_t victim;
+    TimerWheel::Handle_t self;
+
+    // the first timer removes the second, which expires in the same millisecond,
+    // and adds a third timer that fires later
+    m_TimerWheel->add(1, false, true, [this, &victim](void) {
+        m_fired.push_back(0);
+        m_TimerWheel->remove(victim);
+        m_TimerWheel->add(1, false, true, record(2));
+    });
+    victim = m_TimerWheel->add(1, false, true, record(1));
+
+    // a repeating timer that stops itself
+    self = m_TimerWheel->add(0.5, true, true, [this, &self](void) {
+        m_fired.push_back(3);
+        m_TimerWheel->deactivate(self);
+    });
+
+    m_TimerWheel->advance(1);
+    EXPECT_THAT(m_fired, ElementsAre(3, 0));
+
+    m_TimerWheel->advance(1);
+    EXPECT_THAT(m_fired, ElementsAre(3, 0, 2));
+    EXPECT_FALSE(m_TimerWheel->isActive(self));
+}
+
+TEST_F(TimerWheelTest, beyondTheSpanOfTheWheel)
+{
+    // 2^24 ms is about 4.7 h
+    m_TimerWheel->add(5 * 3600, false, true, record(0));
+    m_TimerWheel->add(4 * 3600, false, true, record(1));
+
+    m_TimerWheel->advance((5 * 3600) - 0.001);
+    EXPECT_THAT(m_fired, ElementsAre(1));
+
+    m_TimerWheel->advance(0.001);
+    EXPECT_THAT(m_fired, ElementsAre(1, 0));
+}
+
+} // namespace TimerWheelTest
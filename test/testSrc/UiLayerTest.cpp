@@ -0,0 +1,132 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "UiLayer.h"
+#include <memory>
+#include "RaylibMock.h"
+
+using ::testing::_;
+using ::testing::Field;
+using ::testing::FieldsAre;
+using ::testing::InSequence;
+using ::testing::Mock;
+using ::testing::Return;
+
+namespace UiLayerTest
+{
+class UiLayerTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<RaylibMock> m_raylibMock = nullptr;
+    std::shared_ptr<UiLayer>    m_uiLayer    = nullptr;
+
+    void SetUp(void)
+    {
+        m_raylibMock = std::make_shared<RaylibMock>();
+        ASSERT_TRUE(m_raylibMock != nullptr);
+
+        RenderTexture2D target = {3, Texture2D(4, 200, 100, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), Texture2D(5, 200, 100, 1, 0)};
+        EXPECT_CALL((*m_raylibMock), loadRenderTexture(200, 100)).WillOnce(Return(target));
+        m_uiLayer = std::make_shared<UiLayer>(m_raylibMock, 200, 100);
+        ASSERT_TRUE(m_uiLayer != nullptr);
+        Mock::VerifyAndClearExpectations(m_raylibMock.get());
+    }
+
+    void TearDown(void)
+    {
+        EXPECT_CALL((*m_raylibMock), unloadRenderTexture(Field(&RenderTexture2D::id, 3))).Times(1);
+        m_uiLayer = nullptr;
+        Mock::VerifyAndClearExpectations(m_raylibMock.get());
+    }
+
+    // a widget drawing its area as a rectangle
+    uint32_t addWidget(Rectangle area)
+    {
+        return m_uiLayer->add(area, [this, area](void) { m_raylibMock->drawRectangleRounded(area, 0, 0, WHITE); });
+    }
+
+    void expectWidget(Rectangle area)
+    {
+        EXPECT_CALL((*m_raylibMock), drawRectangleRounded(FieldsAre(area.x, area.y, area.width, area.height), 0, 0, _)).Times(1);
+    }
+
+    void expectNoDraws(void)
+    {
+        EXPECT_CALL((*m_raylibMock), beginTextureMode(_)).Times(0);
+        EXPECT_CALL((*m_raylibMock), clearBackground(_)).Times(0);
+        EXPECT_CALL((*m_raylibMock), drawRectangleRounded(_, _, _, _)).Times(0);
+    }
+};
+
+TEST_F(UiLayerTest, firstUpdateDrawsEveryWidget)
+{
+    Rectangle title  = {0, 0, 200, 40};
+    Rectangle button = {20, 50, 80, 30};
+    addWidget(title);
+    addWidget(button);
+
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_raylibMock), beginTextureMode(Field(&RenderTexture2D::id, 3))).Times(1);
+        EXPECT_CALL((*m_raylibMock), clearBackground(FieldsAre(0, 0, 0, 0))).Times(1);
+        expectWidget(title);
+        expectWidget(button);
+        EXPECT_CALL((*m_raylibMock), endTextureMode()).Times(1);
+    }
+    m_uiLayer->update();
+    EXPECT_EQ(m_uiLayer->getRedrawCount(), 2);
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    // nothing changed since
+    expectNoDraws();
+    m_uiLayer->update();
+    m_uiLayer->update();
+    EXPECT_EQ(m_uiLayer->getRedrawCount(), 2);
+}
+
+TEST_F(UiLayerTest, invalidatedWidgetIsRedrawnUnderScissor)
+{
+    Rectangle panel  = {0, 0, 100, 100};
+    Rectangle button = {50.5f, 50.5f, 100, 40};
+    Rectangle other  = {160, 10, 20, 20};
+    addWidget(panel);
+    uint32_t widget = addWidget(button);
+    addWidget(other);
+
+    EXPECT_CALL((*m_raylibMock), beginTextureMode(_)).Times(1);
+    EXPECT_CALL((*m_raylibMock), clearBackground(_)).Times(1);
+    EXPECT_CALL((*m_raylibMock), drawRectangleRounded(_, _, _, _)).Times(3);
+    EXPECT_CALL((*m_raylibMock), endTextureMode()).Times(1);
+    m_uiLayer->update();
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    // the button and the panel under it are drawn again, clipped to the button rounded out
+    m_uiLayer->invalidate(widget);
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_raylibMock), beginTextureMode(Field(&RenderTexture2D::id, 3))).Times(1);
+        EXPECT_CALL((*m_raylibMock), beginScissorMode(50, 50, 101, 41)).Times(1);
+        EXPECT_CALL((*m_raylibMock), clearBackground(FieldsAre(0, 0, 0, 0))).Times(1);
+        expectWidget(panel);
+        expectWidget(button);
+        EXPECT_CALL((*m_raylibMock), endScissorMode()).Times(1);
+        EXPECT_CALL((*m_raylibMock), endTextureMode()).Times(1);
+    }
+    m_uiLayer->update();
+    EXPECT_EQ(m_uiLayer->getRedrawCount(), 5);
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    expectNoDraws();
+    m_uiLayer->update();
+}
+
+TEST_F(UiLayerTest, drawIsASingleQuad)
+{
+    addWidget(Rectangle(0, 0, 200, 100));
+
+    EXPECT_CALL((*m_raylibMock), drawRenderTexture(Field(&RenderTexture2D::id, 3), FieldsAre(0, 0), FieldsAre(255, 255, 255, 255))).Times(2);
+    EXPECT_CALL((*m_raylibMock), drawRectangleRounded(_, _, _, _)).Times(0);
+    m_uiLayer->draw();
+    m_uiLayer->draw();
+}
+
+} // namespace UiLayerTest
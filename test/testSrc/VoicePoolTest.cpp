@@ -0,0 +1,140 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "VoicePool.h"
+#include <memory>
+#include "RaylibMock.h"
+
+using ::testing::_;
+using ::testing::Field;
+using ::testing::FloatEq;
+using ::testing::InSequence;
+using ::testing::Mock;
+using ::testing::Return;
+
+namespace VoicePoolTest
+{
+class VoicePoolTest : public ::testing::Test
+{
+public:
+    std::shared_ptr<RaylibMock> m_raylibMock = nullptr;
+    std::shared_ptr<VoicePool>  m_voicePool  = nullptr;
+
+    void SetUp(void)
+    {
+        m_raylibMock = std::make_shared<RaylibMock>();
+        ASSERT_TRUE(m_raylibMock != nullptr);
+
+        m_voicePool = std::make_shared<VoicePool>(m_raylibMock);
+        ASSERT_TRUE(m_voicePool != nullptr);
+    }
+
+    void TearDown(void)
+    {
+        m_voicePool = nullptr;
+        Mock::VerifyAndClearExpectations(m_raylibMock.get());
+    }
+
+    // a sound of a second, at 100 frames per second
+    static Sound sound(void)
+    {
+        return Sound({nullptr, nullptr, 100, 16, 1}, 100);
+    }
+
+    // the aliases are told apart by their frame count
+    static Sound alias(uint32_t tag)
+    {
+        return Sound({nullptr, nullptr, 100, 16, 1}, tag);
+    }
+
+    uint32_t addSound(uint32_t firstTag, uint32_t polyphony)
+    {
+        InSequence seq;
+        for (uint32_t voice = 0; voice < polyphony; voice++)
+        {
+            EXPECT_CALL((*m_raylibMock), loadSoundAlias(Field(&Sound::frameCount, 100))).WillOnce(Return(alias(firstTag + voice)));
+        }
+        return m_voicePool->add(sound(), polyphony);
+    }
+};
+
+TEST_F(VoicePoolTest, aliasesAreUnloadedWithThePool)
+{
+    addSound(1001, 3);
+    addSound(2001, 1);
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    EXPECT_CALL((*m_raylibMock), unloadSoundAlias(_)).Times(4);
+    m_voicePool->clear();
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    // nothing left to unload
+    EXPECT_CALL((*m_raylibMock), unloadSoundAlias(_)).Times(0);
+}
+
+TEST_F(VoicePoolTest, triggersOfAFrameAreCoalesced)
+{
+    uint32_t laser     = addSound(1001, 2);
+    uint32_t explosion = addSound(2001, 2);
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    // nothing is played before update()
+    EXPECT_CALL((*m_raylibMock), playSound(_)).Times(0);
+    for (uint32_t shot = 0; shot < 4; shot++)
+    {
+        m_voicePool->play(laser);
+    }
+    m_voicePool->play(explosion);
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    EXPECT_CALL((*m_raylibMock), getTime()).WillRepeatedly(Return(0));
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_raylibMock), setSoundVolume(Field(&Sound::frameCount, 1001), FloatEq(2))).Times(1);
+        EXPECT_CALL((*m_raylibMock), playSound(Field(&Sound::frameCount, 1001))).Times(1);
+        EXPECT_CALL((*m_raylibMock), setSoundVolume(Field(&Sound::frameCount, 2001), FloatEq(1))).Times(1);
+        EXPECT_CALL((*m_raylibMock), playSound(Field(&Sound::frameCount, 2001))).Times(1);
+    }
+    m_voicePool->update();
+    Mock::VerifyAndClearExpectations(m_raylibMock.get());
+
+    // the triggers were spent
+    EXPECT_CALL((*m_raylibMock), playSound(_)).Times(0);
+    m_voicePool->update();
+
+    VoicePool::Stats_t stats = m_voicePool->getStats();
+    EXPECT_EQ(stats.m_triggers, 5);
+    EXPECT_EQ(stats.m_voices, 2);
+    EXPECT_EQ(stats.m_stolen, 0);
+    EXPECT_CALL((*m_raylibMock), unloadSoundAlias(_)).Times(4);
+}
+
+TEST_F(VoicePoolTest, busyVoicesAreStolenOldestFirst)
+{
+    uint32_t explosion = addSound(1001, 2);
+    EXPECT_CALL((*m_raylibMock), setSoundVolume(_, _)).Times(4);
+    EXPECT_CALL((*m_raylibMock), unloadSoundAlias(_)).Times(2);
+    {
+        InSequence seq;
+        EXPECT_CALL((*m_raylibMock), getTime()).WillOnce(Return(0));
+        EXPECT_CALL((*m_raylibMock), playSound(Field(&Sound::frameCount, 1001))).Times(1);
+        EXPECT_CALL((*m_raylibMock), getTime()).WillOnce(Return(0.25));
+        EXPECT_CALL((*m_raylibMock), playSound(Field(&Sound::frameCount, 1002))).Times(1);
+        EXPECT_CALL((*m_raylibMock), getTime()).WillOnce(Return(0.5));
+        EXPECT_CALL((*m_raylibMock), playSound(Field(&Sound::frameCount, 1001))).Times(1);
+
+        // the second voice is done at 1.25, the first plays until 1.5
+        EXPECT_CALL((*m_raylibMock), getTime()).WillOnce(Return(1.25));
+        EXPECT_CALL((*m_raylibMock), playSound(Field(&Sound::frameCount, 1002))).Times(1);
+    }
+    for (uint32_t frame = 0; frame < 4; frame++)
+    {
+        m_voicePool->play(explosion);
+        m_voicePool->update();
+    }
+
+    VoicePool::Stats_t stats = m_voicePool->getStats();
+    EXPECT_EQ(stats.m_voices, 4);
+    EXPECT_EQ(stats.m_stolen, 1);
+}
+
+} // namespace VoicePoolTest
@@ -0,0 +1,26 @@
+#include <string>
+#include "AssetArchive.h"
+#include "GameSettings.h"
+#include "Logger.h"
+
+// Pack a resources tree into the archive the game maps at startup, then open
+// it again and check every content against its hash.
+// assetPacker [root] [archive], resources and ASSET_ARCHIVE_FILE by default
+int main(int argc, char* argv[])
+{
+    std::string root    = (argc > 1) ? argv[1] : "resources";
+    std::string archive = (argc > 2) ? argv[2] : ASSET_ARCHIVE_FILE;
+
+    if (!AssetArchive::pack(root, archive))
+    {
+        return 1;
+    }
+
+    AssetArchive packed(archive);
+    if (!packed.isOpen() || !packed.verify())
+    {
+        return 1;
+    }
+    Logger::getInstance().log(Logger::INFO, std::to_string(packed.size()) + " assets packed from " + root + " into " + archive);
+    return 0;
+}